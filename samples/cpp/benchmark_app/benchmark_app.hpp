@@ -71,6 +71,22 @@ static const char maximum_inference_rate_message[] =
     "If not specified, default value is 0, the inference will run at maximum rate depending on a device capabilities. "
     "Tweaking this value allow better accuracy in power usage measurement by limiting the execution.";
 
+/// @brief message for open-loop load option
+static const char qps_message[] =
+    "Optional. Enables open-loop load: the requests arrive with Poisson distributed intervals at the given "
+    "average rate (queries per second) regardless of the completion of the previous ones. The latency includes "
+    "the time the request waits for an idle infer request.";
+
+/// @brief message for arrival trace option
+static const char arrival_trace_message[] =
+    "Optional. Path to a file with the arrival times of the requests in milliseconds separated by whitespaces, "
+    "commas or new lines. Enables open-loop load replaying the trace in a loop, rescaled to -qps rate if it is set.";
+
+/// @brief message for load sweep option
+static const char qps_sweep_message[] =
+    "Optional. Runs the open-loop load for every rate from <start> to <stop> with <step> in <start>:<stop>:<step> "
+    "format, each for the -t/-niter limits, and reports the throughput-latency curve and the saturation point.";
+
 /// @brief message for execution time
 static const char execution_time_message[] = "Optional. Time in seconds to execute topology.";
 
@@ -93,6 +109,14 @@ static const char data_shape_message[] =
     " or \"input1[1,192][1,384],input2[1,192][1,384],input3[1,192][1,384],input4[1,192][1,384]\"."
     " If model shapes are all static specifying the option will cause an exception.";
 
+/// @brief message for shape trace option
+static const char shape_trace_message[] =
+    "Optional. Path to a recorded trace of the input data shapes of a dynamic model replayed in a loop instead of "
+    "cycling through -data_shape: a JSON array of the data shapes or of {\"shape\": ..., \"count\": ...} objects, "
+    "or a text file with a data shape per line optionally followed by ';' and the number of its repetitions. "
+    "Every data shape is set in -data_shape format, e.g. \"[1,128]\" or \"input_ids[1,128],mask[1,128]\". "
+    "Reports the latency of every data shape and the hits and misses of the CPU runtime caches.";
+
 static const char layout_message[] =
     "Optional. Prompts how model layouts should be treated by application. "
     "For example, \"input1[NCHW],input2[NC]\" or \"[NCHW]\" in case of one input size.";
@@ -193,6 +217,17 @@ static const char infer_latency_percentile_message[] =
     "Optional. Defines the percentile to be reported in latency metric. The valid range is [1, 100]. The default value "
     "is 50 (median).";
 
+/// @brief message for latency histograms option
+static const char latency_histograms_message[] =
+    "Optional. Collects HDR histograms of the latency and reports p50, p90, p99 and p99.9 percentiles. "
+    "When performance counters are enabled, the histograms of the real time of every layer are collected too. "
+    "The histograms are stored to benchmark_latency_histograms.json if -report_type is set.";
+
+/// @brief message for latency series option
+static const char latency_series_message[] =
+    "Optional. Stores the start time and the latency of every iteration to benchmark_latency_series.json. "
+    "Should be used together with -report_type option.";
+
 // @brief message for report_type option
 static const char report_type_message[] =
     "Optional. Enable collecting statistics report. \"no_counters\" report contains "
@@ -249,6 +284,10 @@ static const char load_config_message[] =
     "                                               }\n"
     "                                       }";
 
+static const char warmup_window_message[] =
+    "Optional. Time in milliseconds from the start of the measurement. The latencies of the iterations started "
+    "within it are excluded from the latency statistics, the throughput is measured over the whole run.";
+
 static const char no_warmup_message[] =
     "Optional. Skip warmup inference. Useful for benchmarking purposes in simulated environments.\n"
     "Otherwise, not recommended.";
@@ -291,6 +330,9 @@ DEFINE_string(shape, "", shape_message);
 /// @brief Define flag for input blob shape <br>
 DEFINE_string(data_shape, "", data_shape_message);
 
+/// @brief Define flag for the recorded trace of the input data shapes <br>
+DEFINE_string(shape_trace, "", shape_trace_message);
+
 /// @brief Define flag for layout shape <br>
 DEFINE_string(layout, "", layout_message);
 
@@ -317,6 +359,15 @@ DEFINE_uint64(nireq, 0, infer_requests_count_message);
 /// @brief Execute infer requests at a fixed frequency
 DEFINE_double(max_irate, 0, maximum_inference_rate_message);
 
+/// @brief Average arrival rate of the open-loop load
+DEFINE_double(qps, 0, qps_message);
+
+/// @brief Arrival times of the open-loop load
+DEFINE_string(arrival_trace, "", arrival_trace_message);
+
+/// @brief Sweep of the arrival rate of the open-loop load
+DEFINE_string(qps_sweep, "", qps_sweep_message);
+
 /// @brief Number of streams to use for inference on the CPU (also affects Hetero cases)
 DEFINE_string(nstreams, "", infer_num_streams_message);
 
@@ -387,6 +438,15 @@ DEFINE_string(dump_config, "", dump_config_message);
 /// @brief Skips warmup inference and measures only the first inference
 DEFINE_bool(no_warmup, false, no_warmup_message);
 
+/// @brief Excludes the iterations started within the window from the latency statistics
+DEFINE_uint64(warmup_window, 0, warmup_window_message);
+
+/// @brief Define flag for collecting latency histograms <br>
+DEFINE_bool(latency_histograms, false, latency_histograms_message);
+
+/// @brief Define flag for dumping latency of every iteration <br>
+DEFINE_bool(latency_series, false, latency_series_message);
+
 /**
  * @brief This function show a help message
  */
@@ -403,11 +463,15 @@ static void show_usage() {
     std::cout << "    -niter  <integer>             " << iterations_count_message << std::endl;
     std::cout << "    -max_irate \"<float>\"        " << maximum_inference_rate_message << std::endl;
     std::cout << "    -t                            " << execution_time_message << std::endl;
+    std::cout << "    -qps \"<float>\"              " << qps_message << std::endl;
+    std::cout << "    -arrival_trace  <path>        " << arrival_trace_message << std::endl;
+    std::cout << "    -qps_sweep  <start:stop:step> " << qps_sweep_message << std::endl;
     std::cout << std::endl;
     std::cout << "Input shapes" << std::endl;
     std::cout << "    -b  <integer>                 " << batch_size_message << std::endl;
     std::cout << "    -shape                        " << shape_message << std::endl;
     std::cout << "    -data_shape                   " << data_shape_message << std::endl;
+    std::cout << "    -shape_trace  <path>          " << shape_trace_message << std::endl;
     std::cout << "    -layout                       " << layout_message << std::endl;
     std::cout << std::endl;
     std::cout << "Advanced options" << std::endl;
@@ -421,6 +485,7 @@ static void show_usage() {
     std::cout << "    -inference_only         " << inference_only_message << std::endl;
     std::cout << "    -infer_precision        " << inference_precision_message << std::endl;
     std::cout << "    -no_warmup                    " << no_warmup_message << std::endl;
+    std::cout << "    -warmup_window  <integer>     " << warmup_window_message << std::endl;
     std::cout << std::endl;
     std::cout << "Preprocessing options:" << std::endl;
     std::cout << "    -ip   <value>           " << inputs_precision_message << std::endl;
@@ -436,6 +501,8 @@ static void show_usage() {
     std::cout << std::endl;
     std::cout << "Statistics dumping options:" << std::endl;
     std::cout << "    -latency_percentile     " << infer_latency_percentile_message << std::endl;
+    std::cout << "    -latency_histograms     " << latency_histograms_message << std::endl;
+    std::cout << "    -latency_series         " << latency_series_message << std::endl;
     std::cout << "    -report_type  <type>    " << report_type_message << std::endl;
     std::cout << "    -report_folder          " << report_folder_message << std::endl;
     std::cout << "    -json_stats             " << json_stats_message << std::endl;
@@ -23,7 +23,11 @@
 #include "utils.hpp"
 // clang-format on
 
-typedef std::function<void(size_t id, size_t group_id, const double latency, const std::exception_ptr& ptr)>
+typedef std::function<void(size_t id,
+                           size_t group_id,
+                           const Time::time_point& start_time,
+                           const double latency,
+                           const std::exception_ptr& ptr)>
     QueueCallbackFunction;
 
 /// @brief Handles asynchronous callbacks and calculates execution time
@@ -41,12 +45,17 @@ public:
           outputClBuffer() {
         _request.set_callback([&](const std::exception_ptr& ptr) {
             _endTime = Time::now();
-            _callbackQueue(_id, _lat_group_id, get_execution_time_in_milliseconds(), ptr);
+            _callbackQueue(_id, _lat_group_id, _startTime, get_execution_time_in_milliseconds(), ptr);
         });
     }
 
     void start_async() {
-        _startTime = Time::now();
+        start_async(Time::now());
+    }
+
+    /// @brief starts the request, the latency is counted from the start time
+    void start_async(const Time::time_point& startTime) {
+        _startTime = startTime;
         _request.start_async();
     }
 
@@ -55,10 +64,15 @@ public:
     }
 
     void infer() {
-        _startTime = Time::now();
+        infer(Time::now());
+    }
+
+    /// @brief runs the request synchronously, the latency is counted from the start time
+    void infer(const Time::time_point& startTime) {
+        _startTime = startTime;
         _request.infer();
         _endTime = Time::now();
-        _callbackQueue(_id, _lat_group_id, get_execution_time_in_milliseconds(), nullptr);
+        _callbackQueue(_id, _lat_group_id, _startTime, get_execution_time_in_milliseconds(), nullptr);
     }
 
     std::vector<ov::ProfilingInfo> get_performance_counts() {
@@ -87,6 +101,10 @@ public:
         _lat_group_id = id;
     }
 
+    Time::time_point get_start_time() const {
+        return _startTime;
+    }
+
     // in case of using GPU memory we need to allocate CL buffer for
     // output blobs. By encapsulating cl buffer inside InferReqWrap
     // we will control the number of output buffers and access to it.
@@ -116,7 +134,8 @@ public:
                                                                         std::placeholders::_1,
                                                                         std::placeholders::_2,
                                                                         std::placeholders::_3,
-                                                                        std::placeholders::_4)));
+                                                                        std::placeholders::_4,
+                                                                        std::placeholders::_5)));
             _idleIds.push(id);
         }
         _latency_groups.resize(lat_group_n);
@@ -137,26 +156,47 @@ public:
         _startTime = Time::time_point::max();
         _endTime = Time::time_point::min();
         _latencies.clear();
+        _iterations.clear();
         for (auto& group : _latency_groups) {
             group.clear();
         }
     }
 
+    /// @brief latencies of the requests started before the time are excluded from the latency statistics,
+    /// such requests are still counted in the duration of the run and marked as warm-up in the iterations
+    void set_warmup_end_time(const Time::time_point& time) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _warmupEndTime = time;
+    }
+
+    /// @brief enables collecting of the start time and the latency of every iteration
+    void enable_iterations_collecting() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _collectIterations = true;
+    }
+
     double get_duration_in_milliseconds() {
         return std::chrono::duration_cast<ns>(_endTime - _startTime).count() * 0.000001;
     }
 
     void put_idle_request(size_t id,
                           size_t lat_group_id,
+                          const Time::time_point& start_time,
                           const double latency,
                           const std::exception_ptr& ptr = nullptr) {
         std::unique_lock<std::mutex> lock(_mutex);
         if (ptr) {
             inferenceException = ptr;
         } else {
-            _latencies.push_back(latency);
-            if (enable_lat_groups) {
-                _latency_groups[lat_group_id].push_back(latency);
+            const bool warmup = start_time < _warmupEndTime;
+            if (!warmup) {
+                _latencies.push_back(latency);
+                if (enable_lat_groups) {
+                    _latency_groups[lat_group_id].push_back(latency);
+                }
+            }
+            if (_collectIterations) {
+                _iterations.push_back({start_time, latency, lat_group_id, warmup});
             }
             _idleIds.push(id);
             _endTime = std::max(Time::now(), _endTime);
@@ -196,6 +236,21 @@ public:
         return _latency_groups;
     }
 
+    /// @brief start time in milliseconds relative to the start of the first request, latency and warm-up flag of
+    /// every iteration in the order of completion
+    std::vector<IterationStatistics> get_iterations() {
+        std::vector<IterationStatistics> iterations;
+        iterations.reserve(_iterations.size());
+        for (const auto& iteration : _iterations) {
+            iterations.push_back(
+                {std::chrono::duration_cast<ns>(iteration.start_time - _startTime).count() * 0.000001,
+                 iteration.latency,
+                 iteration.group_id,
+                 iteration.warmup});
+        }
+        return iterations;
+    }
+
     std::vector<InferReqWrap::Ptr> requests;
 
 private:
@@ -206,6 +261,15 @@ private:
     Time::time_point _endTime;
     std::vector<double> _latencies;
     std::vector<std::vector<double>> _latency_groups;
+    struct Iteration {
+        Time::time_point start_time;
+        double latency;
+        size_t group_id;
+        bool warmup;
+    };
+    std::vector<Iteration> _iterations;
+    bool _collectIterations = false;
+    Time::time_point _warmupEndTime = Time::time_point::min();
     bool enable_lat_groups;
     std::exception_ptr inferenceException = nullptr;
 };
@@ -0,0 +1,114 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// clang-format off
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "samples/common.hpp"
+#include "samples/slog.hpp"
+
+#include "latency_histogram.hpp"
+// clang-format on
+
+namespace {
+// values below are stored in the buckets of 1 microsecond
+constexpr uint64_t linear_buckets = 128;
+// number of buckets every next power of two is split into
+constexpr uint64_t sub_buckets = linear_buckets / 2;
+constexpr uint64_t sub_bucket_bits = 6;
+}  // namespace
+
+const std::vector<double> LatencyHistogram::reported_percentiles = {50.0, 90.0, 99.0, 99.9};
+
+size_t LatencyHistogram::get_bucket_index(uint64_t value_us) {
+    if (value_us < linear_buckets) {
+        return static_cast<size_t>(value_us);
+    }
+    uint64_t msb = 0;
+    for (uint64_t v = value_us; v > 1; v >>= 1) {
+        ++msb;
+    }
+    // value_us >> shift is in [sub_buckets, 2 * sub_buckets)
+    const uint64_t shift = msb - sub_bucket_bits;
+    return static_cast<size_t>(linear_buckets + (shift - 1) * sub_buckets + ((value_us >> shift) - sub_buckets));
+}
+
+uint64_t LatencyHistogram::get_bucket_lower_bound(size_t index) {
+    if (index < linear_buckets) {
+        return index;
+    }
+    const uint64_t shift = (index - linear_buckets) / sub_buckets + 1;
+    return ((index - linear_buckets) % sub_buckets + sub_buckets) << shift;
+}
+
+uint64_t LatencyHistogram::get_bucket_upper_bound(size_t index) {
+    if (index < linear_buckets) {
+        return index;
+    }
+    const uint64_t shift = (index - linear_buckets) / sub_buckets + 1;
+    return get_bucket_lower_bound(index) + (uint64_t(1) << shift) - 1;
+}
+
+void LatencyHistogram::record(double latency_ms) {
+    const auto value_us = static_cast<uint64_t>(std::max(0.0, latency_ms) * 1000.0);
+    const auto index = get_bucket_index(value_us);
+    if (index >= _buckets.size()) {
+        _buckets.resize(index + 1, 0);
+    }
+    ++_buckets[index];
+    _min = _count == 0 ? latency_ms : std::min(_min, latency_ms);
+    _max = _count == 0 ? latency_ms : std::max(_max, latency_ms);
+    ++_count;
+}
+
+double LatencyHistogram::get_percentile(double percentile) const {
+    if (_count == 0) {
+        return 0;
+    }
+    const auto rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(percentile / 100.0 * _count)));
+    uint64_t accumulated = 0;
+    for (size_t i = 0; i < _buckets.size(); ++i) {
+        accumulated += _buckets[i];
+        if (accumulated >= rank) {
+            return std::max(_min, std::min(_max, get_bucket_upper_bound(i) / 1000.0));
+        }
+    }
+    return _max;
+}
+
+std::string LatencyHistogram::get_percentile_name(double percentile) {
+    std::ostringstream name;
+    name << "p" << percentile;
+    return name.str();
+}
+
+nlohmann::json LatencyHistogram::to_json() const {
+    nlohmann::json js;
+    js["count"] = _count;
+    js["min"] = _min;
+    js["max"] = _max;
+    for (const auto& percentile : reported_percentiles) {
+        js["percentiles"][get_percentile_name(percentile)] = get_percentile(percentile);
+    }
+    js["buckets"] = nlohmann::json::array();
+    for (size_t i = 0; i < _buckets.size(); ++i) {
+        if (_buckets[i] != 0) {
+            js["buckets"].push_back(
+                {get_bucket_lower_bound(i) / 1000.0, (get_bucket_upper_bound(i) + 1) / 1000.0, _buckets[i]});
+        }
+    }
+    return js;
+}
+
+void LatencyHistogram::write_to_slog() const {
+    for (const auto& percentile : reported_percentiles) {
+        std::string name = "   " + get_percentile_name(percentile) + ":";
+        name.resize(21, ' ');
+        slog::info << name << double_to_string(get_percentile(percentile)) << " ms" << slog::endl;
+    }
+}
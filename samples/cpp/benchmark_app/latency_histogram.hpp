@@ -0,0 +1,58 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#ifdef JSON_HEADER
+#    include <json.hpp>
+#else
+#    include <nlohmann/json.hpp>
+#endif
+
+/// @brief HDR-style histogram of latencies with microsecond resolution. The buckets are linear below 128
+/// microseconds, above that every power of two is split into 64 buckets, so the relative error of the reported
+/// values does not exceed 1/64 whatever the range of the latencies is.
+class LatencyHistogram {
+public:
+    /// @brief percentiles reported to the console and to the statistics report
+    static const std::vector<double> reported_percentiles;
+
+    void record(double latency_ms);
+
+    uint64_t count() const {
+        return _count;
+    }
+
+    double min() const {
+        return _min;
+    }
+
+    double max() const {
+        return _max;
+    }
+
+    /// @brief highest latency (ms) of the bucket the percentile falls into, limited by the recorded maximum
+    double get_percentile(double percentile) const;
+
+    /// @brief count, min, max, reported percentiles and the non-empty buckets as [lower_ms, upper_ms, count]
+    nlohmann::json to_json() const;
+
+    void write_to_slog() const;
+
+    static std::string get_percentile_name(double percentile);
+
+private:
+    static size_t get_bucket_index(uint64_t value_us);
+    static uint64_t get_bucket_lower_bound(size_t index);
+    static uint64_t get_bucket_upper_bound(size_t index);
+
+    std::vector<uint64_t> _buckets;
+    uint64_t _count = 0;
+    double _min = 0;
+    double _max = 0;
+};
@@ -0,0 +1,131 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// clang-format off
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "samples/common.hpp"
+#include "samples/slog.hpp"
+
+#include "load_generator.hpp"
+#include "utils.hpp"
+// clang-format on
+
+namespace {
+// fixed seed keeps the arrivals of the runs reproducible
+constexpr uint64_t arrivals_seed = 42;
+// the offered load is considered sustained while the achieved rate is not lower than this share of it
+constexpr double sustained_load_share = 0.95;
+}  // namespace
+
+ArrivalGenerator::ArrivalGenerator(double qps) : _rate(qps), _engine(arrivals_seed), _interval(qps / 1000.0) {
+    if (qps <= 0) {
+        throw std::logic_error("The offered load should be positive.");
+    }
+}
+
+ArrivalGenerator::ArrivalGenerator(std::vector<double> trace, double qps)
+    : _rate(qps),
+      _engine(arrivals_seed),
+      _trace(std::move(trace)) {
+    if (_trace.size() < 2) {
+        throw std::logic_error("The arrival trace should contain at least two arrivals.");
+    }
+    if (!std::is_sorted(_trace.begin(), _trace.end())) {
+        throw std::logic_error("The arrival times of the trace should be in non-decreasing order.");
+    }
+    const auto front = _trace.front();
+    for (auto& time : _trace) {
+        time -= front;
+    }
+    // the trace is repeated after the mean interval between its arrivals
+    const auto duration = _trace.back();
+    if (duration <= 0) {
+        throw std::logic_error("The arrival trace should have non-zero duration.");
+    }
+    _tracePeriod = duration + duration / (_trace.size() - 1);
+    const auto traceRate = 1000.0 * _trace.size() / _tracePeriod;
+    if (_rate > 0) {
+        _traceScale = traceRate / _rate;
+    } else {
+        _rate = traceRate;
+    }
+}
+
+std::chrono::nanoseconds ArrivalGenerator::next() {
+    if (_trace.empty()) {
+        _time += _interval(_engine);
+    } else {
+        _time = (_traceLoop * _tracePeriod + _trace[_traceId]) * _traceScale;
+        if (++_traceId == _trace.size()) {
+            _traceId = 0;
+            ++_traceLoop;
+        }
+    }
+    return std::chrono::nanoseconds(static_cast<int64_t>(_time * 1.0e6));
+}
+
+std::vector<double> read_arrival_trace(const std::string& path) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        throw std::logic_error("Can't open the arrival trace file: " + path);
+    }
+    std::stringstream content;
+    content << file.rdbuf();
+    auto text = content.str();
+    std::replace(text.begin(), text.end(), ',', ' ');
+
+    std::vector<double> trace;
+    std::istringstream values(text);
+    std::string value;
+    while (values >> value) {
+        try {
+            trace.push_back(std::stod(value));
+        } catch (const std::exception&) {
+            throw std::logic_error("Can't parse the arrival time '" + value + "' of the trace " + path);
+        }
+    }
+    return trace;
+}
+
+std::vector<double> parse_qps_sweep(const std::string& sweep) {
+    const auto values = split(sweep, ':');
+    if (values.size() != 3) {
+        throw std::logic_error("The load sweep should be set in <start>:<stop>:<step> format.");
+    }
+    double start = 0, stop = 0, step = 0;
+    try {
+        start = std::stod(values[0]);
+        stop = std::stod(values[1]);
+        step = std::stod(values[2]);
+    } catch (const std::exception&) {
+        throw std::logic_error("Can't parse the load sweep: " + sweep);
+    }
+    if (start <= 0 || stop < start || step <= 0) {
+        throw std::logic_error("The load sweep should have positive start and step and the stop not less than start.");
+    }
+    std::vector<double> loads;
+    // the tolerance keeps the stop value despite the rounding of the steps
+    for (double qps = start; qps <= stop + step * 1e-6; qps += step) {
+        loads.push_back(qps);
+    }
+    return loads;
+}
+
+bool LoadCurvePoint::is_saturated() const {
+    return achieved_qps < sustained_load_share * offered_qps;
+}
+
+void LoadCurvePoint::write_to_slog() const {
+    slog::info << "Offered: " << double_to_string(offered_qps) << " QPS, achieved: " << double_to_string(achieved_qps)
+               << " QPS, median latency: " << double_to_string(latency_median)
+               << " ms, p99 latency: " << double_to_string(latency_p99) << " ms"
+               << (is_saturated() ? ", saturated" : "") << slog::endl;
+}
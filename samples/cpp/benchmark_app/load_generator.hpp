@@ -0,0 +1,63 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+/// @brief Generates the arrival times of the requests of the open-loop load: either Poisson arrivals at the given
+/// rate or the replay of the recorded trace, optionally rescaled to the given rate
+class ArrivalGenerator {
+public:
+    /// @param qps average number of arrivals per second
+    explicit ArrivalGenerator(double qps);
+
+    /// @param trace arrival times in milliseconds in non-decreasing order, replayed in a loop
+    /// @param qps average number of arrivals per second, 0 keeps the rate of the trace
+    ArrivalGenerator(std::vector<double> trace, double qps);
+
+    /// @brief offset of the next arrival from the start of the measurement
+    std::chrono::nanoseconds next();
+
+    /// @brief average number of arrivals per second
+    double get_rate() const {
+        return _rate;
+    }
+
+private:
+    double _rate;
+    // offset of the previous arrival in milliseconds
+    double _time = 0;
+    std::mt19937_64 _engine;
+    std::exponential_distribution<double> _interval;
+    std::vector<double> _trace;
+    double _traceScale = 1;
+    double _tracePeriod = 0;
+    size_t _traceId = 0;
+    size_t _traceLoop = 0;
+};
+
+/// @brief reads the arrival times in milliseconds separated by whitespaces, commas or new lines
+std::vector<double> read_arrival_trace(const std::string& path);
+
+/// @brief parses the sweep of the offered load in "<start>:<stop>:<step>" format
+std::vector<double> parse_qps_sweep(const std::string& sweep);
+
+/// @brief one point of the throughput-latency curve of the open-loop load
+struct LoadCurvePoint {
+    double offered_qps = 0;
+    double achieved_qps = 0;
+    double latency_median = 0;
+    double latency_p99 = 0;
+    uint64_t iterations = 0;
+
+    /// @brief the device does not keep up with the offered load
+    bool is_saturated() const;
+
+    void write_to_slog() const;
+};
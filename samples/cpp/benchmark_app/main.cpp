@@ -32,7 +32,9 @@
 #include "benchmark_app.hpp"
 #include "infer_request_wrap.hpp"
 #include "inputs_filling.hpp"
+#include "load_generator.hpp"
 #include "remote_tensors_filling.hpp"
+#include "shape_trace.hpp"
 #include "statistics_report.hpp"
 #include "utils.hpp"
 
@@ -120,6 +122,18 @@ int64_t get_peak_memory_usage() {
 
 #endif
 
+bool is_open_loop() {
+    return FLAGS_qps > 0 || !FLAGS_arrival_trace.empty() || !FLAGS_qps_sweep.empty();
+}
+
+/// @brief arrival rates of the open-loop runs, the closed-loop mode and the trace without -qps run once with 0 rate
+std::vector<double> get_offered_loads() {
+    if (!FLAGS_qps_sweep.empty()) {
+        return parse_qps_sweep(FLAGS_qps_sweep);
+    }
+    return {FLAGS_qps};
+}
+
 bool parse_and_check_command_line(int argc, char* argv[]) {
     // ---------------------------Parsing and validating input
     // arguments--------------------------------------
@@ -174,6 +188,23 @@ bool parse_and_check_command_line(int argc, char* argv[]) {
         throw std::logic_error("only " + std::string(detailedCntReport) + " report type is supported for MULTI device");
     }
 
+    if (FLAGS_latency_series && FLAGS_report_type.empty()) {
+        throw std::logic_error("-latency_series option should be used together with -report_type option.");
+    }
+
+    if (FLAGS_qps < 0) {
+        throw std::logic_error("The -qps option value should be positive.");
+    }
+    if (FLAGS_qps > 0 && !FLAGS_qps_sweep.empty()) {
+        throw std::logic_error("-qps and -qps_sweep options can't be used together.");
+    }
+    if (is_open_loop() && FLAGS_max_irate > 0) {
+        throw std::logic_error("-max_irate option can't be used with the open-loop load.");
+    }
+    if (!FLAGS_shape_trace.empty() && !FLAGS_data_shape.empty()) {
+        throw std::logic_error("-shape_trace and -data_shape options can't be used together.");
+    }
+
     if (!FLAGS_pcsort.empty() && FLAGS_pcsort != "sort" && FLAGS_pcsort != "no_sort" && FLAGS_pcsort != "simple_sort") {
         std::string pcsort_err = std::string("Incorrect performance count sort . Please set -pcsort option to ") +
                                  std::string("'sort', 'no_sort', 'simple_sort'.");
@@ -393,6 +424,15 @@ int main(int argc, char* argv[]) {
         /** This vector stores paths to the processed images with input names**/
         auto inputFiles = parse_input_arguments(gflags::GetArgvs());
 
+        // the unique data shapes of the trace are benchmarked as the -data_shape groups
+        std::unique_ptr<ShapeTrace> shapeTrace;
+        if (!FLAGS_shape_trace.empty()) {
+            shapeTrace.reset(new ShapeTrace(FLAGS_shape_trace));
+            FLAGS_data_shape = shapeTrace->get_data_shapes();
+            slog::info << "Shape trace: " << shapeTrace->size() << " iterations, data shapes: " << FLAGS_data_shape
+                       << slog::endl;
+        }
+
         // ----------------- 2. Loading the OpenVINO Runtime
         // -----------------------------------------------------------
         next_step();
@@ -936,6 +976,8 @@ int main(int argc, char* argv[]) {
                     "Dynamic models with different input data shapes must be benchmarked only in full mode.");
             }
             inferenceOnly = isFlagSetInCommandLine("inference_only") && inferenceOnly && app_inputs_info.size() == 1;
+        } else if (shapeTrace) {
+            throw std::logic_error("-shape_trace option can be used for the models with dynamic shapes only.");
         }
 
         // ----------------- 8. Querying optimal runtime parameters
@@ -1050,7 +1092,13 @@ int main(int argc, char* argv[]) {
         // ----------------------------------------
         next_step();
 
-        InferRequestsQueue inferRequestsQueue(compiledModel, nireq, app_inputs_info.size(), FLAGS_pcseq);
+        InferRequestsQueue inferRequestsQueue(compiledModel,
+                                              nireq,
+                                              app_inputs_info.size(),
+                                              FLAGS_pcseq || shapeTrace != nullptr);
+        if (FLAGS_latency_series) {
+            inferRequestsQueue.enable_iterations_collecting();
+        }
 
         bool inputHasName = false;
         if (inputFiles.size() > 0) {
@@ -1230,64 +1278,190 @@ int main(int argc, char* argv[]) {
         size_t processedFramesN = 0;
         auto startTime = Time::now();
         auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
-
-        /** Start inference & calculate performance **/
-        /** to align number if iterations to guarantee that last infer requests are
-         * executed in the same conditions **/
-        while ((niter != 0LL && iteration < niter) ||
-               (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
-            inferRequest = inferRequestsQueue.get_idle_request();
-            if (!inferRequest) {
-                OPENVINO_THROW("No idle Infer Requests!");
+        auto warmupEndTime = startTime;
+
+        // histograms of the real time of the executed layers, in the order of the first appearance
+        std::vector<std::pair<std::string, LatencyHistogram>> layerHistograms;
+        std::map<std::string, size_t> layerHistogramIds;
+        auto collect_layer_latencies = [&](const InferReqWrap::Ptr& request) {
+            // the performance counters of the warm-up inference and of the warm-up window are skipped
+            if (!FLAGS_latency_histograms || !perf_counts || request->get_start_time() < warmupEndTime) {
+                return;
             }
+            for (const auto& layer : request->get_performance_counts()) {
+                if (layer.status != ov::ProfilingInfo::Status::EXECUTED) {
+                    continue;
+                }
+                auto id = layerHistogramIds.find(layer.node_name);
+                if (id == layerHistogramIds.end()) {
+                    id = layerHistogramIds.emplace(layer.node_name, layerHistograms.size()).first;
+                    layerHistograms.emplace_back(layer.node_name, LatencyHistogram{});
+                }
+                layerHistograms[id->second].second.record(layer.real_time.count() / 1000.0);
+            }
+        };
 
-            if (!inferenceOnly) {
-                auto inputs = app_inputs_info[iteration % app_inputs_info.size()];
+        // the data shape group of the iteration is either replayed from the shape trace or cycled through -data_shape
+        const auto get_group_id = [&](size_t iteration) {
+            return shapeTrace ? shapeTrace->get_shape_id(iteration) : iteration % app_inputs_info.size();
+        };
+        // the tensor number N of an input has the data shape group N % (number of the groups)
+        const auto get_tensor_id = [&](size_t iteration, size_t groupId, const std::string& inputName) {
+            const auto tensorsNum = inputsData.at(inputName).size();
+            if (!shapeTrace) {
+                return iteration % tensorsNum;
+            }
+            return groupId + app_inputs_info.size() * (iteration % (tensorsNum / app_inputs_info.size()));
+        };
+        if (shapeTrace) {
+            if (shapeTrace->get_shape_counts().size() != app_inputs_info.size()) {
+                throw std::logic_error("The shape trace has " + std::to_string(shapeTrace->get_shape_counts().size()) +
+                                       " data shapes, but " + std::to_string(app_inputs_info.size()) +
+                                       " data shapes are set for the inputs.");
+            }
+            for (const auto& input : inputsData) {
+                if (input.second.size() < app_inputs_info.size()) {
+                    throw std::logic_error("The input " + input.first + " has " +
+                                           std::to_string(input.second.size()) +
+                                           " tensors, at least one tensor per data shape of the shape trace (" +
+                                           std::to_string(app_inputs_info.size()) + ") is required.");
+                }
+            }
+        }
 
-                if (FLAGS_pcseq) {
-                    inferRequest->set_latency_group_id(iteration % app_inputs_info.size());
+        // the closed-loop mode runs once, the open-loop mode runs once for every offered load of the sweep,
+        // the results of the last run are reported
+        const auto offeredLoads = get_offered_loads();
+        const auto arrivalTrace = FLAGS_arrival_trace.empty() ? std::vector<double>{}
+                                                              : read_arrival_trace(FLAGS_arrival_trace);
+        std::vector<LoadCurvePoint> loadCurve;
+        LatencyHistogram latencyHistogram;
+        // lookups of the runtime caches of the last run, the shape changes of the dynamic models miss the caches
+        RuntimeCacheStatistics runtimeCacheStats;
+        bool hasRuntimeCacheStats = false;
+        for (size_t loadId = 0; loadId < offeredLoads.size(); ++loadId) {
+            std::unique_ptr<ArrivalGenerator> arrivals;
+            if (is_open_loop()) {
+                arrivals = arrivalTrace.empty()
+                               ? std::unique_ptr<ArrivalGenerator>(new ArrivalGenerator(offeredLoads[loadId]))
+                               : std::unique_ptr<ArrivalGenerator>(
+                                     new ArrivalGenerator(arrivalTrace, offeredLoads[loadId]));
+                slog::info << "Open-loop load: " << double_to_string(arrivals->get_rate()) << " QPS offered"
+                           << slog::endl;
+            }
+            if (loadId != 0) {
+                inferRequestsQueue.reset_times();
+                layerHistograms.clear();
+                layerHistogramIds.clear();
+                iteration = 0;
+                processedFramesN = 0;
+            }
+            startTime = Time::now();
+            execTime = 0;
+            warmupEndTime = startTime + std::chrono::milliseconds(FLAGS_warmup_window);
+            if (FLAGS_warmup_window != 0) {
+                inferRequestsQueue.set_warmup_end_time(warmupEndTime);
+            }
+            RuntimeCacheStatistics startCacheStats;
+            hasRuntimeCacheStats =
+                isDynamicNetwork && RuntimeCacheStatistics::read(compiledModel, device_name, startCacheStats);
+
+            /** Start inference & calculate performance **/
+            /** to align number if iterations to guarantee that last infer requests are
+             * executed in the same conditions **/
+            while ((niter != 0LL && iteration < niter) ||
+                   (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
+                   (FLAGS_api == "async" && iteration % nireq != 0)) {
+                // in the open-loop mode the request waits for an idle infer request after its arrival,
+                // so its latency includes the queueing time
+                Time::time_point arrivalTime;
+                if (arrivals) {
+                    arrivalTime = startTime + arrivals->next();
+                    std::this_thread::sleep_until(arrivalTime);
+                }
+                inferRequest = inferRequestsQueue.get_idle_request();
+                if (!inferRequest) {
+                    OPENVINO_THROW("No idle Infer Requests!");
                 }
+                // the counters of the previous inference of the request are overwritten by the next one
+                collect_layer_latencies(inferRequest);
+
+                if (!inferenceOnly) {
+                    const auto groupId = get_group_id(iteration);
+                    auto inputs = app_inputs_info[groupId];
 
-                if (isDynamicNetwork) {
-                    batchSize = get_batch_size(inputs);
+                    if (FLAGS_pcseq || shapeTrace) {
+                        inferRequest->set_latency_group_id(groupId);
+                    }
+
+                    if (isDynamicNetwork) {
+                        batchSize = get_batch_size(inputs);
+                    }
+
+                    for (auto& item : inputs) {
+                        auto inputName = item.first;
+                        const auto& data = inputsData.at(inputName)[get_tensor_id(iteration, groupId, inputName)];
+                        inferRequest->set_tensor(inputName, data);
+                    }
+
+                    if (useGpuMem) {
+                        auto outputTensors =
+                            ::gpu::get_remote_output_tensors(compiledModel, inferRequest->get_output_cl_buffer());
+                        for (auto& output : compiledModel.outputs()) {
+                            inferRequest->set_tensor(output.get_any_name(), outputTensors[output.get_any_name()]);
+                        }
+                    }
                 }
 
-                for (auto& item : inputs) {
-                    auto inputName = item.first;
-                    const auto& data = inputsData.at(inputName)[iteration % inputsData.at(inputName).size()];
-                    inferRequest->set_tensor(inputName, data);
+                const auto requestStartTime = arrivals ? arrivalTime : Time::now();
+                if (FLAGS_api == "sync") {
+                    inferRequest->infer(requestStartTime);
+                } else {
+                    inferRequest->start_async(requestStartTime);
                 }
+                ++iteration;
 
-                if (useGpuMem) {
-                    auto outputTensors =
-                        ::gpu::get_remote_output_tensors(compiledModel, inferRequest->get_output_cl_buffer());
-                    for (auto& output : compiledModel.outputs()) {
-                        inferRequest->set_tensor(output.get_any_name(), outputTensors[output.get_any_name()]);
-                    }
+                execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+                processedFramesN += batchSize;
+
+                if (FLAGS_max_irate > 0) {
+                    auto nextRunFinishTime = 1 / FLAGS_max_irate * processedFramesN * 1.0e9;
+                    std::this_thread::sleep_for(
+                        std::chrono::nanoseconds(static_cast<int64_t>(nextRunFinishTime - execTime)));
                 }
             }
 
-            if (FLAGS_api == "sync") {
-                inferRequest->infer();
-            } else {
-                inferRequest->start_async();
+            // wait the latest inference executions
+            inferRequestsQueue.wait_all();
+            for (auto& request : inferRequestsQueue.requests) {
+                collect_layer_latencies(request);
+            }
+            if (hasRuntimeCacheStats) {
+                hasRuntimeCacheStats = RuntimeCacheStatistics::read(compiledModel, device_name, runtimeCacheStats);
+                runtimeCacheStats = runtimeCacheStats - startCacheStats;
             }
-            ++iteration;
 
-            execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
-            processedFramesN += batchSize;
+            if (inferRequestsQueue.get_latencies().empty()) {
+                throw std::logic_error("All iterations were started within the warm-up window. Please increase -t or "
+                                       "-niter option value or decrease -warmup_window option value.");
+            }
+            latencyHistogram = LatencyHistogram{};
+            for (const auto& latency : inferRequestsQueue.get_latencies()) {
+                latencyHistogram.record(latency);
+            }
 
-            if (FLAGS_max_irate > 0) {
-                auto nextRunFinishTime = 1 / FLAGS_max_irate * processedFramesN * 1.0e9;
-                std::this_thread::sleep_for(
-                    std::chrono::nanoseconds(static_cast<int64_t>(nextRunFinishTime - execTime)));
+            if (arrivals) {
+                LoadCurvePoint point;
+                point.offered_qps = arrivals->get_rate();
+                point.achieved_qps = 1000.0 * iteration / inferRequestsQueue.get_duration_in_milliseconds();
+                point.latency_median = latencyHistogram.get_percentile(50.0);
+                point.latency_p99 = latencyHistogram.get_percentile(99.0);
+                point.iterations = iteration;
+                point.write_to_slog();
+                loadCurve.push_back(point);
             }
         }
 
-        // wait the latest inference executions
-        inferRequestsQueue.wait_all();
-
         LatencyMetrics generalLatency(inferRequestsQueue.get_latencies(), "", FLAGS_latency_percentile);
         std::vector<LatencyMetrics> groupLatencies = {};
         if (FLAGS_pcseq && app_inputs_info.size() > 1) {
@@ -1306,6 +1480,24 @@ int main(int argc, char* argv[]) {
             }
         }
 
+        std::vector<ShapeBucket> shapeBuckets;
+        if (shapeTrace) {
+            const auto& lat_groups = inferRequestsQueue.get_latency_groups();
+            const auto shapeCounts = shapeTrace->get_shape_counts();
+            for (size_t i = 0; i < app_inputs_info.size(); i++) {
+                ShapeBucket bucket;
+                for (auto& item : app_inputs_info[i]) {
+                    bucket.data_shape += (bucket.data_shape.empty() ? "" : ",") + item.first +
+                                         item.second.dataShape.to_string();
+                }
+                bucket.trace_share = 100.0 * shapeCounts[i] / shapeTrace->size();
+                for (const auto& latency : lat_groups[i]) {
+                    bucket.latency.record(latency);
+                }
+                shapeBuckets.push_back(bucket);
+            }
+        }
+
         double totalDuration = inferRequestsQueue.get_duration_in_milliseconds();
         double fps = 1000.0 * processedFramesN / totalDuration;
 
@@ -1328,6 +1520,16 @@ int main(int argc, char* argv[]) {
                      StatisticsVariant("Min latency (ms)", "latency_min", generalLatency.min),
                      StatisticsVariant("Max latency (ms)", "latency_max", generalLatency.max)});
 
+                if (FLAGS_latency_histograms) {
+                    for (const auto& percentile : LatencyHistogram::reported_percentiles) {
+                        const auto name = LatencyHistogram::get_percentile_name(percentile);
+                        statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                                   {StatisticsVariant("Latency " + name + " (ms)",
+                                                                      "latency_" + name,
+                                                                      latencyHistogram.get_percentile(percentile))});
+                    }
+                }
+
                 if (FLAGS_pcseq && app_inputs_info.size() > 1) {
                     for (size_t i = 0; i < groupLatencies.size(); ++i) {
                         statistics->add_parameters(
@@ -1338,6 +1540,17 @@ int main(int argc, char* argv[]) {
             }
             statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                        {StatisticsVariant("throughput", "throughput", fps)});
+            if (!loadCurve.empty()) {
+                statistics->add_parameters(
+                    StatisticsReport::Category::EXECUTION_RESULTS,
+                    {StatisticsVariant("offered load (QPS)", "offered_qps", loadCurve.back().offered_qps)});
+            }
+            if (hasRuntimeCacheStats) {
+                statistics->add_parameters(
+                    StatisticsReport::Category::EXECUTION_RESULTS,
+                    {StatisticsVariant("runtime cache hits", "runtime_cache_hits", runtimeCacheStats.hits),
+                     StatisticsVariant("runtime cache misses", "runtime_cache_misses", runtimeCacheStats.misses)});
+            }
         }
         // ----------------- 11. Dumping statistics report
         // -------------------------------------------------------------
@@ -1379,8 +1592,21 @@ int main(int argc, char* argv[]) {
             }
         }
 
-        if (statistics)
+        if (statistics) {
             statistics->dump();
+            if (FLAGS_latency_histograms) {
+                statistics->dump_latency_histograms(latencyHistogram, layerHistograms);
+            }
+            if (FLAGS_latency_series) {
+                statistics->dump_latency_series(inferRequestsQueue.get_iterations());
+            }
+            if (loadCurve.size() > 1) {
+                statistics->dump_load_curve(loadCurve);
+            }
+            if (!shapeBuckets.empty()) {
+                statistics->dump_shape_buckets(shapeBuckets);
+            }
+        }
 
         // Performance metrics report
         try {
@@ -1395,6 +1621,9 @@ int main(int argc, char* argv[]) {
         if (device_name.find("MULTI") == std::string::npos) {
             slog::info << "Latency:" << slog::endl;
             generalLatency.write_to_slog();
+            if (FLAGS_latency_histograms) {
+                latencyHistogram.write_to_slog();
+            }
 
             if (FLAGS_pcseq && app_inputs_info.size() > 1) {
                 slog::info << "Latency for each data shape group:" << slog::endl;
@@ -1412,10 +1641,40 @@ int main(int argc, char* argv[]) {
                     groupLatencies[i].write_to_slog();
                 }
             }
+
+            if (!shapeBuckets.empty()) {
+                slog::info << "Latency for each data shape of the shape trace:" << slog::endl;
+                for (size_t i = 0; i < shapeBuckets.size(); ++i) {
+                    slog::info << (i + 1) << ".";
+                    shapeBuckets[i].write_to_slog();
+                }
+            }
+        }
+
+        if (hasRuntimeCacheStats) {
+            runtimeCacheStats.write_to_slog();
         }
 
         slog::info << "Throughput:          " << double_to_string(fps) << " FPS" << slog::endl;
 
+        if (loadCurve.size() > 1) {
+            slog::info << "Throughput-latency curve:" << slog::endl;
+            const LoadCurvePoint* saturationPoint = nullptr;
+            for (const auto& point : loadCurve) {
+                point.write_to_slog();
+                if (!point.is_saturated()) {
+                    saturationPoint = &point;
+                }
+            }
+            if (saturationPoint) {
+                slog::info << "Saturation point:    " << double_to_string(saturationPoint->offered_qps) << " QPS"
+                           << slog::endl;
+            } else {
+                slog::info << "Saturation point:    below " << double_to_string(loadCurve.front().offered_qps)
+                           << " QPS" << slog::endl;
+            }
+        }
+
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
 
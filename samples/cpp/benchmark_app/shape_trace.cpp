@@ -0,0 +1,214 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// clang-format off
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "samples/common.hpp"
+#include "samples/slog.hpp"
+
+#include "shape_trace.hpp"
+#include "utils.hpp"
+// clang-format on
+
+namespace {
+using DataShape = std::vector<std::pair<std::string, std::string>>;
+
+// "[1,128]" and "1,128" are applied to all the inputs, "input_ids[1,128],mask[1,128]" sets the shape of every input
+DataShape parse_data_shape(std::string data_shape) {
+    data_shape.erase(std::remove_if(data_shape.begin(),
+                                    data_shape.end(),
+                                    [](unsigned char c) {
+                                        return std::isspace(c);
+                                    }),
+                     data_shape.end());
+    if (data_shape.empty()) {
+        throw std::logic_error("The data shape of the shape trace is empty.");
+    }
+    if (data_shape.find('[') == std::string::npos) {
+        return {{"", data_shape}};
+    }
+
+    DataShape shapes;
+    std::string search_string = data_shape;
+    while (!search_string.empty()) {
+        const auto start_pos = search_string.find('[');
+        const auto end_pos = search_string.find(']');
+        if (start_pos == std::string::npos || end_pos == std::string::npos || end_pos < start_pos) {
+            throw std::logic_error("Can't parse the data shape of the shape trace: " + data_shape);
+        }
+        shapes.emplace_back(search_string.substr(0, start_pos),
+                            search_string.substr(start_pos + 1, end_pos - start_pos - 1));
+        search_string = search_string.substr(end_pos + 1);
+        if (!search_string.empty() && search_string.front() == ',') {
+            search_string = search_string.substr(1);
+        }
+    }
+    std::sort(shapes.begin(), shapes.end());
+    for (size_t i = 1; i < shapes.size(); ++i) {
+        if (shapes[i].first.empty() || shapes[i].first == shapes[i - 1].first) {
+            throw std::logic_error("Every input should be set once in the data shape of the shape trace: " +
+                                   data_shape);
+        }
+    }
+    return shapes;
+}
+
+uint64_t parse_count(const std::string& count, const std::string& path) {
+    try {
+        size_t pos = 0;
+        const auto value = std::stoull(count, &pos);
+        if (pos == count.size() && value != 0) {
+            return value;
+        }
+    } catch (const std::exception&) {
+    }
+    throw std::logic_error("The number of repetitions '" + count + "' of the shape trace " + path +
+                           " should be a positive integer.");
+}
+}  // namespace
+
+ShapeTrace::ShapeTrace(const std::string& path) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        throw std::logic_error("Can't open the shape trace file: " + path);
+    }
+
+    if (get_extension(path) == "json") {
+        nlohmann::json trace;
+        try {
+            file >> trace;
+        } catch (const std::exception& e) {
+            throw std::logic_error("Can't parse the shape trace " + path + ": " + e.what());
+        }
+        if (!trace.is_array()) {
+            throw std::logic_error("The shape trace " + path + " should be a JSON array.");
+        }
+        for (const auto& item : trace) {
+            if (item.is_string()) {
+                add(item.get<std::string>(), 1);
+            } else if (item.is_object() && item.contains("shape") && item.at("shape").is_string()) {
+                const auto count = item.contains("count") ? item.at("count").get<int64_t>() : 1;
+                if (count <= 0) {
+                    throw std::logic_error("The number of repetitions of the shape trace " + path +
+                                           " should be positive.");
+                }
+                add(item.at("shape").get<std::string>(), static_cast<uint64_t>(count));
+            } else {
+                throw std::logic_error("The items of the shape trace " + path +
+                                       " should be the data shapes or {\"shape\": ..., \"count\": ...} objects.");
+            }
+        }
+    } else {
+        std::string line;
+        while (std::getline(file, line)) {
+            line.erase(std::remove(line.begin(), line.end(), '\r'), line.end());
+            if (line.find_first_not_of(" \t") == std::string::npos || line[line.find_first_not_of(" \t")] == '#') {
+                continue;
+            }
+            const auto separator = line.find(';');
+            if (separator == std::string::npos) {
+                add(line, 1);
+            } else {
+                auto count = line.substr(separator + 1);
+                count.erase(std::remove_if(count.begin(),
+                                           count.end(),
+                                           [](unsigned char c) {
+                                               return std::isspace(c);
+                                           }),
+                            count.end());
+                add(line.substr(0, separator), parse_count(count, path));
+            }
+        }
+    }
+
+    if (_sequence.empty()) {
+        throw std::logic_error("The shape trace " + path + " is empty.");
+    }
+}
+
+void ShapeTrace::add(const std::string& data_shape, uint64_t count) {
+    auto shape = parse_data_shape(data_shape);
+    if (!_shapes.empty()) {
+        const auto& first = _shapes.front();
+        const bool same_inputs = std::equal(first.begin(),
+                                            first.end(),
+                                            shape.begin(),
+                                            shape.end(),
+                                            [](const DataShape::value_type& a, const DataShape::value_type& b) {
+                                                return a.first == b.first;
+                                            });
+        if (!same_inputs) {
+            throw std::logic_error("All the data shapes of the shape trace should set the same inputs: " +
+                                   data_shape);
+        }
+    }
+    auto id = _shapeIds.find(shape);
+    if (id == _shapeIds.end()) {
+        id = _shapeIds.emplace(shape, _shapes.size()).first;
+        _shapes.push_back(std::move(shape));
+    }
+    _sequence.insert(_sequence.end(), count, id->second);
+}
+
+std::string ShapeTrace::get_data_shapes() const {
+    std::string data_shapes;
+    for (size_t input = 0; input < _shapes.front().size(); ++input) {
+        if (!data_shapes.empty()) {
+            data_shapes += ",";
+        }
+        data_shapes += _shapes.front()[input].first;
+        for (const auto& shape : _shapes) {
+            data_shapes += "[" + shape[input].second + "]";
+        }
+    }
+    return data_shapes;
+}
+
+std::vector<uint64_t> ShapeTrace::get_shape_counts() const {
+    std::vector<uint64_t> counts(_shapes.size(), 0);
+    for (const auto& id : _sequence) {
+        ++counts[id];
+    }
+    return counts;
+}
+
+void ShapeBucket::write_to_slog() const {
+    slog::info << " " << data_shape << ": " << latency.count() << " iterations, "
+               << double_to_string(trace_share) << "% of the trace" << slog::endl;
+    if (latency.count() != 0) {
+        latency.write_to_slog();
+    }
+}
+
+bool RuntimeCacheStatistics::read(const ov::CompiledModel& model,
+                                  const std::string& device_name,
+                                  RuntimeCacheStatistics& stats) {
+    // the counters are reported by the CPU plugin only, the other devices are not queried
+    if (device_name != "CPU") {
+        return false;
+    }
+    // the property is internal to the plugin, so the plugin of an older version may not report it
+    try {
+        const auto counters =
+            model.get_property("CPU_RUNTIME_CACHE_STATISTICS").as<std::map<std::string, uint64_t>>();
+        stats.hits = counters.at("hits");
+        stats.misses = counters.at("misses");
+        return true;
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+void RuntimeCacheStatistics::write_to_slog() const {
+    slog::info << "Runtime cache:       " << hits << " hits, " << misses << " misses ("
+               << double_to_string(get_hit_rate()) << "% hit rate)" << slog::endl;
+}
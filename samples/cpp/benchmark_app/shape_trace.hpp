@@ -0,0 +1,80 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "openvino/openvino.hpp"
+
+#include "latency_histogram.hpp"
+
+/// @brief Recorded sequence of the data shapes of the model inputs, e.g. the sequence lengths of the production
+/// traffic. The unique shapes are benchmarked as the -data_shape groups in the order of the first appearance and the
+/// iterations replay the sequence in a loop.
+class ShapeTrace {
+public:
+    /// @param path JSON array of the data shapes or of {"shape": <data shape>, "count": <repetitions>} objects, or
+    /// a text file with a data shape per line optionally followed by ';' and the number of its repetitions. A data
+    /// shape is set in -data_shape format for a single group, e.g. "[1,128]" or "input_ids[1,128],mask[1,128]".
+    explicit ShapeTrace(const std::string& path);
+
+    /// @brief unique data shapes in -data_shape format, e.g. "input_ids[1,128][1,384],mask[1,128][1,384]"
+    std::string get_data_shapes() const;
+
+    /// @brief index of the unique data shape of the iteration
+    size_t get_shape_id(size_t iteration) const {
+        return _sequence[iteration % _sequence.size()];
+    }
+
+    /// @brief number of the occurrences of every unique data shape in the trace
+    std::vector<uint64_t> get_shape_counts() const;
+
+    size_t size() const {
+        return _sequence.size();
+    }
+
+private:
+    void add(const std::string& data_shape, uint64_t count);
+
+    // unique data shapes, every one is a list of (input name, shape) pairs
+    std::vector<std::vector<std::pair<std::string, std::string>>> _shapes;
+    std::map<std::vector<std::pair<std::string, std::string>>, size_t> _shapeIds;
+    std::vector<size_t> _sequence;
+};
+
+/// @brief latencies of the iterations of one data shape of the replayed trace
+struct ShapeBucket {
+    std::string data_shape;
+    // share of the data shape in the trace
+    double trace_share = 0;
+    LatencyHistogram latency;
+
+    void write_to_slog() const;
+};
+
+/// @brief lookups of the runtime caches (e.g. the executors of the dynamic shapes) made during the run
+struct RuntimeCacheStatistics {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+
+    /// @brief reads the cumulative counters of the compiled model from the "CPU_RUNTIME_CACHE_STATISTICS" read-only
+    /// property of the CPU plugin (a map with the "hits" and "misses" counters), the models compiled for the other
+    /// devices have no statistics
+    static bool read(const ov::CompiledModel& model, const std::string& device_name, RuntimeCacheStatistics& stats);
+
+    RuntimeCacheStatistics operator-(const RuntimeCacheStatistics& rhs) const {
+        return {hits - rhs.hits, misses - rhs.misses};
+    }
+
+    double get_hit_rate() const {
+        return hits + misses == 0 ? 0.0 : 100.0 * hits / (hits + misses);
+    }
+
+    void write_to_slog() const;
+};
@@ -190,6 +190,83 @@ void StatisticsReport::dump_performance_counters(const std::vector<PerformanceCo
     slog::info << "Performance counters report is stored to " << dumper.getFilename() << slog::endl;
 }
 
+void StatisticsReport::dump_latency_histograms(
+    const LatencyHistogram& latencyHistogram,
+    const std::vector<std::pair<std::string, LatencyHistogram>>& layerHistograms) {
+    nlohmann::json js;
+    std::string name = _config.report_folder + _separator + "benchmark_latency_histograms.json";
+
+    js["latency"] = latencyHistogram.to_json();
+    js["nodes"] = nlohmann::json::array();
+    for (const auto& layer : layerHistograms) {
+        auto item = layer.second.to_json();
+        item["name"] = layer.first;
+        js["nodes"].push_back(item);
+    }
+
+    std::ofstream out_stream(name);
+    out_stream << std::setw(4) << js << std::endl;
+    slog::info << "Latency histograms are stored to " << name << slog::endl;
+}
+
+void StatisticsReport::dump_latency_series(const std::vector<IterationStatistics>& iterations) {
+    nlohmann::json js;
+    std::string name = _config.report_folder + _separator + "benchmark_latency_series.json";
+
+    js["iterations"] = nlohmann::json::array();
+    for (const auto& iteration : iterations) {
+        nlohmann::json item;
+        item["start_time"] = iteration.start_time;
+        item["latency"] = iteration.latency;
+        item["group_id"] = iteration.group_id;
+        item["warmup"] = iteration.warmup;
+        js["iterations"].push_back(item);
+    }
+
+    std::ofstream out_stream(name);
+    out_stream << std::setw(4) << js << std::endl;
+    slog::info << "Latency series is stored to " << name << slog::endl;
+}
+
+void StatisticsReport::dump_load_curve(const std::vector<LoadCurvePoint>& loadCurve) {
+    nlohmann::json js;
+    std::string name = _config.report_folder + _separator + "benchmark_load_curve.json";
+
+    js["points"] = nlohmann::json::array();
+    for (const auto& point : loadCurve) {
+        nlohmann::json item;
+        item["offered_qps"] = point.offered_qps;
+        item["achieved_qps"] = point.achieved_qps;
+        item["latency_median"] = point.latency_median;
+        item["latency_p99"] = point.latency_p99;
+        item["iterations_num"] = point.iterations;
+        item["saturated"] = point.is_saturated();
+        js["points"].push_back(item);
+    }
+
+    std::ofstream out_stream(name);
+    out_stream << std::setw(4) << js << std::endl;
+    slog::info << "Throughput-latency curve is stored to " << name << slog::endl;
+}
+
+void StatisticsReport::dump_shape_buckets(const std::vector<ShapeBucket>& shapeBuckets) {
+    nlohmann::json js;
+    std::string name = _config.report_folder + _separator + "benchmark_shape_trace.json";
+
+    js["shapes"] = nlohmann::json::array();
+    for (const auto& bucket : shapeBuckets) {
+        nlohmann::json item;
+        item["data_shape"] = bucket.data_shape;
+        item["trace_share"] = bucket.trace_share;
+        item["latency"] = bucket.latency.to_json();
+        js["shapes"].push_back(item);
+    }
+
+    std::ofstream out_stream(name);
+    out_stream << std::setw(4) << js << std::endl;
+    slog::info << "Latencies of the data shapes of the shape trace are stored to " << name << slog::endl;
+}
+
 void StatisticsReportJSON::dump_parameters(nlohmann::json& js, const StatisticsReport::Parameters& parameters) {
     for (auto& parameter : parameters) {
         parameter.write_to_json(js);
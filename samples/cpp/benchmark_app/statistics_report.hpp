@@ -21,6 +21,9 @@
 #include "samples/slog.hpp"
 #include "samples/latency_metrics.hpp"
 
+#include "latency_histogram.hpp"
+#include "load_generator.hpp"
+#include "shape_trace.hpp"
 #include "utils.hpp"
 // clang-format on
 
@@ -85,6 +88,15 @@ public:
     void write_to_json(nlohmann::json& js) const;
 };
 
+/// @brief start time (ms, relative to the start of the measurement) and latency of one iteration
+struct IterationStatistics {
+    double start_time;
+    double latency;
+    size_t group_id;
+    // the iteration was started within the warm-up window and is excluded from the latency statistics
+    bool warmup;
+};
+
 /// @brief Responsible for collecting of statistics and dumping to .csv file
 class StatisticsReport {
 public:
@@ -121,6 +133,21 @@ public:
 
     virtual void dump_performance_counters(const std::vector<PerformanceCounters>& perfCounts);
 
+    /// @brief Dumps the end-to-end latency histogram and the histograms of the real time of every layer to
+    /// benchmark_latency_histograms.json
+    void dump_latency_histograms(const LatencyHistogram& latencyHistogram,
+                                 const std::vector<std::pair<std::string, LatencyHistogram>>& layerHistograms);
+
+    /// @brief Dumps the start time and the latency of every iteration to benchmark_latency_series.json
+    void dump_latency_series(const std::vector<IterationStatistics>& iterations);
+
+    /// @brief Dumps the throughput-latency curve of the open-loop load sweep to benchmark_load_curve.json
+    void dump_load_curve(const std::vector<LoadCurvePoint>& loadCurve);
+
+    /// @brief Dumps the share in the trace and the latency histogram of every data shape of the replayed shape trace
+    /// to benchmark_shape_trace.json
+    void dump_shape_buckets(const std::vector<ShapeBucket>& shapeBuckets);
+
 private:
     void dump_performance_counters_request(CsvDumper& dumper, const PerformanceCounters& perfCounts);
     void dump_sort_performance_counters_request(CsvDumper& dumper, const PerformanceCounters& perfCounts);
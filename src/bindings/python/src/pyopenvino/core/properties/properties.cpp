@@ -325,12 +325,14 @@ void regmodule_properties(py::module m) {
     py::enum_<ov::intel_auto::SchedulePolicy>(m_intel_auto, "SchedulePolicy", py::arithmetic())
         .value("ROUND_ROBIN", ov::intel_auto::SchedulePolicy::ROUND_ROBIN)
         .value("DEVICE_PRIORITY", ov::intel_auto::SchedulePolicy::DEVICE_PRIORITY)
+        .value("LOAD_AWARE", ov::intel_auto::SchedulePolicy::LOAD_AWARE)
         .value("DEFAULT", ov::intel_auto::SchedulePolicy::DEFAULT);
 
     wrap_property_RW(m_intel_auto, ov::intel_auto::device_bind_buffer, "device_bind_buffer");
     wrap_property_RW(m_intel_auto, ov::intel_auto::enable_startup_fallback, "enable_startup_fallback");
     wrap_property_RW(m_intel_auto, ov::intel_auto::enable_runtime_fallback, "enable_runtime_fallback");
     wrap_property_RW(m_intel_auto, ov::intel_auto::schedule_policy, "schedule_policy");
+    wrap_property_RO(m_intel_auto, ov::intel_auto::device_routing_statistics, "device_routing_statistics");
 
     // Submodule npu
     py::module m_intel_npu =
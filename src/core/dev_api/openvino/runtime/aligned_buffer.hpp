@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 
 #include "openvino/core/attribute_adapter.hpp"
@@ -53,6 +55,18 @@ public:
         return get_ptr<T>();
     }
 
+    /// \brief Returns the hash of the buffer content. The hash is computed in parallel chunks on the first call and
+    /// memoized for the memory the buffer points to, so the repeated hashing of the same weights (e.g. by the model
+    /// cache) does not read them again. This holds for a buffer not owning its memory (e.g. SharedBuffer over the
+    /// mapped IR weights) as well, since it keeps the owner of the memory alive.
+    /// \note The owner giving out the writable access to the content has to reset the memoized value with
+    /// reset_content_hash()
+    uint64_t get_content_hash() const;
+
+    void reset_content_hash() {
+        m_content_hash_data.store(nullptr, std::memory_order_release);
+    }
+
     AlignedBuffer(const AlignedBuffer&) = delete;
     AlignedBuffer& operator=(const AlignedBuffer&) = delete;
 
@@ -60,6 +74,11 @@ protected:
     char* m_allocated_buffer;
     char* m_aligned_buffer;
     size_t m_byte_size;
+
+private:
+    mutable std::atomic<uint64_t> m_content_hash{0};
+    // the memory the memoized hash belongs to, null if there is no valid hash
+    mutable std::atomic<const void*> m_content_hash_data{nullptr};
 };
 
 template <>
@@ -0,0 +1,134 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <ostream>
+#include <type_traits>
+
+#include "openvino/core/model.hpp"
+#include "openvino/core/visibility.hpp"
+#include "openvino/xml_util/constant_writer.hpp"
+
+namespace ov::util::binary_topology {
+
+/*
+ * The binary topology is the compact alternative of the IR XML. The weights are stored in the same .bin file, the
+ * topology is stored in the little-endian byte order whatever the byte order of the host is:
+ *
+ * [ Header ]   magic, 32-bit format version, 64-bit IR version
+ * [ Model  ]   name, nodes, indices of the parameters, results and sinks, rt_info
+ *
+ * The nodes are stored in the topological order, so the reader creates them in a single pass. Every node is stored
+ * as its type, opset, friendly name, inputs (producer node index and output index), output tensor names, rt_info of
+ * the node and its ports and the list of the attributes. An attribute is stored as its name, type and the size of the
+ * value, so the reader decodes only the attributes visited by the operation and skips the others. The strings are
+ * stored as the 32-bit size followed by the characters, the vectors as the 32-bit number of the elements followed by
+ * the elements.
+ *
+ * Only IR v11 is stored, so the topology never has the legacy pre-processing section of IR v10.
+ */
+
+/// @brief file extension of the binary topology, the weights are stored in the .bin file as for IR XML
+inline constexpr const char* file_extension = ".ovbt";
+
+inline constexpr char magic[4] = {'O', 'V', 'B', 'T'};
+inline constexpr uint32_t format_version = 1;
+
+inline constexpr int64_t supported_ir_version = 11;
+
+struct Header {
+    char magic[4];
+    uint32_t format_version;
+    int64_t ir_version;
+};
+
+/// @brief size of the stored header, the fields are stored without padding
+inline constexpr size_t header_size =
+    sizeof(Header::magic) + sizeof(Header::format_version) + sizeof(Header::ir_version);
+
+/// @brief converts the value between the host and the little-endian byte order
+template <class T>
+T to_little_endian(T value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    constexpr uint16_t one = 1;
+    if (*reinterpret_cast<const uint8_t*>(&one) == 1) {
+        return value;
+    }
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    std::reverse(bytes, bytes + sizeof(T));
+    std::memcpy(&value, bytes, sizeof(T));
+    return value;
+}
+
+enum class AttributeType : uint8_t {
+    BOOL,
+    STRING,
+    INT64,
+    DOUBLE,
+    VECTOR_INT32,
+    VECTOR_INT64,
+    VECTOR_UINT64,
+    VECTOR_FLOAT,
+    VECTOR_STRING,
+    STRING_SET,
+    PARTIAL_SHAPE,
+    DIMENSION,
+    MODEL,
+    VARIABLE,
+    // offset and size of the constant data in the weights
+    CONSTANT_DATA,
+    INPUT_DESCRIPTIONS,
+    OUTPUT_DESCRIPTIONS,
+    SPECIAL_BODY_PORTS,
+};
+
+enum class RtInfoType : uint8_t {
+    STRING,
+    MAP,
+    RUNTIME_ATTRIBUTE,
+};
+
+enum class InputDescriptionType : uint8_t {
+    SLICE,
+    MERGED,
+    INVARIANT,
+};
+
+enum class OutputDescriptionType : uint8_t {
+    CONCAT,
+    BODY,
+};
+
+/// @brief checks whether the data starts with the header of the binary topology
+inline bool is_binary_topology(const char* data, size_t size) {
+    return data != nullptr && size >= header_size && std::memcmp(data, magic, sizeof(magic)) == 0;
+}
+
+/// @brief reads the header of the binary topology, the data must be checked with is_binary_topology() before
+inline Header read_header(const char* data) {
+    Header header;
+    std::memcpy(header.magic, data, sizeof(header.magic));
+    data += sizeof(header.magic);
+    std::memcpy(&header.format_version, data, sizeof(header.format_version));
+    data += sizeof(header.format_version);
+    std::memcpy(&header.ir_version, data, sizeof(header.ir_version));
+    header.format_version = to_little_endian(header.format_version);
+    header.ir_version = to_little_endian(header.ir_version);
+    return header;
+}
+
+/// @brief writes the topology of the model to the stream and its constants via the constant writer
+/// @param version IR version of the model, only IR v11 is supported
+OPENVINO_API void serialize(std::ostream& topology,
+                            ov::util::ConstantWriter& constant_writer,
+                            const std::shared_ptr<ov::Model>& model,
+                            int64_t version);
+
+}  // namespace ov::util::binary_topology
@@ -10,6 +10,7 @@
 #include "openvino/core/attribute_visitor.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/core/visibility.hpp"
+#include "openvino/runtime/aligned_buffer.hpp"
 
 namespace ov::util {
 
@@ -19,6 +20,9 @@ class OstreamHashWrapperBin final : public std::streambuf {
 public:
     uint64_t get_result() const;
     std::streamsize xsputn(const char* s, std::streamsize n) override;
+
+    /// @brief adds the hash of the written data, xsputn() only takes its size into account
+    void append_hash(uint64_t hash);
 };
 
 class OPENVINO_API ConstantWriter {
@@ -37,13 +41,26 @@ public:
                                ov::element::Type src_type = ov::element::dynamic,
                                bool ptr_is_temporary = false);
 
+    /// @brief Writes the content of the constant buffer. When the hash of the model is calculated, the memoized
+    /// content hash of the buffer is used instead of hashing the data on every call, the equal buffers share the
+    /// offset as in the written data.
+    FilePosition write(const ov::AlignedBuffer& buffer,
+                       size_t& new_size,
+                       bool compress_to_fp16 = false,
+                       ov::element::Type src_type = ov::element::dynamic,
+                       bool ptr_is_temporary = false);
+
 private:
+    void write_hash(uint64_t hash);
+
     static std::unique_ptr<char[]> compress_data_to_fp16(const char* ptr,
                                                          size_t size,
                                                          ov::element::Type src_type,
                                                          size_t& compressed_size);
 
     ConstWritePositions m_hash_to_file_positions;
+    // positions of the buffers written by their memoized content hash
+    std::multimap<uint64_t, std::pair<FilePosition, const ov::AlignedBuffer*>> m_content_hash_to_file_positions;
     std::reference_wrapper<std::ostream> m_binary_output;
     bool m_enable_compression;
     bool m_write_hash_value;
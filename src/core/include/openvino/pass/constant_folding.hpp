@@ -4,6 +4,9 @@
 
 #pragma once
 
+#include <chrono>
+#include <map>
+
 #include "openvino/core/runtime_attribute.hpp"
 #include "openvino/pass/pass.hpp"
 
@@ -13,19 +16,53 @@ namespace pass {
 /**
  * @brief Constant folding iterates over the function and tries to evaluate nodes
  *        with constant inputs. Such nodes are then replaced with new Constants containing
- *        the result of a folded operation.
+ *        the result of a folded operation. The nodes which depend only on constants are folded
+ *        in parallel before the sequential traversal of the function.
  * @ingroup ov_pass_cpp_api
  */
 class OPENVINO_API ConstantFolding : public ModelPass {
 public:
     OPENVINO_MODEL_PASS_RTTI("ConstantFolding");
+
+    /// \brief Number of constant_fold calls and time spent in them for one operation type.
+    struct FoldingStatistics {
+        size_t count = 0;
+        std::chrono::nanoseconds time{0};
+    };
+
+    /// \brief Default limit of the memory kept by the results of the parallel folding.
+    static constexpr size_t default_parallel_memory_limit = 512 * 1024 * 1024;
+
+    /// \param parallel_memory_limit  Maximum size in bytes of the values kept by the parallel folding: the values
+    ///                               being evaluated and the folded values which aren't consumed yet, 0 disables
+    ///                               the parallel folding. A node which doesn't fit the limit is folded alone.
+    explicit ConstantFolding(size_t parallel_memory_limit = default_parallel_memory_limit);
+
     bool run_on_model(const std::shared_ptr<ov::Model>& model) override;
 
+    /// \brief Returns the folding statistics per operation type of the last run of the pass, including the bodies
+    /// of the sub-graph operations.
+    const std::map<DiscreteTypeInfo, FoldingStatistics>& get_folding_statistics() const;
+
 protected:
     void copy_runtime_info_from_input_values(const std::shared_ptr<Node>& node);
     /// \brief Folds pre-calculated output tensor values to constants in case lower and
     /// upper estimations are equal. Traverses graph backwards starting from the results.
     bool pre_calculated_values_folding(const std::shared_ptr<ov::Model>& model);
+    /// \brief Folds the nodes which depend only on constants. The nodes whose inputs are already folded don't depend
+    /// on each other, so they are evaluated in parallel and replaced sequentially. The nodes which can't be evaluated
+    /// on their input constants are folded sequentially by their constant_fold.
+    /// \param validate  Revalidate the nodes before folding as the model was changed by the previous folding.
+    bool parallel_folding(const std::shared_ptr<ov::Model>& model, bool validate);
+    /// \brief Replaces the outputs of the node with the folded values.
+    bool replace_with_folded(const std::shared_ptr<Node>& node, const OutputVector& replacements);
+
+private:
+    bool fold_model(const std::shared_ptr<ov::Model>& model);
+    void update_folding_statistics(const Node& node, std::chrono::nanoseconds time);
+
+    size_t m_parallel_memory_limit;
+    std::map<DiscreteTypeInfo, FoldingStatistics> m_folding_statistics;
 };
 
 /**
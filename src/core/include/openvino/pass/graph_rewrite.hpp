@@ -30,13 +30,12 @@ namespace pass {
 /// Graph rewrite pass is used for matcher passes execution on Function.
 /// To register MatcherPass use \sa add_matcher<T>(args) method where T is a MatcherPass
 /// class.
-/// As a default algorithm graph rewrite pass traverse Function in topological order and
-/// applies
-/// registered matcher passes for each node. But if all registered matcher passes have type
-/// based
-/// root node in Matcher pattern then efficient mechanism is used to execute them.
-/// Matcher pattern root is type based if it's operation from opset or
-/// pattern::op::WrapType.
+/// Graph rewrite pass traverses Function in topological order and applies registered
+/// matcher passes for each node. Before the traversal the matcher passes are indexed by
+/// the types of the root node of their patterns, so each node is tested only against the
+/// matcher passes which can match it. Matcher pattern root is type based if it's operation
+/// from opset, pattern::op::WrapType or pattern::op::Or of type based patterns. Matcher
+/// passes with other roots are applied for every node.
 /// Note: when implementing pattern for Matcher make sure that root node is an operation
 /// from opset
 /// or has ov::pattern::op::WrapType. That will help GraphRewrite to execute matcher
@@ -123,6 +122,10 @@ public:
 
     std::shared_ptr<MatcherPass> add_matcher(const std::shared_ptr<MatcherPass>& pass);
 
+    const std::vector<std::shared_ptr<ov::pass::MatcherPass>>& get_matchers() const {
+        return m_matchers;
+    }
+
     bool run_on_model(const std::shared_ptr<ov::Model>& m) override;
 
     void set_pass_config(const std::shared_ptr<PassConfig>& pass_config) override;
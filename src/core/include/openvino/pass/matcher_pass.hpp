@@ -104,6 +104,24 @@ public:
         return m_matcher;
     }
 
+    /// \brief Pattern matching statistics of the MatcherPass
+    struct Statistics {
+        /// \brief Number of nodes the pass was applied to
+        size_t attempts = 0;
+        /// \brief Number of nodes matched by the pattern, not counted for the pass created with a custom handler
+        size_t matches = 0;
+        /// \brief Number of nodes transformed by the pass
+        size_t applied = 0;
+    };
+
+    const Statistics& get_statistics() const {
+        return m_statistics;
+    }
+
+    void reset_statistics() {
+        m_statistics = {};
+    }
+
 protected:
     void register_matcher(const std::shared_ptr<pattern::Matcher>& m,
                           const matcher_pass_callback& callback,
@@ -115,6 +133,7 @@ private:
     handler_callback m_handler;
     std::shared_ptr<pattern::Matcher> m_matcher;
     NodeRegistry m_new_nodes;
+    Statistics m_statistics;
 };
 }  // namespace pass
 }  // namespace ov
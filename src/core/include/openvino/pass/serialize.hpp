@@ -27,6 +27,8 @@ namespace ov::pass {
  * @brief Serialize transformation converts ov::Model into IR files
  * @attention
  * - dynamic shapes are not supported
+ * - the topology is written in the binary format instead of XML when the path has '.ovbt' extension, it's read by
+ *   ov::Core::read_model without XML parsing, only IR v11 is supported by the binary format
  * \ingroup ov_pass_cpp_api
  */
 class OPENVINO_API Serialize : public ov::pass::ModelPass {
@@ -436,7 +436,12 @@ const void* Constant::get_data_ptr() const {
 }
 
 void* Constant::get_data_ptr_nc() {
-    return (m_data ? m_data->get_ptr() : nullptr);
+    if (!m_data) {
+        return nullptr;
+    }
+    // the content may be modified through the returned pointer
+    m_data->reset_content_hash();
+    return m_data->get_ptr();
 }
 
 struct ValuesToString : ov::element::NotSupported<void> {
@@ -685,7 +690,10 @@ bool Constant::can_constant_fold(const OutputVector& input_values) const {
 }
 
 const Tensor Constant::get_tensor_view() const {
-    return get_data_ptr() ? Tensor{m_element_type, m_shape, m_data->get_ptr(), m_byte_strides} : Tensor{};
+    if (!get_data_ptr()) {
+        return Tensor{};
+    }
+    return Tensor{m_element_type, m_shape, m_data->get_ptr(), m_byte_strides};
 }
 
 const Strides& Constant::get_strides() const {
@@ -4,16 +4,26 @@
 
 #include "openvino/pass/constant_folding.hpp"
 
+#include <limits>
+#include <set>
+#include <unordered_map>
+
 #include "openvino/cc/pass/itt.hpp"
 #include "openvino/core/constant_fold_utils.hpp"
+#include "openvino/core/memory_util.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/rt_info.hpp"
 #include "openvino/core/rt_info/weightless_caching_attributes.hpp"
 #include "openvino/op/constant.hpp"
 #include "openvino/op/convert.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/unsqueeze.hpp"
+#include "openvino/op/util/squeeze_base.hpp"
 #include "openvino/op/util/op_types.hpp"
 #include "openvino/op/util/read_value_base.hpp"
 #include "openvino/op/util/shape_of_base.hpp"
 #include "openvino/op/util/sub_graph_base.hpp"
+#include "openvino/util/log.hpp"
 #include "transformations/rt_info/decompression.hpp"
 #include "transformations/rt_info/dequantization_node.hpp"
 
@@ -101,10 +111,295 @@ static void remove_requires_precision_conversion_attribute(const std::shared_ptr
     }
 }
 
+/**
+ * \brief Check if the node can be folded without the precision conversions done by the sequential folding.
+ */
+static bool can_be_folded_in_parallel(const std::shared_ptr<ov::Node>& node) {
+    if (node->get_input_size() == 0 || ov::is_type<ov::op::util::MultiSubGraphOp>(node) ||
+        ov::pass::constant_folding_is_disabled(node) || node_has_requires_precision_conversion_attribute(node)) {
+        return false;
+    }
+    const auto& inputs = node->inputs();
+    return std::none_of(inputs.cbegin(), inputs.cend(), [](const ov::Input<ov::Node>& input) {
+        return ov::util::has_original_input_precision(input);
+    });
+}
+
+/**
+ * \brief Check if the node is folded to a view of its input data, which its evaluate() would copy.
+ */
+static bool is_folded_to_view(const std::shared_ptr<ov::Node>& node) {
+    return ov::is_type<ov::op::v1::Reshape>(node) || ov::is_type<ov::op::util::SqueezeBase>(node) ||
+           ov::is_type<ov::op::v0::Unsqueeze>(node);
+}
+
+/**
+ * \brief Evaluates the node on the data of its input constants as the default constant_fold does. Unlike
+ * constant_fold, which may be overridden to create the nodes connected to the inputs, it doesn't change the model, so
+ * the nodes sharing the input constants can be evaluated in parallel.
+ */
+static bool evaluate_on_constants(const ov::Node& node, ov::TensorVector& output_tensors) {
+    ov::TensorVector input_tensors;
+    for (const auto& input : node.input_values()) {
+        const auto constant = ov::as_type<ov::op::v0::Constant>(input.get_node());
+        input_tensors.emplace_back(input.get_element_type(),
+                                   input.get_shape(),
+                                   const_cast<void*>(constant->get_data_ptr()));
+    }
+    for (const auto& output : node.outputs()) {
+        if (output.get_element_type().is_static()) {
+            output_tensors.emplace_back(output);
+        } else {
+            output_tensors.emplace_back();
+        }
+    }
+    return node.evaluate(output_tensors, input_tensors);
+}
+
+/**
+ * \brief Size of the memory allocated for the folded outputs, the outputs with dynamic shapes are not counted.
+ */
+static size_t folded_outputs_size(const ov::Node& node) {
+    size_t size = 0;
+    for (const auto& output : node.outputs()) {
+        const auto& shape = output.get_partial_shape();
+        if (shape.is_static()) {
+            size += ov::util::get_memory_size(output.get_element_type(), ov::shape_size(shape.to_shape()));
+        }
+    }
+    return size;
+}
+
+ov::pass::ConstantFolding::ConstantFolding(size_t parallel_memory_limit)
+    : m_parallel_memory_limit(parallel_memory_limit) {}
+
+const std::map<ov::DiscreteTypeInfo, ov::pass::ConstantFolding::FoldingStatistics>&
+ov::pass::ConstantFolding::get_folding_statistics() const {
+    return m_folding_statistics;
+}
+
+void ov::pass::ConstantFolding::update_folding_statistics(const Node& node, std::chrono::nanoseconds time) {
+    auto& statistics = m_folding_statistics[node.get_type_info()];
+    ++statistics.count;
+    statistics.time += time;
+}
+
+bool ov::pass::ConstantFolding::replace_with_folded(const std::shared_ptr<Node>& node,
+                                                    const OutputVector& replacements) {
+    OPENVINO_ASSERT(!constant_folding_is_disabled(node),
+                    "Node folded but constant folding disabled. Check constant_fold implementation for ",
+                    node);
+    OPENVINO_ASSERT(replacements.size() == node->get_output_size(),
+                    "constant_fold_default returned incorrect number of replacements for ",
+                    node);
+
+    bool rewritten = false;
+    for (size_t i = 0; i < replacements.size(); ++i) {
+        auto node_output = node->output(i);
+        const auto& replacement = replacements.at(i);
+        auto replacement_ptr = replacement.get_node_shared_ptr();
+        if (replacement_ptr && (node_output != replacement)) {
+            replacement_ptr->set_friendly_name(friendly_name_from(*node, replacements.size(), i));
+
+            node_output.replace(replacement);
+            // Copy runtime info from source nodes
+            // when it was not propogated during pre-calculation
+            copy_runtime_info_from_input_values(node);
+            // Propagate runtime info attributes to replacement
+            copy_runtime_info(node, replacement_ptr);
+            ov::copy_weightless_cache_attr(node, replacement_ptr);
+
+            rewritten = true;
+        }
+    }
+    return rewritten;
+}
+
+bool ov::pass::ConstantFolding::parallel_folding(const std::shared_ptr<ov::Model>& model, bool validate) {
+    if (m_parallel_memory_limit == 0) {
+        return false;
+    }
+
+    // The candidates are the nodes which depend only on constants, in the topological order of the model. A candidate
+    // is ready to be folded once all candidates it depends on are processed.
+    struct Candidate {
+        std::shared_ptr<Node> node;
+        std::vector<size_t> producers;
+        std::vector<size_t> consumers;
+        size_t pending_producers = 0;
+        size_t pending_consumers = 0;
+        size_t size = 0;
+    };
+    std::vector<Candidate> candidates;
+    {
+        // the index of the candidate or the constant which isn't a candidate
+        constexpr auto constant_index = std::numeric_limits<size_t>::max();
+        std::unordered_map<const Node*, size_t> indices;
+        for (const auto& node : model->get_ordered_ops()) {
+            if (ov::is_type<op::v0::Constant>(node)) {
+                indices.emplace(node.get(), constant_index);
+                continue;
+            }
+            if (!can_be_folded_in_parallel(node)) {
+                continue;
+            }
+            const auto& inputs = node->input_values();
+            if (!std::all_of(inputs.cbegin(), inputs.cend(), [&](const Output<Node>& input) {
+                    return indices.count(input.get_node());
+                })) {
+                continue;
+            }
+            const auto index = candidates.size();
+            Candidate candidate;
+            candidate.node = node;
+            for (const auto& input : inputs) {
+                const auto producer = indices.at(input.get_node());
+                if (producer != constant_index) {
+                    candidate.producers.push_back(producer);
+                    candidates[producer].consumers.push_back(index);
+                    ++candidates[producer].pending_consumers;
+                }
+            }
+            candidate.pending_producers = candidate.producers.size();
+            indices.emplace(node.get(), index);
+            candidates.push_back(std::move(candidate));
+        }
+    }
+
+    std::set<size_t> ready;
+    for (size_t i = 0; i < candidates.size(); ++i) {
+        if (candidates[i].pending_producers == 0) {
+            ready.insert(i);
+        }
+    }
+
+    // The folded values are alive until all their consumers are folded, so the size of the values which are still
+    // consumed and of the values being evaluated is kept within the limit. The ready nodes are taken in the topological
+    // order, so a constant subgraph is folded to the end before the next one is started and its intermediate values are
+    // released early. The node which doesn't fit the limit with the alive values is folded alone.
+    size_t alive_size = 0;
+    const auto processed = [&](size_t index) {
+        auto& candidate = candidates[index];
+        for (const auto producer : candidate.producers) {
+            if (--candidates[producer].pending_consumers == 0) {
+                alive_size -= candidates[producer].size;
+                candidates[producer].size = 0;
+            }
+        }
+        for (const auto consumer : candidate.consumers) {
+            if (--candidates[consumer].pending_producers == 0) {
+                ready.insert(consumer);
+            }
+        }
+        candidate.node.reset();
+    };
+
+    bool rewritten = false;
+    while (!ready.empty()) {
+        std::vector<size_t> batch;
+        size_t batch_size = 0;
+        for (auto it = ready.begin(); it != ready.end();) {
+            const auto index = *it;
+            const auto& node = candidates[index].node;
+            // the node isn't folded here if one of its inputs wasn't folded
+            if (!node->can_constant_fold(node->input_values()) ||
+                !std::all_of(node->inputs().cbegin(), node->inputs().cend(), [](const Input<Node>& input) {
+                    return ov::is_type<op::v0::Constant>(input.get_source_output().get_node());
+                })) {
+                it = ready.erase(it);
+                processed(index);
+                continue;
+            }
+            const auto node_size = folded_outputs_size(*node);
+            if (!batch.empty() && alive_size + batch_size + node_size > m_parallel_memory_limit) {
+                break;
+            }
+            if (validate || rewritten) {
+                node->validate_and_infer_types();
+            }
+            batch_size += node_size;
+            batch.push_back(index);
+            it = ready.erase(it);
+        }
+
+        // constant_fold isn't called in parallel, as it may create the nodes connected to the shared input constants
+        std::vector<TensorVector> outputs(batch.size());
+        std::vector<std::chrono::nanoseconds> times(batch.size());
+        std::vector<char> evaluated(batch.size(), false);
+        ov::parallel_for(batch.size(), [&](size_t i) {
+            const auto& node = candidates[batch[i]].node;
+            if (is_folded_to_view(node)) {
+                return;
+            }
+            const auto start = std::chrono::steady_clock::now();
+            try {
+                evaluated[i] = evaluate_on_constants(*node, outputs[i]);
+            } catch (...) {
+                // the error is reproduced by the sequential folding below
+                evaluated[i] = false;
+            }
+            times[i] = std::chrono::steady_clock::now() - start;
+        });
+
+        // the nodes which aren't evaluated here are folded sequentially by their constant_fold
+        for (size_t i = 0; i < batch.size(); ++i) {
+            auto& candidate = candidates[batch[i]];
+            const auto& node = candidate.node;
+            OutputVector replacements(node->get_output_size());
+            bool folded = evaluated[i];
+            if (folded) {
+                NodeVector inputs;
+                for (const auto& input : node->input_values()) {
+                    inputs.push_back(input.get_node_shared_ptr());
+                }
+                for (size_t output = 0; output < replacements.size(); ++output) {
+                    replacements[output] = std::make_shared<op::v0::Constant>(outputs[i][output]);
+                    ov::copy_runtime_info(inputs, replacements[output].get_node_shared_ptr());
+                }
+            } else {
+                const auto start = std::chrono::steady_clock::now();
+                folded = node->constant_fold(replacements, node->input_values());
+                times[i] += std::chrono::steady_clock::now() - start;
+            }
+            update_folding_statistics(*node, times[i]);
+            if (folded) {
+                rewritten = replace_with_folded(node, replacements) || rewritten;
+                if (candidate.pending_consumers != 0) {
+                    candidate.size = folded_outputs_size(*node);
+                    alive_size += candidate.size;
+                }
+            }
+        }
+        for (const auto index : batch) {
+            processed(index);
+        }
+    }
+    return rewritten;
+}
+
 bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& model) {
     RUN_ON_MODEL_SCOPE(ConstantFolding);
 
+    m_folding_statistics.clear();
+    const auto rewritten = fold_model(model);
+
+#ifdef ENABLE_OPENVINO_DEBUG
+    for (const auto& statistics : m_folding_statistics) {
+        OPENVINO_DEBUG("ConstantFolding: ",
+                       statistics.first,
+                       " folded ",
+                       statistics.second.count,
+                       " times in ",
+                       std::chrono::duration_cast<std::chrono::microseconds>(statistics.second.time).count(),
+                       " us");
+    }
+#endif
+    return rewritten;
+}
+
+bool ov::pass::ConstantFolding::fold_model(const std::shared_ptr<ov::Model>& model) {
     bool rewritten = pre_calculated_values_folding(model);
+    rewritten = parallel_folding(model, rewritten) || rewritten;
 
     for (const auto& original_node : model->get_ordered_ops()) {
         auto node = original_node;
@@ -114,7 +409,7 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
                 size_t sub_graphs_num = sub_graph_node->get_internal_subgraphs_size();
                 for (size_t sub_graph_ind = 0; sub_graph_ind < sub_graphs_num; ++sub_graph_ind) {
                     rewritten =
-                        run_on_model(sub_graph_node->get_function(static_cast<int>(sub_graph_ind))) || rewritten;
+                        fold_model(sub_graph_node->get_function(static_cast<int>(sub_graph_ind))) || rewritten;
                 }
             }
             rewritten = restore_original_input_precision(original_node) || rewritten;
@@ -135,32 +430,11 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
         }
 
         OutputVector replacements(node->get_output_size());
-        if (node->constant_fold(replacements, node->input_values())) {
-            OPENVINO_ASSERT(!constant_folding_is_disabled(original_node),
-                            "Node folded but constant folding disabled. Check constant_fold implementation for ",
-                            node);
-            OPENVINO_ASSERT(replacements.size() == node->get_output_size(),
-                            "constant_fold_default returned incorrect number of replacements for ",
-                            node);
-
-            for (size_t i = 0; i < replacements.size(); ++i) {
-                auto node_output = original_node->output(i);
-                const auto& replacement = replacements.at(i);
-                auto replacement_ptr = replacement.get_node_shared_ptr();
-                if (replacement_ptr && (node_output != replacement)) {
-                    replacement_ptr->set_friendly_name(friendly_name_from(*original_node, replacements.size(), i));
-
-                    node_output.replace(replacement);
-                    // Copy runtime info from source nodes
-                    // when it was not propogated during pre-calculation
-                    copy_runtime_info_from_input_values(original_node);
-                    // Propagate runtime info attributes to replacement
-                    copy_runtime_info(original_node, replacement_ptr);
-                    ov::copy_weightless_cache_attr(original_node, replacement_ptr);
-
-                    rewritten = true;
-                }
-            }
+        const auto start = std::chrono::steady_clock::now();
+        const auto folded = node->constant_fold(replacements, node->input_values());
+        update_folding_statistics(*original_node, std::chrono::steady_clock::now() - start);
+        if (folded) {
+            rewritten = replace_with_folded(original_node, replacements) || rewritten;
         } else {
             // if CF was unsuccessful remove original precision attribute from inputs
             bool restored = restore_original_input_precision(original_node);
@@ -170,7 +444,6 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
             }
         }
     }
-
     return rewritten;
 }
 
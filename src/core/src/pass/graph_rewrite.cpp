@@ -16,6 +16,7 @@
 #include "openvino/core/log_util.hpp"
 #include "openvino/op/util/multi_subgraph_base.hpp"
 #include "openvino/pass/backward_graph_rewrite.hpp"
+#include "openvino/pass/pattern/op/or.hpp"
 #include "openvino/pass/pattern/op/wrap_type.hpp"
 #include "openvino/util/log.hpp"
 #include "perf_counters.hpp"
@@ -66,6 +67,43 @@ PerfCounters& perf_counters_graph_rewrite() {
 }  // namespace ov
 
 #endif  // ENABLE_PROFILING_ITT_FULL
+
+namespace {
+/**
+ * @brief Collects the types of the nodes which can be matched by the pattern root.
+ *
+ * @param root   Root node of the pattern.
+ * @param types  Collected types, the node matches the root if its type is one of them or derived from one of them.
+ *
+ * @return false if the root can match a node of any type (pattern::op::Label, pattern::op::Any, etc.)
+ */
+bool collect_root_types(const std::shared_ptr<ov::Node>& root, std::vector<ov::NodeTypeInfo>& types) {
+    // pattern::op::AnyOutput operation automatically appends for multi output operations inside
+    // Matcher and to get actual root node we need to take it's parent.
+    if (auto any_output = ov::as_type_ptr<ov::pass::pattern::op::AnyOutput>(root)) {
+        return collect_root_types(any_output->input_value(0).get_node_shared_ptr(), types);
+    }
+    if (auto wrap_type = ov::as_type_ptr<ov::pass::pattern::op::WrapType>(root)) {
+        const auto& wrapped_types = wrap_type->get_wrapped_types();
+        types.insert(types.end(), wrapped_types.begin(), wrapped_types.end());
+        return true;
+    }
+    if (ov::as_type_ptr<ov::pass::pattern::op::Or>(root)) {
+        for (const auto& input : root->input_values()) {
+            if (!collect_root_types(input.get_node_shared_ptr(), types)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    if (std::dynamic_pointer_cast<ov::pass::pattern::op::Pattern>(root)) {
+        return false;
+    }
+    types.push_back(root->get_type_info());
+    return true;
+}
+}  // namespace
+
 std::shared_ptr<ov::pass::MatcherPass> ov::pass::GraphRewrite::add_matcher(
     const std::shared_ptr<ov::pass::MatcherPass>& pass) {
     auto pass_config = get_pass_config();
@@ -101,48 +139,54 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
     bool rewritten = false;
     const auto& pass_config = get_pass_config();
 
-    // Check that all Matchers in MatcherPasses has type bases root node
-    bool all_roots_has_type = true;
+    // Index the matchers by the types of their pattern roots. The matchers with a root which can match a node of any
+    // type are applied for every node.
     std::unordered_map<NodeTypeInfo, std::vector<size_t>> type_to_matcher;
+    std::vector<size_t> generic_matchers;
+    std::vector<NodeTypeInfo> root_types;
     for (size_t matcher_index = 0; matcher_index < m_matchers.size(); ++matcher_index) {
         // Skip passes that are disabled
         if (pass_config->is_disabled(m_matchers[matcher_index]->get_type_info()))
             continue;
 
+        root_types.clear();
         auto matcher = m_matchers[matcher_index]->get_matcher();
-        if (!matcher) {
-            all_roots_has_type = false;
-            break;
-        }
-
-        auto root = matcher->get_pattern_value().get_node_shared_ptr();
-        // pattern::op::AnyOutput operation automatically appends for multi output operations inside
-        // Matcher and to gen actual root node we need to take it's parent.
-        if (auto any_type = ov::as_type_ptr<pattern::op::AnyOutput>(root)) {
-            root = any_type->input_value(0).get_node_shared_ptr();
-        }
-
-        // if root is an operation from opset or has pattern::op::WrapType type then we can extract
-        // it's type
-        // and use it in unordered_map as key for fast MatcherPass search. Otherwise type is unknown
-        // and default algorithm is used.
-        if (auto p = std::dynamic_pointer_cast<pattern::op::Pattern>(root)) {
-            if (auto any_type = ov::as_type_ptr<ov::pass::pattern::op::WrapType>(p)) {
-                for (const auto& root_type_info : any_type->get_wrapped_types()) {
-                    type_to_matcher[root_type_info].push_back(matcher_index);
+        if (matcher && collect_root_types(matcher->get_pattern_value().get_node_shared_ptr(), root_types)) {
+            for (const auto& root_type_info : root_types) {
+                auto& matchers = type_to_matcher[root_type_info];
+                // the same type can be listed in several branches of the pattern
+                if (matchers.empty() || matchers.back() != matcher_index) {
+                    matchers.push_back(matcher_index);
                 }
-            } else {
-                all_roots_has_type = false;
-                break;
             }
         } else {
-            type_to_matcher[root->get_type_info()].push_back(matcher_index);
+            generic_matchers.push_back(matcher_index);
         }
-
-        // TODO: traverse parents for root_type_info in order to register complete list of matchers
-        // including ones triggered by parent type info.
     }
 
+    // Returns the matchers for the node type: the matchers registered for the type, for its parents and the generic
+    // matchers in order of the registration. The list is collected once for each type of the processed nodes.
+    std::unordered_map<NodeTypeInfo, std::vector<size_t>> matchers_for_type;
+    auto get_matchers_for_type = [&](const NodeTypeInfo& type_info) -> const std::vector<size_t>& {
+        auto cached = matchers_for_type.find(type_info);
+        if (cached != matchers_for_type.end()) {
+            return cached->second;
+        }
+        std::vector<size_t> matcher_passes_to_run = generic_matchers;
+        for (auto node_type_info = &type_info; node_type_info; node_type_info = node_type_info->parent) {
+            auto matchers = type_to_matcher.find(*node_type_info);
+            if (matchers != type_to_matcher.end()) {
+                matcher_passes_to_run.insert(matcher_passes_to_run.end(),
+                                             matchers->second.begin(),
+                                             matchers->second.end());
+            }
+        }
+        std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
+        matcher_passes_to_run.erase(std::unique(matcher_passes_to_run.begin(), matcher_passes_to_run.end()),
+                                    matcher_passes_to_run.end());
+        return matchers_for_type.emplace(type_info, std::move(matcher_passes_to_run)).first->second;
+    };
+
     // This lambda preforms execution of particular MatcherPass on given node.
     // It automatically handles nodes registered by MatcherPass during transformation and set
     // transformation callback.
@@ -175,9 +219,6 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         return status;
     };
 
-    // list of matchers to run for a node; define here to keep memory allocated
-    std::vector<size_t> matcher_passes_to_run;
-
     while (!nodes_to_run.empty()) {
         auto weak_node = nodes_to_run.front();
         nodes_to_run.pop_front();
@@ -200,47 +241,10 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         if (m_enable_shape_inference) {
             node->revalidate_and_infer_types();
         }
-        // If all Matchers in MatcherPasses has type based root node then we apply efficient
-        // algorithm for finding matchers
-        if (all_roots_has_type) {
-            const DiscreteTypeInfo* node_type_info = &node->get_type_info();
-            matcher_passes_to_run.clear();
-            while (node_type_info) {
-                auto matchers = type_to_matcher.find(*node_type_info);
-                if (matchers != type_to_matcher.end()) {
-                    // do not run found matchers immediately, need to collect all matchers for
-                    // parents
-                    // and sort them in order of the registration
-                    matcher_passes_to_run.insert(matcher_passes_to_run.end(),
-                                                 matchers->second.begin(),
-                                                 matchers->second.end());
-                }
-                node_type_info = node_type_info->parent;
-            }
-
-            std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
-
-            // TODO: type_to_matcher with just collected list of matchers to enable
-            // fast processing at the next time when node with the same type will be processed
-
-            for (size_t matcher_index : matcher_passes_to_run) {
-                if (run_matcher_pass(m_matchers[matcher_index], node)) {
-                    rewritten = true;
-                    break;
-                }
-            }
-        }
-        // Otherwise we use default algorithm that iterates over all registered matcher passes
-        else {
-            for (auto& m_pass : m_matchers) {
-                // Skip passes that are disabled
-                if (pass_config->is_disabled(m_pass->get_type_info()))
-                    continue;
-
-                if (run_matcher_pass(m_pass, node)) {
-                    rewritten = true;
-                    break;
-                }
+        for (size_t matcher_index : get_matchers_for_type(node->get_type_info())) {
+            if (run_matcher_pass(m_matchers[matcher_index], node)) {
+                rewritten = true;
+                break;
             }
         }
     }
@@ -282,9 +286,10 @@ void ov::pass::MatcherPass::register_matcher(const std::shared_ptr<ov::pass::pat
     set_name(m->get_name());
     set_property(property, true);
     m_matcher = m;
-    m_handler = [m, callback](const std::shared_ptr<Node>& node) -> bool {
+    m_handler = [this, m, callback](const std::shared_ptr<Node>& node) -> bool {
         OPENVINO_LOG_GRAPH_REWRITE1(m, node);
         if (m->match(node->output(0))) {
+            ++m_statistics.matches;
             OV_PASS_CALLBACK(m);
 
             try {
@@ -312,7 +317,10 @@ void ov::pass::MatcherPass::register_matcher(const std::shared_ptr<ov::pass::pat
 bool ov::pass::MatcherPass::apply(std::shared_ptr<ov::Node> node) {
     OV_ITT_SCOPED_TASK(ov::itt::domains::ov_core, pass::perf_counters_graph_rewrite()[get_type_info()]);
     clear_new_nodes();
-    if (m_handler)
-        return m_handler(node);
+    ++m_statistics.attempts;
+    if (m_handler && m_handler(node)) {
+        ++m_statistics.applied;
+        return true;
+    }
     return false;
 }
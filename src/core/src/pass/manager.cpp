@@ -151,6 +151,8 @@ public:
      *
      *      Usage: Set this environment variable to "true" to enable visualizations.
      *      Alternatively, specify a file path where the execution times will be saved.
+     *      The number of the nodes each MatcherPass was applied to, matched by its pattern and transformed
+     *      is logged after the execution time of the pass.
      *
      *      Example:
      *      export OV_ENABLE_PROFILE_PASS=true
@@ -244,6 +246,34 @@ public:
         }
     }
 
+    void start_matcher_statistics(const std::shared_ptr<ov::pass::PassBase>& pass) const {
+        if (m_profile_pass.is_enabled()) {
+            for_each_matcher(pass, [](const std::shared_ptr<ov::pass::MatcherPass>& matcher) {
+                matcher->reset_statistics();
+            });
+        }
+    }
+
+    void stop_matcher_statistics(const std::shared_ptr<ov::pass::PassBase>& pass, const std::string& pass_name) {
+        if (m_profile_pass.is_enabled()) {
+            for_each_matcher(pass, [&](const std::shared_ptr<ov::pass::MatcherPass>& matcher) {
+                const auto& statistics = matcher->get_statistics();
+                if (statistics.attempts == 0) {
+                    return;
+                }
+                if (m_profile_pass.is_bool()) {
+                    std::cout << std::setw(29) << std::left << "";
+                    std::cout << std::setw(58) << std::left << matcher->get_name();
+                    std::cout << " attempts: " << statistics.attempts << " matches: " << statistics.matches
+                              << " applied: " << statistics.applied << std::endl;
+                } else if (m_file.is_open()) {
+                    m_file << "p;" << matcher->get_name() << ";" << pass_name << ";" << statistics.attempts << ";"
+                           << statistics.matches << ";" << statistics.applied << std::endl;
+                }
+            });
+        }
+    }
+
     void visualize(const std::shared_ptr<ov::Model>& model, const std::string& pass_name) const {
         static size_t viz_index = 0;
         if (m_visualize.is_enabled()) {
@@ -291,6 +321,17 @@ public:
     }
 
 private:
+    template <class Func>
+    static void for_each_matcher(const std::shared_ptr<ov::pass::PassBase>& pass, const Func& func) {
+        if (auto matcher_pass = ov::as_type_ptr<ov::pass::MatcherPass>(pass)) {
+            func(matcher_pass);
+        } else if (auto graph_rewrite = ov::as_type_ptr<ov::pass::GraphRewrite>(pass)) {
+            for (const auto& matcher : graph_rewrite->get_matchers()) {
+                func(matcher);
+            }
+        }
+    }
+
     static std::string gen_file_name(const std::string& model_name, const std::string& pass_name, const size_t idx) {
         std::stringstream name;
         // visualizations and serializations will be named after the outermost function
@@ -342,9 +383,11 @@ bool ov::pass::Manager::run_passes(const std::shared_ptr<ov::Model>& model) {
     for (const auto& pass : m_pass_list) {
         const auto& pass_name = pass->get_name();
 
+        profiler.start_matcher_statistics(pass);
         profiler.start_timer(pass_name);
         pass_changed_model = run_pass(pass, model, pass_changed_model);
         profiler.stop_timer(pass_name, pass_changed_model);
+        profiler.stop_matcher_statistics(pass, pass_name);
 
         model_changed = model_changed || pass_changed_model;
 
@@ -23,6 +23,7 @@
 #include "openvino/runtime/string_aligned_buffer.hpp"
 #include "openvino/util/common_util.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/xml_util/binary_topology.hpp"
 #include "openvino/xml_util/constant_writer.hpp"
 #include "openvino/xml_util/xml_serialize_util.hpp"
 #include "pugixml.hpp"
@@ -31,9 +32,13 @@
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
 
 namespace {
+bool is_binary_topology_path(const std::filesystem::path& path) {
+    return path.extension() == ov::util::binary_topology::file_extension;
+}
+
 const std::filesystem::path valid_xml_path(const std::filesystem::path& path) {
-    OPENVINO_ASSERT(path.extension() == ".xml",
-                    "Path for xml file doesn't contains file name with 'xml' extension: \"",
+    OPENVINO_ASSERT(path.extension() == ".xml" || is_binary_topology_path(path),
+                    "Path for xml file doesn't contains file name with 'xml' or 'ovbt' extension: \"",
                     path,
                     "\"");
     return path;
@@ -54,7 +59,8 @@ void serialize_func(std::ostream& xml_file,
                     std::shared_ptr<ov::Model> model,
                     ov::pass::Serialize::Version ver,
                     bool deterministic,
-                    ov::util::ConstantWriter& constant_writer) {
+                    ov::util::ConstantWriter& constant_writer,
+                    bool binary_topology = false) {
     auto version = static_cast<int64_t>(ver);
 
     auto& rt_info = model->get_rt_info();
@@ -72,14 +78,18 @@ void serialize_func(std::ostream& xml_file,
         version != static_cast<int64_t>(ov::pass::Serialize::Version::IR_V11)) {
         OPENVINO_THROW("Unsupported version");
     }
-    std::string name = "net";
-    pugi::xml_document xml_doc;
-    pugi::xml_node net_node = xml_doc.append_child(name.c_str());
-    ov::util::XmlSerializer
-        visitor(net_node, name, constant_writer, version, deterministic, false, ov::element::dynamic, false);
-    visitor.on_attribute(name, model);
-
-    xml_doc.save(xml_file);
+    if (binary_topology) {
+        ov::util::binary_topology::serialize(xml_file, constant_writer, model, version);
+    } else {
+        std::string name = "net";
+        pugi::xml_document xml_doc;
+        pugi::xml_node net_node = xml_doc.append_child(name.c_str());
+        ov::util::XmlSerializer
+            visitor(net_node, name, constant_writer, version, deterministic, false, ov::element::dynamic, false);
+        visitor.on_attribute(name, model);
+
+        xml_doc.save(xml_file);
+    }
     xml_file.flush();
     bin_file.flush();
 }
@@ -88,9 +98,10 @@ void serialize_func(std::ostream& xml_file,
                     std::ostream& bin_file,
                     std::shared_ptr<ov::Model> model,
                     ov::pass::Serialize::Version ver,
-                    bool deterministic = false) {
+                    bool deterministic = false,
+                    bool binary_topology = false) {
     ov::util::ConstantWriter constant_write_handler(bin_file);
-    serialize_func(xml_file, bin_file, model, ver, deterministic, constant_write_handler);
+    serialize_func(xml_file, bin_file, model, ver, deterministic, constant_write_handler, binary_topology);
 }
 }  // namespace
 
@@ -115,12 +126,13 @@ bool pass::Serialize::run_on_model(const std::shared_ptr<ov::Model>& model) {
         std::ofstream bin_file(m_binPath, std::ios::binary);
         OPENVINO_ASSERT(bin_file, "Can't open bin file: \"", m_binPath, "\"");
 
-        // create xml file
-        std::ofstream xml_file(m_xmlPath);
+        // create xml file, the binary topology is written instead of XML for .ovbt path
+        const bool binary_topology = is_binary_topology_path(m_xmlPath);
+        std::ofstream xml_file(m_xmlPath, binary_topology ? std::ios::binary : std::ios::out);
         OPENVINO_ASSERT(xml_file, "Can't open xml file: \"", m_xmlPath, "\"");
 
         try {
-            serialize_func(xml_file, bin_file, model, m_version);
+            serialize_func(xml_file, bin_file, model, m_version, false, binary_topology);
         } catch (const ov::AssertFailure&) {
             // optimization decision was made to create .bin file upfront and
             // write to it directly instead of buffering its content in memory,
@@ -6,10 +6,19 @@
 
 #include <algorithm>
 #include <memory>
+#include <vector>
 
 #include "openvino/core/memory_util.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/runtime/compute_hash.hpp"
+#include "openvino/util/common_util.hpp"
 
 namespace ov {
+namespace {
+// the fixed size of the chunks keeps the hash independent of the number of threads
+constexpr size_t content_hash_chunk_size = 16 * 1024 * 1024;
+}  // namespace
+
 AlignedBuffer::AlignedBuffer() : m_allocated_buffer(nullptr), m_aligned_buffer(nullptr), m_byte_size(0) {}
 
 AlignedBuffer::AlignedBuffer(size_t byte_size, size_t alignment) : m_byte_size(byte_size) {
@@ -46,10 +55,40 @@ AlignedBuffer& AlignedBuffer::operator=(AlignedBuffer&& other) {
         other.m_allocated_buffer = nullptr;
         other.m_aligned_buffer = nullptr;
         other.m_byte_size = 0;
+        reset_content_hash();
+        other.reset_content_hash();
     }
     return *this;
 }
 
+uint64_t AlignedBuffer::get_content_hash() const {
+    if (m_aligned_buffer && m_content_hash_data.load(std::memory_order_acquire) == m_aligned_buffer) {
+        return m_content_hash.load(std::memory_order_relaxed);
+    }
+    uint64_t hash = m_byte_size;
+    if (m_byte_size == 0) {
+        // nothing to hash, the pointer of the empty buffer may be null
+    } else if (m_byte_size <= content_hash_chunk_size) {
+        hash = util::u64_hash_combine(hash, runtime::compute_hash(m_aligned_buffer, m_byte_size));
+    } else {
+        const size_t chunks_num = (m_byte_size + content_hash_chunk_size - 1) / content_hash_chunk_size;
+        std::vector<uint64_t> chunk_hashes(chunks_num);
+        ov::parallel_for(chunks_num, [&](size_t chunk) {
+            const auto offset = chunk * content_hash_chunk_size;
+            const auto size = std::min(content_hash_chunk_size, m_byte_size - offset);
+            chunk_hashes[chunk] = runtime::compute_hash(m_aligned_buffer + offset, size);
+        });
+        for (const auto& chunk_hash : chunk_hashes) {
+            hash = util::u64_hash_combine(hash, chunk_hash);
+        }
+    }
+    if (m_aligned_buffer) {
+        m_content_hash.store(hash, std::memory_order_relaxed);
+        m_content_hash_data.store(m_aligned_buffer, std::memory_order_release);
+    }
+    return hash;
+}
+
 AttributeAdapter<std::shared_ptr<ov::AlignedBuffer>>::AttributeAdapter(std::shared_ptr<ov::AlignedBuffer>& value)
     : DirectValueAccessor<std::shared_ptr<ov::AlignedBuffer>>(value) {}
 
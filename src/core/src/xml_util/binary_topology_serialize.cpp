@@ -0,0 +1,525 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <set>
+#include <type_traits>
+#include <unordered_map>
+
+#include "openvino/core/descriptor_tensor.hpp"
+#include "openvino/core/except.hpp"
+#include "openvino/core/meta_data.hpp"
+#include "openvino/core/runtime_attribute.hpp"
+#include "openvino/op/loop.hpp"
+#include "openvino/op/util/framework_node.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
+#include "openvino/op/util/op_types.hpp"
+#include "openvino/op/util/variable.hpp"
+#include "openvino/runtime/string_aligned_buffer.hpp"
+#include "openvino/xml_util/binary_topology.hpp"
+#include "transformations/rt_info/disable_fp16_compression.hpp"
+
+namespace ov::util::binary_topology {
+namespace {
+constexpr std::string_view rt_info_user_data_tag{"user_data"};
+
+class Buffer {
+public:
+    template <class T>
+    void write(const T& value) {
+        const auto stored = to_little_endian(value);
+        m_data.append(reinterpret_cast<const char*>(&stored), sizeof(T));
+    }
+
+    void write_bytes(const char* data, size_t size) {
+        m_data.append(data, size);
+    }
+
+    void write_size(size_t size) {
+        OPENVINO_ASSERT(size <= std::numeric_limits<uint32_t>::max(),
+                        "The size ",
+                        size,
+                        " exceeds the limit of the binary topology");
+        write(static_cast<uint32_t>(size));
+    }
+
+    void write_string(const std::string& value) {
+        write_size(value.size());
+        m_data.append(value);
+    }
+
+    template <class T>
+    void write_vector(const std::vector<T>& values) {
+        write_size(values.size());
+        for (const auto& value : values) {
+            write(value);
+        }
+    }
+
+    template <class Container>
+    void write_strings(const Container& values) {
+        write_size(values.size());
+        for (const auto& value : values) {
+            write_string(value);
+        }
+    }
+
+    void append(const Buffer& other) {
+        m_data.append(other.m_data);
+    }
+
+    size_t size() const {
+        return m_data.size();
+    }
+
+    const std::string& data() const {
+        return m_data;
+    }
+
+private:
+    std::string m_data;
+};
+
+std::string get_opset_name(const ov::Node* n) {
+    auto opset_it = n->get_rt_info().find("opset");
+    if (opset_it != n->get_rt_info().end() && opset_it->second.is<std::string>()) {
+        return opset_it->second.as<std::string>();
+    }
+    return n->get_type_info().version_id == nullptr ? "experimental" : n->get_type_info().version_id;
+}
+
+class ModelWriter;
+
+// Writes the attributes visited by the node as the records of the binary topology
+class AttributeWriter : public ov::AttributeVisitor {
+public:
+    AttributeWriter(ModelWriter& model_writer,
+                    std::string node_type_name,
+                    bool compress_to_fp16,
+                    ov::element::Type output_element_type)
+        : m_model_writer(model_writer),
+          m_node_type_name(std::move(node_type_name)),
+          m_compress_to_fp16(compress_to_fp16),
+          m_output_element_type(output_element_type) {}
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<void>& adapter) override;
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<bool>& adapter) override {
+        Buffer value;
+        value.write(static_cast<uint8_t>(adapter.get()));
+        add(name, AttributeType::BOOL, value);
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::string>& adapter) override {
+        Buffer value;
+        if (m_compress_to_fp16 && name == "element_type") {
+            value.write_string(ov::as_string(static_cast<ov::element::Type_t>(ov::element::f16)));
+        } else {
+            value.write_string(adapter.get());
+        }
+        add(name, AttributeType::STRING, value);
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<int64_t>& adapter) override {
+        Buffer value;
+        value.write(adapter.get());
+        add(name, AttributeType::INT64, value);
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<double>& adapter) override {
+        Buffer value;
+        value.write(adapter.get());
+        add(name, AttributeType::DOUBLE, value);
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int>>& adapter) override {
+        Buffer value;
+        value.write_vector(adapter.get());
+        add(name, AttributeType::VECTOR_INT32, value);
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        Buffer value;
+        value.write_vector(adapter.get());
+        add(name, AttributeType::VECTOR_INT64, value);
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        Buffer value;
+        value.write_vector(adapter.get());
+        add(name, AttributeType::VECTOR_UINT64, value);
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<float>>& adapter) override {
+        Buffer value;
+        value.write_vector(adapter.get());
+        add(name, AttributeType::VECTOR_FLOAT, value);
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<std::string>>& adapter) override {
+        Buffer value;
+        value.write_strings(adapter.get());
+        add(name, AttributeType::VECTOR_STRING, value);
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::shared_ptr<ov::Model>>& adapter) override;
+
+    /// @brief writes the number of the records followed by the records
+    void write_to(Buffer& buffer) const {
+        buffer.write_size(m_count);
+        buffer.append(m_records);
+    }
+
+private:
+    void add(const std::string& name, AttributeType type, const Buffer& value) {
+        m_records.write_string(name);
+        m_records.write(type);
+        m_records.write_size(value.size());
+        m_records.append(value);
+        ++m_count;
+    }
+
+    void write_string_tensor(const std::string& name,
+                             std::shared_ptr<uint8_t> header,
+                             size_t header_size,
+                             size_t num_elements,
+                             const std::function<void(const char*&, size_t&, size_t)>& get_raw_string);
+
+    ModelWriter& m_model_writer;
+    std::string m_node_type_name;
+    bool m_compress_to_fp16;
+    ov::element::Type m_output_element_type;
+    Buffer m_records;
+    size_t m_count = 0;
+};
+
+class ModelWriter {
+public:
+    explicit ModelWriter(ov::util::ConstantWriter& constant_writer) : m_constant_writer(constant_writer) {}
+
+    void write_model(Buffer& buffer, ov::Model& model) {
+        buffer.write_string(model.get_friendly_name());
+
+        const auto ordered_ops = model.get_ordered_ops();
+        std::unordered_map<const ov::Node*, size_t> node_ids;
+        buffer.write_size(ordered_ops.size());
+        for (const auto& node : ordered_ops) {
+            write_node(buffer, *node, node_ids);
+            node_ids.emplace(node.get(), node_ids.size());
+        }
+
+        auto write_ids = [&](const auto& nodes) {
+            buffer.write_size(nodes.size());
+            for (const auto& node : nodes) {
+                buffer.write(static_cast<uint32_t>(node_ids.at(node.get())));
+            }
+        };
+        write_ids(model.get_parameters());
+        write_ids(model.get_results());
+        write_ids(model.get_sinks());
+
+        Buffer entries;
+        size_t count = 0;
+        for (const auto& item : model.get_rt_info()) {
+            // Skip IR version and Weights path.
+            if (item.first == "version" || item.first == "__weights_path")
+                continue;
+            count += write_any(entries, item.first, item.second);
+        }
+        buffer.write_size(count);
+        buffer.append(entries);
+    }
+
+    ov::util::ConstantWriter& get_constant_writer() {
+        return m_constant_writer;
+    }
+
+private:
+    void write_node(Buffer& buffer, ov::Node& node, const std::unordered_map<const ov::Node*, size_t>& node_ids) {
+        OPENVINO_ASSERT(!node.get_rt_info().count("postponed_constant"),
+                        "Node with set `postponed_constant` attribute is not supported by the binary topology: ",
+                        node);
+        const std::string node_type_name{node.get_type_name()};
+        buffer.write_string(node_type_name);
+        buffer.write_string(get_opset_name(&node));
+        buffer.write_string(node.get_friendly_name());
+
+        buffer.write_size(node.get_input_size());
+        for (auto& input : node.inputs()) {
+            const auto source_output = input.get_source_output();
+            const auto source = node_ids.find(source_output.get_node());
+            OPENVINO_ASSERT(source != node_ids.end(), "Internal error");
+            buffer.write(static_cast<uint32_t>(source->second));
+            buffer.write(static_cast<uint32_t>(source_output.get_index()));
+            write_rt_info(buffer, input.get_rt_info());
+        }
+
+        buffer.write_size(node.get_output_size());
+        for (auto& output : node.outputs()) {
+            const auto& names = ov::op::util::is_output(&node)
+                                    ? ov::descriptor::get_assigned_names(output.get_tensor())
+                                    : output.get_tensor().get_names();
+            auto sorted_names = std::vector<std::string>(names.begin(), names.end());
+            std::sort(sorted_names.begin(), sorted_names.end());
+            buffer.write_strings(sorted_names);
+            write_rt_info(buffer, output.get_rt_info());
+        }
+
+        write_rt_info(buffer, node.get_rt_info());
+
+        bool compress_to_fp16 = false;
+        ov::element::Type output_element_type = ov::element::dynamic;
+        if (is_fp16_compression_postponed(node.get_rt_info())) {
+            compress_to_fp16 = true;
+            output_element_type = node.get_output_element_type(0);
+        }
+        AttributeWriter visitor(*this, node_type_name, compress_to_fp16, output_element_type);
+        OPENVINO_ASSERT(node.visit_attributes(visitor), "Visitor API is not supported in ", node);
+        visitor.write_to(buffer);
+    }
+
+    // The runtime attributes and the custom entries are stored as in IR XML, the other entries are skipped
+    void write_rt_info(Buffer& buffer, ov::RTMap& rt_info) {
+        Buffer entries;
+        size_t count = 0;
+        for (auto& item : rt_info) {
+            if (item.second.is<ov::RuntimeAttribute>()) {
+                auto& attribute = item.second.as<ov::RuntimeAttribute>();
+                AttributeWriter visitor(*this, {}, false, ov::element::dynamic);
+                if (!attribute.visit_attributes(visitor)) {
+                    continue;
+                }
+                const auto& type_info = attribute.get_type_info();
+                entries.write(RtInfoType::RUNTIME_ATTRIBUTE);
+                entries.write_string(type_info.name);
+                entries.write_string(type_info.get_version());
+                visitor.write_to(entries);
+                ++count;
+            } else if (item.first.compare(0, rt_info_user_data_tag.size(), rt_info_user_data_tag) == 0 ||
+                       item.first == "alt_width") {
+                count += write_any(entries, item.first, item.second);
+            }
+        }
+        buffer.write_size(count);
+        buffer.append(entries);
+    }
+
+    static bool write_any(Buffer& entries, const std::string& key, const ov::Any& value) {
+        if (value.is<std::shared_ptr<ov::Meta>>()) {
+            const ov::AnyMap& map = *value.as<std::shared_ptr<ov::Meta>>();
+            write_map(entries, key, map);
+        } else if (value.is<ov::AnyMap>()) {
+            write_map(entries, key, value.as<ov::AnyMap>());
+        } else if (!value.empty() && !value.is<ov::RuntimeAttribute>() &&
+                   !value.is<std::shared_ptr<ov::RuntimeAttribute>>()) {
+            entries.write(RtInfoType::STRING);
+            entries.write_string(key);
+            entries.write_string(value.as<std::string>());
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+    static void write_map(Buffer& entries, const std::string& key, const ov::AnyMap& map) {
+        Buffer nested;
+        size_t count = 0;
+        for (const auto& item : map) {
+            count += write_any(nested, item.first, item.second);
+        }
+        entries.write(RtInfoType::MAP);
+        entries.write_string(key);
+        entries.write_size(count);
+        entries.append(nested);
+    }
+
+    ov::util::ConstantWriter& m_constant_writer;
+};
+
+void AttributeWriter::on_adapter(const std::string& name, ov::ValueAccessor<void>& adapter) {
+    using InputDescriptions = std::vector<std::shared_ptr<ov::op::util::MultiSubGraphOp::InputDescription>>;
+    using OutputDescriptions = std::vector<std::shared_ptr<ov::op::util::MultiSubGraphOp::OutputDescription>>;
+    Buffer value;
+    if (const auto& a = ov::as_type<ov::AttributeAdapter<InputDescriptions>>(&adapter)) {
+        value.write_size(a->get().size());
+        for (const auto& description : a->get()) {
+            if (ov::as_type_ptr<ov::op::util::MultiSubGraphOp::SliceInputDescription>(description)) {
+                value.write(InputDescriptionType::SLICE);
+            } else if (ov::as_type_ptr<ov::op::util::MultiSubGraphOp::MergedInputDescription>(description)) {
+                value.write(InputDescriptionType::MERGED);
+            } else if (ov::as_type_ptr<ov::op::util::MultiSubGraphOp::InvariantInputDescription>(description)) {
+                value.write(InputDescriptionType::INVARIANT);
+            } else {
+                OPENVINO_THROW("Unsupported input description for serialization: ", name);
+            }
+            value.write(description->m_input_index);
+            value.write(description->m_body_parameter_index);
+            if (auto slice = ov::as_type_ptr<ov::op::util::MultiSubGraphOp::SliceInputDescription>(description)) {
+                value.write(slice->m_start);
+                value.write(slice->m_stride);
+                value.write(slice->m_part_size);
+                value.write(slice->m_end);
+                value.write(slice->m_axis);
+            } else if (auto merged =
+                           ov::as_type_ptr<ov::op::util::MultiSubGraphOp::MergedInputDescription>(description)) {
+                value.write(merged->m_body_value_index);
+            }
+        }
+        add(name, AttributeType::INPUT_DESCRIPTIONS, value);
+    } else if (const auto& a = ov::as_type<ov::AttributeAdapter<OutputDescriptions>>(&adapter)) {
+        value.write_size(a->get().size());
+        for (const auto& description : a->get()) {
+            if (auto concat = ov::as_type_ptr<ov::op::util::MultiSubGraphOp::ConcatOutputDescription>(description)) {
+                value.write(OutputDescriptionType::CONCAT);
+                value.write(description->m_body_value_index);
+                value.write(description->m_output_index);
+                value.write(concat->m_start);
+                value.write(concat->m_stride);
+                value.write(concat->m_part_size);
+                value.write(concat->m_end);
+                value.write(concat->m_axis);
+            } else if (auto body =
+                           ov::as_type_ptr<ov::op::util::MultiSubGraphOp::BodyOutputDescription>(description)) {
+                value.write(OutputDescriptionType::BODY);
+                value.write(description->m_body_value_index);
+                value.write(description->m_output_index);
+                value.write(body->m_iteration);
+            } else {
+                OPENVINO_THROW("Unsupported output description for serialization: ", name);
+            }
+        }
+        add(name, AttributeType::OUTPUT_DESCRIPTIONS, value);
+    } else if (const auto& a = ov::as_type<ov::AttributeAdapter<ov::op::v5::Loop::SpecialBodyPorts>>(&adapter)) {
+        value.write(a->get().current_iteration_input_idx);
+        value.write(a->get().body_condition_output_idx);
+        add(name, AttributeType::SPECIAL_BODY_PORTS, value);
+    } else if (const auto& a = ov::as_type<ov::AttributeAdapter<std::shared_ptr<ov::op::util::Variable>>>(&adapter)) {
+        value.write_string(a->get()->get_info().variable_id);
+        add(name, AttributeType::VARIABLE, value);
+    } else if (const auto& a = ov::as_type<ov::AttributeAdapter<std::shared_ptr<ov::StringAlignedBuffer>>>(&adapter)) {
+        std::shared_ptr<uint8_t> header;
+        size_t header_size = 0;
+        a->get_header(header, header_size);
+        write_string_tensor(name,
+                            header,
+                            header_size,
+                            a->get()->get_num_elements(),
+                            [&](const char*& ptr, size_t& size, size_t index) {
+                                a->get_raw_string_by_index(ptr, size, index);
+                            });
+    } else if (const auto& a =
+                   ov::as_type<ov::AttributeAdapter<std::shared_ptr<ov::SharedStringAlignedBuffer>>>(&adapter)) {
+        std::shared_ptr<uint8_t> header;
+        size_t header_size = 0;
+        a->get_header(header, header_size);
+        write_string_tensor(name,
+                            header,
+                            header_size,
+                            a->get()->get_num_elements(),
+                            [&](const char*& ptr, size_t& size, size_t index) {
+                                a->get_raw_string_by_index(ptr, size, index);
+                            });
+    } else if (const auto& a = ov::as_type<ov::AttributeAdapter<std::shared_ptr<ov::AlignedBuffer>>>(&adapter)) {
+        if (name == "value" && m_node_type_name == "Constant") {
+            size_t new_size = 0;
+            const auto offset = m_model_writer.get_constant_writer().write(*a->get(),
+                                                                           new_size,
+                                                                           m_compress_to_fp16,
+                                                                           m_output_element_type);
+            value.write(static_cast<uint64_t>(offset));
+            value.write(static_cast<uint64_t>(new_size));
+            add(name, AttributeType::CONSTANT_DATA, value);
+        }
+    } else if (ov::is_type<ov::AttributeAdapter<ov::op::util::FrameworkNodeAttrs>>(&adapter)) {
+        OPENVINO_THROW("FrameworkNode is not supported by the binary topology: ", name);
+    } else if (const auto& a = ov::as_type<ov::AttributeAdapter<ov::element::TypeVector>>(&adapter)) {
+        std::vector<std::string> types;
+        for (const auto& type : a->get()) {
+            types.push_back(type.get_type_name());
+        }
+        value.write_strings(types);
+        add(name, AttributeType::VECTOR_STRING, value);
+    } else if (const auto& a = ov::as_type<ov::AttributeAdapter<ov::PartialShape>>(&adapter)) {
+        const auto& shape = a->get();
+        value.write(static_cast<uint8_t>(shape.rank().is_static()));
+        if (shape.rank().is_static()) {
+            value.write_size(shape.size());
+            for (const auto& dim : shape) {
+                value.write(dim.get_interval().get_min_val());
+                value.write(dim.get_interval().get_max_val());
+            }
+        }
+        add(name, AttributeType::PARTIAL_SHAPE, value);
+    } else if (const auto& a = ov::as_type<ov::AttributeAdapter<ov::Dimension>>(&adapter)) {
+        value.write(a->get().get_interval().get_min_val());
+        value.write(a->get().get_interval().get_max_val());
+        add(name, AttributeType::DIMENSION, value);
+    } else if (const auto& a = ov::as_type<ov::AttributeAdapter<std::set<std::string>>>(&adapter)) {
+        value.write_strings(a->get());
+        add(name, AttributeType::STRING_SET, value);
+    } else {
+        OPENVINO_THROW("Unsupported attribute type for serialization: ", name);
+    }
+}
+
+void AttributeWriter::on_adapter(const std::string& name, ov::ValueAccessor<std::shared_ptr<ov::Model>>& adapter) {
+    Buffer value;
+    m_model_writer.write_model(value, *adapter.get());
+    add(name, AttributeType::MODEL, value);
+}
+
+void AttributeWriter::write_string_tensor(
+    const std::string& name,
+    std::shared_ptr<uint8_t> header,
+    size_t header_size,
+    size_t num_elements,
+    const std::function<void(const char*&, size_t&, size_t)>& get_raw_string) {
+    if (name != "value" || m_node_type_name != "Constant") {
+        return;
+    }
+    auto& constant_writer = m_model_writer.get_constant_writer();
+    size_t new_size = 0;
+    size_t inter_size = 0;
+    // header is allocated in AttributeAdapter that has limited life time
+    const auto offset = constant_writer.write(reinterpret_cast<const char*>(header.get()),
+                                              header_size,
+                                              inter_size,
+                                              m_compress_to_fp16,
+                                              m_output_element_type,
+                                              true);
+    new_size += inter_size;
+    for (size_t ind = 0; ind < num_elements; ++ind) {
+        const char* raw_string_ptr;
+        size_t raw_string_size;
+        get_raw_string(raw_string_ptr, raw_string_size, ind);
+        constant_writer.write(raw_string_ptr, raw_string_size, inter_size, m_compress_to_fp16, m_output_element_type);
+        new_size += inter_size;
+    }
+    Buffer value;
+    value.write(static_cast<uint64_t>(offset));
+    value.write(static_cast<uint64_t>(new_size));
+    add(name, AttributeType::CONSTANT_DATA, value);
+}
+}  // namespace
+
+void serialize(std::ostream& topology,
+               ov::util::ConstantWriter& constant_writer,
+               const std::shared_ptr<ov::Model>& model,
+               int64_t version) {
+    OPENVINO_ASSERT(version == supported_ir_version,
+                    "Only IR v",
+                    supported_ir_version,
+                    " is supported by the binary topology, requested ",
+                    version);
+    Buffer buffer;
+    buffer.write_bytes(magic, sizeof(magic));
+    buffer.write(format_version);
+    buffer.write(version);
+    ModelWriter{constant_writer}.write_model(buffer, *model);
+    topology.write(buffer.data().data(), static_cast<std::streamsize>(buffer.data().size()));
+}
+}  // namespace ov::util::binary_topology
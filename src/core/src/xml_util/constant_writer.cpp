@@ -20,6 +20,10 @@ std::streamsize OstreamHashWrapperBin::xsputn(const char* s, std::streamsize n)
     return n;
 }
 
+void OstreamHashWrapperBin::append_hash(uint64_t hash) {
+    m_res = u64_hash_combine(m_res, hash);
+}
+
 ConstantWriter::ConstantWriter(std::ostream& bin_data, bool enable_compression)
     : m_binary_output(bin_data),
       m_enable_compression(enable_compression),
@@ -81,7 +85,7 @@ ConstantWriter::FilePosition ConstantWriter::write(const char* ptr,
             m_hash_to_file_positions.insert({hash, {offset, static_cast<const void*>(ptr)}});
         }
         if (m_write_hash_value) {
-            m_binary_output.get().write(reinterpret_cast<const char*>(&hash), sizeof(uint64_t));
+            write_hash(hash);
         } else {
             m_binary_output.get().write(ptr_to_write, new_size);
         }
@@ -89,6 +93,46 @@ ConstantWriter::FilePosition ConstantWriter::write(const char* ptr,
     return offset;
 }
 
+ConstantWriter::FilePosition ConstantWriter::write(const ov::AlignedBuffer& buffer,
+                                                   size_t& new_size,
+                                                   bool compress_to_fp16,
+                                                   ov::element::Type src_type,
+                                                   bool ptr_is_temporary) {
+    if (!m_write_hash_value || !m_enable_compression || compress_to_fp16) {
+        return write(static_cast<const char*>(buffer.get_ptr()),
+                     buffer.size(),
+                     new_size,
+                     compress_to_fp16,
+                     src_type,
+                     ptr_is_temporary);
+    }
+    const FilePosition offset = m_binary_output.get().tellp() - m_blob_offset;
+    const auto ptr = buffer.get_ptr();
+    new_size = buffer.size();
+    const auto hash = buffer.get_content_hash();
+
+    // the equal constants share the offset as the written data does, so the hash does not depend on the way
+    // the content is hashed
+    auto found = m_content_hash_to_file_positions.equal_range(hash);
+    for (auto it = found.first; it != found.second; ++it) {
+        const auto& [position, other] = it->second;
+        if (other->size() == new_size && memcmp(ptr, other->get_ptr(), new_size) == 0) {
+            return position;
+        }
+    }
+    if (!ptr_is_temporary) {
+        m_content_hash_to_file_positions.insert({hash, {offset, &buffer}});
+    }
+    write_hash(hash);
+    return offset;
+}
+
+void ConstantWriter::write_hash(uint64_t hash) {
+    m_binary_output.get().write(reinterpret_cast<const char*>(&hash), sizeof(uint64_t));
+    // the size of the hash alone does not distinguish the weights
+    static_cast<OstreamHashWrapperBin*>(m_binary_output.get().rdbuf())->append_hash(hash);
+}
+
 std::unique_ptr<char[]> ConstantWriter::compress_data_to_fp16(const char* ptr,
                                                               size_t size,
                                                               ov::element::Type src_type,
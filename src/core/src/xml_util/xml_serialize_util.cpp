@@ -756,10 +756,8 @@ void XmlSerializer::on_adapter(const std::string& name, ov::ValueAccessor<void>&
         }
     } else if (const auto& a = ov::as_type<ov::AttributeAdapter<std::shared_ptr<ov::AlignedBuffer>>>(&adapter)) {
         if (name == "value" && translate_type_name(m_node_type_name) == "Const") {
-            const auto size = a->get()->size();
             size_t new_size = 0lu;
-            int64_t offset = get_constant_write_handler().write(static_cast<const char*>(a->get()->get_ptr()),
-                                                                size,
+            int64_t offset = get_constant_write_handler().write(*a->get(),
                                                                 new_size,
                                                                 m_compress_to_fp16,
                                                                 m_output_element_type,
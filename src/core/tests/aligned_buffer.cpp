@@ -4,7 +4,11 @@
 
 #include "openvino/runtime/aligned_buffer.hpp"
 
+#include <cstring>
+#include <vector>
+
 #include "gtest/gtest.h"
+#include "openvino/runtime/shared_buffer.hpp"
 
 using namespace ov;
 
@@ -33,3 +37,42 @@ TEST(aligned_buffer, move) {
         EXPECT_NE(buffer2.get_ptr(), nullptr);
     }
 }
+
+TEST(aligned_buffer, content_hash) {
+    AlignedBuffer buffer1(100, 64);
+    AlignedBuffer buffer2(100, 64);
+    std::memset(buffer1.get_ptr(), 1, buffer1.size());
+    std::memset(buffer2.get_ptr(), 1, buffer2.size());
+    const auto hash = buffer1.get_content_hash();
+    EXPECT_EQ(hash, buffer2.get_content_hash());
+
+    // the memoized value is kept until it is reset
+    std::memset(buffer2.get_ptr(), 2, buffer2.size());
+    EXPECT_EQ(hash, buffer2.get_content_hash());
+    buffer2.reset_content_hash();
+    EXPECT_NE(hash, buffer2.get_content_hash());
+}
+
+TEST(aligned_buffer, content_hash_of_chunks) {
+    // larger than a single chunk hashed by one thread
+    AlignedBuffer buffer1(40 * 1024 * 1024 + 3, 64);
+    AlignedBuffer buffer2(40 * 1024 * 1024 + 3, 64);
+    std::memset(buffer1.get_ptr(), 1, buffer1.size());
+    std::memset(buffer2.get_ptr(), 1, buffer2.size());
+    EXPECT_EQ(buffer1.get_content_hash(), buffer2.get_content_hash());
+
+    buffer2.get_ptr<char>()[buffer2.size() - 1] = 2;
+    buffer2.reset_content_hash();
+    EXPECT_NE(buffer1.get_content_hash(), buffer2.get_content_hash());
+}
+
+TEST(aligned_buffer, content_hash_of_shared_memory) {
+    // the memory is owned by the vector, the hash is memoized until the writer resets it
+    std::vector<char> data(100, 1);
+    SharedBuffer<std::vector<char>*> buffer(data.data(), data.size(), &data);
+    const auto hash = buffer.get_content_hash();
+    data.back() = 2;
+    EXPECT_EQ(hash, buffer.get_content_hash());
+    buffer.reset_content_hash();
+    EXPECT_NE(hash, buffer.get_content_hash());
+}
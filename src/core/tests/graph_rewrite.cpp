@@ -269,6 +269,24 @@ TEST(GraphRewriteTest, TypeBasedMatcherPassOrder2) {
     ASSERT_EQ(count_ops_of_type<op::v0::Tanh>(f), 1);
 }
 
+TEST(GraphRewriteTest, TypeBasedMatcherPassIndexedWithGeneric) {
+    auto f = get_model();
+
+    NodeVector order;
+    Anchor anchor;
+    auto type_based = anchor.add_matcher<TypeBasedTestPass>();
+    auto generic = anchor.add_matcher<GatherNodesPass>(order);
+    anchor.run_on_model(f);
+
+    // type based pass is applied only to Divide while generic pass is applied to every node
+    EXPECT_EQ(type_based->get_statistics().attempts, 1);
+    EXPECT_EQ(type_based->get_statistics().matches, 1);
+    EXPECT_EQ(type_based->get_statistics().applied, 0);
+    EXPECT_EQ(generic->get_statistics().attempts, f->get_ops().size());
+    EXPECT_EQ(generic->get_statistics().applied, 0);
+    ASSERT_EQ(order, f->get_ordered_ops());
+}
+
 TEST(PassConfigTest, Test1) {
     {
         auto f = get_model();
@@ -3789,6 +3789,106 @@ TEST(constant_folding, disable_constant_folding_check) {
     ASSERT_TRUE(ov::is_type<ov::op::v0::Constant>(reshape2->get_input_node_shared_ptr(1)));
 }
 
+TEST(constant_folding, parallel_folding_of_decompression_subgraphs) {
+    constexpr size_t subgraphs_count = 16;
+    ResultVector results;
+    for (size_t i = 0; i < subgraphs_count; ++i) {
+        auto weights = op::v0::Constant::create(element::u8, Shape{2, 2}, {1, 2, 3, static_cast<int>(i)});
+        auto convert = make_shared<op::v0::Convert>(weights, element::f32);
+        auto zero_point = op::v0::Constant::create(element::f32, Shape{}, {1});
+        auto subtract = make_shared<op::v1::Subtract>(convert, zero_point);
+        auto scale = op::v0::Constant::create(element::f32, Shape{}, {2});
+        auto multiply = make_shared<op::v1::Multiply>(subtract, scale);
+        multiply->set_friendly_name("multiply_" + std::to_string(i));
+        results.push_back(make_shared<op::v0::Result>(multiply));
+    }
+    auto model = make_shared<Model>(results, ParameterVector{});
+
+    // the limit allows to keep only one folded value at once
+    pass::ConstantFolding constant_folding(sizeof(float) * 4);
+    ASSERT_TRUE(constant_folding.run_on_model(model));
+
+    ASSERT_EQ(count_ops_of_type<op::v0::Constant>(model), subgraphs_count);
+    for (size_t i = 0; i < subgraphs_count; ++i) {
+        const auto folded = get_result_constant(model, i);
+        ASSERT_TRUE(folded);
+        EXPECT_EQ(folded->get_friendly_name(), "multiply_" + std::to_string(i));
+        EXPECT_EQ(folded->cast_vector<float>(), (vector<float>{0, 2, 4, 2 * (static_cast<float>(i) - 1)}));
+    }
+
+    const auto& statistics = constant_folding.get_folding_statistics();
+    for (const auto& type_info : {op::v0::Convert::get_type_info_static(),
+                                  op::v1::Subtract::get_type_info_static(),
+                                  op::v1::Multiply::get_type_info_static()}) {
+        ASSERT_TRUE(statistics.count(type_info)) << type_info;
+        EXPECT_EQ(statistics.at(type_info).count, subgraphs_count) << type_info;
+    }
+
+    // the statistics are collected per run, nothing is left to fold
+    ASSERT_FALSE(constant_folding.run_on_model(model));
+    EXPECT_FALSE(constant_folding.get_folding_statistics().count(op::v0::Convert::get_type_info_static()));
+}
+
+TEST(constant_folding, parallel_folding_of_shared_folded_values) {
+    // the folded value of the convert is consumed by both branches and stays alive until both of them are folded
+    auto weights = op::v0::Constant::create(element::u8, Shape{4}, {1, 2, 3, 4});
+    auto convert = make_shared<op::v0::Convert>(weights, element::f32);
+    auto one = op::v0::Constant::create(element::f32, Shape{}, {1});
+    auto add = make_shared<op::v1::Add>(convert, one);
+    auto multiply = make_shared<op::v1::Multiply>(convert, add);
+    auto subtract = make_shared<op::v1::Subtract>(multiply, convert);
+    subtract->set_friendly_name("subtract");
+    auto model = make_shared<Model>(ResultVector{make_shared<op::v0::Result>(subtract)}, ParameterVector{});
+
+    // the limit is smaller than the alive values, the nodes are folded one by one
+    pass::ConstantFolding constant_folding(sizeof(float) * 4);
+    ASSERT_TRUE(constant_folding.run_on_model(model));
+
+    ASSERT_EQ(count_ops_of_type<op::v0::Constant>(model), 1);
+    const auto folded = get_result_constant(model);
+    ASSERT_TRUE(folded);
+    EXPECT_EQ(folded->get_friendly_name(), "subtract");
+    EXPECT_EQ(folded->cast_vector<float>(), (vector<float>{1, 4, 9, 16}));
+}
+
+TEST(constant_folding, parallel_folding_of_nodes_sharing_constant) {
+    // the nodes of one batch share the constant, ConvertLike can't be evaluated and its constant_fold connects a
+    // temporary Convert to the constant, so it is folded after the parallel evaluation of the batch
+    constexpr size_t branches_count = 8;
+    auto data = op::v0::Constant::create(element::i32, Shape{4}, {1, 2, 3, 4});
+    auto like = op::v0::Constant::create(element::f32, Shape{}, {0});
+    ResultVector results;
+    for (size_t i = 0; i < branches_count; ++i) {
+        results.push_back(make_shared<op::v0::Result>(make_shared<op::v1::ConvertLike>(data, like)));
+        auto addend = op::v0::Constant::create(element::i32, Shape{}, {static_cast<int>(i)});
+        results.push_back(make_shared<op::v0::Result>(make_shared<op::v1::Add>(data, addend)));
+    }
+    auto shape = op::v0::Constant::create(element::i64, Shape{2}, {2, 2});
+    results.push_back(make_shared<op::v0::Result>(make_shared<op::v1::Reshape>(data, shape, false)));
+    auto model = make_shared<Model>(results, ParameterVector{});
+
+    pass::ConstantFolding constant_folding;
+    ASSERT_TRUE(constant_folding.run_on_model(model));
+
+    for (size_t i = 0; i < branches_count; ++i) {
+        const auto convert_like = get_result_constant(model, 2 * i);
+        ASSERT_TRUE(convert_like);
+        EXPECT_EQ(convert_like->get_element_type(), element::f32);
+        EXPECT_EQ(convert_like->cast_vector<float>(), (vector<float>{1, 2, 3, 4}));
+        const auto add = get_result_constant(model, 2 * i + 1);
+        ASSERT_TRUE(add);
+        const auto addend = static_cast<int>(i);
+        EXPECT_EQ(add->cast_vector<int>(), (vector<int>{1 + addend, 2 + addend, 3 + addend, 4 + addend}));
+    }
+    // the reshape is folded to a view of the shared data
+    const auto reshape = get_result_constant(model, 2 * branches_count);
+    ASSERT_TRUE(reshape);
+    EXPECT_EQ(reshape->get_shape(), (Shape{2, 2}));
+    EXPECT_EQ(reshape->get_data_ptr(), data->get_data_ptr());
+    // no temporary node is left connected to the shared constant
+    EXPECT_TRUE(data->output(0).get_target_inputs().empty());
+}
+
 TEST(constant_folding, constant_loop) {
     auto X = make_shared<op::v0::Constant>(element::f32, Shape{2, 1, 3}, std::vector<int64_t>{0, 1, 2, 3, 4, 5});
     auto Y = make_shared<op::v0::Constant>(element::f32, Shape{1, 1, 3}, std::vector<int64_t>{1, 2, 3});
@@ -163,6 +163,13 @@ TEST_P(SerializationTest, CompareFunctionsByPath) {
     });
 }
 
+TEST_P(SerializationTest, CompareFunctionsBinaryTopology) {
+    m_out_xml_path = m_out_xml_path.substr(0, m_out_xml_path.rfind('.')) + ".ovbt";
+    CompareSerialized([this](const std::shared_ptr<ov::Model>& m) {
+        ov::pass::Serialize(m_out_xml_path, m_out_bin_path).run_on_model(m);
+    });
+}
+
 TEST_P(SerializationTest, SaveModelByPath) {
     const auto out_xml_path = std::filesystem::path(m_out_xml_path);
     CompareSerialized([&out_xml_path](const auto& m) {
@@ -0,0 +1,247 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <limits>
+#include <sstream>
+
+#include "common_test_utils/test_assertions.hpp"
+#include "openvino/core/except.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/opsets/opset.hpp"
+#include "openvino/xml_util/binary_topology.hpp"
+#include "openvino/xml_util/binary_topology_deserialize_util.hpp"
+#include "openvino/xml_util/constant_writer.hpp"
+
+namespace ov::test {
+
+using namespace ov::util::binary_topology;
+
+namespace {
+std::shared_ptr<ov::AlignedBuffer> make_buffer(const std::string& data) {
+    auto buffer = std::make_shared<ov::AlignedBuffer>(data.size());
+    if (!data.empty()) {
+        std::memcpy(buffer->get_ptr(), data.data(), data.size());
+    }
+    return buffer;
+}
+
+std::shared_ptr<ov::Model> read(const std::string& topology, const std::string& weights) {
+    const std::unordered_map<std::string, ov::OpSet> opsets{{"opset1", ov::get_opset1()}};
+    const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr> extensions;
+    std::unordered_map<std::string, std::shared_ptr<ov::op::util::Variable>> variables;
+    return deserialize(make_buffer(topology), make_buffer(weights), opsets, extensions, variables);
+}
+
+// the value as stored in the binary topology
+template <class T>
+std::string to_bytes(T value) {
+    value = to_little_endian(value);
+    return {reinterpret_cast<const char*>(&value), sizeof(T)};
+}
+
+template <class T>
+void overwrite(std::string& data, size_t offset, T value) {
+    data.replace(offset, sizeof(T), to_bytes(value));
+}
+
+// Writes the topology by hand to store what the serializer never writes
+class TopologyBuilder {
+public:
+    TopologyBuilder() {
+        m_data.append(magic, sizeof(magic));
+        put(format_version).put(supported_ir_version).str("model");
+        // the number of the nodes is known when the topology is finished
+        m_node_count_offset = m_data.size();
+        count(0);
+    }
+
+    template <class T>
+    TopologyBuilder& put(T value) {
+        m_data += to_bytes(value);
+        return *this;
+    }
+
+    TopologyBuilder& str(const std::string& value) {
+        count(value.size());
+        m_data += value;
+        return *this;
+    }
+
+    TopologyBuilder& count(size_t value) {
+        return put(static_cast<uint32_t>(value));
+    }
+
+    /// @brief the node of opset1 without rt_info and tensor names, the attributes are added by attribute()
+    TopologyBuilder& node(const std::string& type,
+                          const std::vector<std::pair<uint32_t, uint32_t>>& inputs,
+                          size_t outputs,
+                          size_t attributes = 0) {
+        str(type).str("opset1").str(type + "_" + std::to_string(m_nodes++));
+        count(inputs.size());
+        for (const auto& [node, output] : inputs) {
+            put(node).put(output).count(0);
+        }
+        count(outputs);
+        for (size_t i = 0; i < outputs; ++i) {
+            count(0).count(0);
+        }
+        return count(0).count(attributes);
+    }
+
+    TopologyBuilder& attribute(const std::string& name, AttributeType type, const std::string& value) {
+        str(name).put(type).count(value.size());
+        m_data += value;
+        return *this;
+    }
+
+    /// @brief the indices of the parameters and the results, no sinks and rt_info
+    std::string finish(const std::vector<uint32_t>& parameters, const std::vector<uint32_t>& results) {
+        for (const auto& ids : {parameters, results}) {
+            count(ids.size());
+            for (const auto id : ids) {
+                put(id);
+            }
+        }
+        count(0).count(0);
+        overwrite(m_data, m_node_count_offset, static_cast<uint32_t>(m_nodes));
+        return m_data;
+    }
+
+private:
+    std::string m_data;
+    size_t m_node_count_offset = 0;
+    size_t m_nodes = 0;
+};
+
+// the model with the f32 constant of the shape [2] stored in the weights at the offset
+std::string constant_model(uint64_t offset, uint64_t size) {
+    return TopologyBuilder()
+        .node("Constant", {}, 1, 3)
+        .attribute("element_type", AttributeType::STRING, to_bytes(uint32_t{3}) + "f32")
+        .attribute("shape", AttributeType::VECTOR_INT64, to_bytes(uint32_t{1}) + to_bytes(int64_t{2}))
+        .attribute("value", AttributeType::CONSTANT_DATA, to_bytes(offset) + to_bytes(size))
+        .node("Result", {{0, 0}}, 0)
+        .finish({}, {1});
+}
+}  // namespace
+
+class BinaryTopologyTest : public testing::Test {
+protected:
+    std::string m_topology;
+    std::string m_weights;
+
+    void SetUp() override {
+        auto parameter = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{2});
+        auto constant = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{2}, {1.0f, 2.0f});
+        auto add = std::make_shared<ov::op::v1::Add>(parameter, constant);
+        auto result = std::make_shared<ov::op::v0::Result>(add);
+        auto model = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{parameter}, "model");
+
+        std::stringstream topology;
+        std::stringstream weights;
+        ov::util::ConstantWriter constant_writer(weights);
+        serialize(topology, constant_writer, model, supported_ir_version);
+        m_topology = topology.str();
+        m_weights = weights.str();
+    }
+};
+
+TEST_F(BinaryTopologyTest, ReadsSerializedModel) {
+    std::shared_ptr<ov::Model> model;
+    OV_ASSERT_NO_THROW(model = read(m_topology, m_weights));
+    EXPECT_EQ(model->get_friendly_name(), "model");
+    EXPECT_EQ(model->get_ops().size(), 4u);
+}
+
+TEST_F(BinaryTopologyTest, IsStoredInLittleEndian) {
+    uint32_t version;
+    std::memcpy(&version, m_topology.data() + sizeof(magic), sizeof(version));
+    const auto* bytes = reinterpret_cast<const uint8_t*>(&version);
+    EXPECT_EQ(bytes[0], format_version);
+    EXPECT_EQ(bytes[1], 0);
+    EXPECT_EQ(read_header(m_topology.data()).ir_version, supported_ir_version);
+}
+
+TEST_F(BinaryTopologyTest, TruncatedTopologyThrows) {
+    for (size_t size = 0; size < m_topology.size(); ++size) {
+        EXPECT_THROW(read(m_topology.substr(0, size), m_weights), ov::Exception) << "size " << size;
+    }
+}
+
+TEST_F(BinaryTopologyTest, BadHeaderThrows) {
+    auto bad_magic = m_topology;
+    bad_magic[0] = 'X';
+    EXPECT_THROW(read(bad_magic, m_weights), ov::Exception);
+
+    auto bad_version = m_topology;
+    overwrite(bad_version, sizeof(magic), format_version + 1);
+    EXPECT_THROW(read(bad_version, m_weights), ov::Exception);
+
+    auto bad_ir_version = m_topology;
+    overwrite(bad_ir_version, sizeof(magic) + sizeof(uint32_t), int64_t{10});
+    EXPECT_THROW(read(bad_ir_version, m_weights), ov::Exception);
+}
+
+TEST_F(BinaryTopologyTest, CorruptLengthsThrow) {
+    auto name_size = m_topology;
+    overwrite(name_size, header_size, std::numeric_limits<uint32_t>::max());
+    EXPECT_THROW(read(name_size, m_weights), ov::Exception);
+
+    // the number of the nodes follows the model name
+    auto node_count = m_topology;
+    overwrite(node_count, header_size + sizeof(uint32_t) + std::string("model").size(), uint32_t{1} << 30);
+    EXPECT_THROW(read(node_count, m_weights), ov::Exception);
+}
+
+TEST_F(BinaryTopologyTest, ValidHandWrittenTopology) {
+    const auto topology = TopologyBuilder().node("Parameter", {}, 1).node("Result", {{0, 0}}, 0).finish({0}, {1});
+    OV_ASSERT_NO_THROW(read(topology, m_weights));
+    OV_ASSERT_NO_THROW(read(constant_model(0, 8), m_weights));
+}
+
+TEST_F(BinaryTopologyTest, OutOfRangeIndicesThrow) {
+    using testing::HasSubstr;
+    // the input of an unknown node
+    auto topology = TopologyBuilder().node("Parameter", {}, 1).node("Result", {{7, 0}}, 0).finish({0}, {1});
+    OV_EXPECT_THROW(read(topology, m_weights), ov::Exception, HasSubstr("Attempt to access node 7"));
+    // the unknown output of the input node
+    topology = TopologyBuilder().node("Parameter", {}, 1).node("Result", {{0, 3}}, 0).finish({0}, {1});
+    OV_EXPECT_THROW(read(topology, m_weights), ov::Exception, HasSubstr("has incorrect input with index 0"));
+    // the unknown result and the result used as the parameter
+    topology = TopologyBuilder().node("Parameter", {}, 1).node("Result", {{0, 0}}, 0).finish({0}, {9});
+    OV_EXPECT_THROW(read(topology, m_weights), ov::Exception, HasSubstr("Attempt to access node 9"));
+    topology = TopologyBuilder().node("Parameter", {}, 1).node("Result", {{0, 0}}, 0).finish({1}, {1});
+    OV_EXPECT_THROW(read(topology, m_weights), ov::Exception, HasSubstr("Model input is not a Parameter"));
+}
+
+TEST_F(BinaryTopologyTest, CorruptConstantDataThrows) {
+    using testing::HasSubstr;
+    // the weights are 8 bytes
+    OV_EXPECT_THROW(read(constant_model(4, 8), m_weights), ov::Exception, HasSubstr("Incorrect weights"));
+    OV_EXPECT_THROW(read(constant_model(std::numeric_limits<uint64_t>::max(), 8), m_weights),
+                    ov::Exception,
+                    HasSubstr("Incorrect weights"));
+    // the data is smaller than the shape
+    OV_EXPECT_THROW(read(constant_model(0, 4), m_weights),
+                    ov::Exception,
+                    HasSubstr("Attribute and shape size are inconsistent"));
+}
+
+TEST(BinaryTopologySerializeTest, OnlyIRv11IsSupported) {
+    auto parameter = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{2});
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(parameter)},
+                                             ov::ParameterVector{parameter});
+    std::stringstream topology;
+    std::stringstream weights;
+    ov::util::ConstantWriter constant_writer(weights);
+    EXPECT_THROW(serialize(topology, constant_writer, model, 10), ov::Exception);
+}
+
+}  // namespace ov::test
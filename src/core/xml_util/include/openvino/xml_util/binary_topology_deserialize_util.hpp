@@ -0,0 +1,30 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "openvino/core/model.hpp"
+#include "openvino/core/op_extension.hpp"
+#include "openvino/op/util/variable.hpp"
+#include "openvino/opsets/opset.hpp"
+#include "openvino/runtime/aligned_buffer.hpp"
+
+namespace ov::util::binary_topology {
+
+/// @brief Creates the model from the binary topology written by ov::util::binary_topology::serialize.
+/// The strings of the topology are not copied until the node is created and the attributes are decoded only when the
+/// operation visits them, the constants share the memory of the weights.
+/// @param topology buffer with the binary topology, it must start with the header
+std::shared_ptr<ov::Model> deserialize(
+    const std::shared_ptr<ov::AlignedBuffer>& topology,
+    const std::shared_ptr<ov::AlignedBuffer>& weights,
+    const std::unordered_map<std::string, ov::OpSet>& opsets,
+    const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions,
+    std::unordered_map<std::string, std::shared_ptr<ov::op::util::Variable>>& variables);
+
+}  // namespace ov::util::binary_topology
@@ -0,0 +1,598 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/xml_util/binary_topology_deserialize_util.hpp"
+
+#include <cstring>
+#include <map>
+#include <optional>
+#include <set>
+#include <string_view>
+#include <type_traits>
+#include <unordered_set>
+
+#include "itt.hpp"
+#include "openvino/core/descriptor_tensor.hpp"
+#include "openvino/core/rt_info/weightless_caching_attributes.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/loop.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/util/assign_base.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
+#include "openvino/op/util/read_value_base.hpp"
+#include "openvino/runtime/shared_buffer.hpp"
+#include "openvino/runtime/string_aligned_buffer.hpp"
+#include "openvino/xml_util/binary_topology.hpp"
+#include "transformations/rt_info/attributes.hpp"
+
+namespace ov::util::binary_topology {
+namespace {
+// Bounds-checked cursor over the binary topology, the strings are read as views of the topology buffer. The corrupted
+// sizes and counts are detected before anything is allocated for them.
+class Reader {
+public:
+    Reader(const char* data, size_t size) : m_data(data), m_size(size) {}
+
+    template <class T>
+    T read() {
+        static_assert(std::is_trivially_copyable_v<T>);
+        T value;
+        std::memcpy(&value, advance(sizeof(T)), sizeof(T));
+        return to_little_endian(value);
+    }
+
+    size_t read_size() {
+        return read<uint32_t>();
+    }
+
+    /// @brief reads the number of the elements which take at least min_element_size bytes each
+    size_t read_count(size_t min_element_size) {
+        const auto count = read_size();
+        OPENVINO_ASSERT(count <= (m_size - m_pos) / min_element_size, "The binary topology is truncated");
+        return count;
+    }
+
+    std::string_view read_string_view() {
+        const auto size = read_size();
+        return {advance(size), size};
+    }
+
+    std::string read_string() {
+        return std::string{read_string_view()};
+    }
+
+    template <class T>
+    std::vector<T> read_vector() {
+        std::vector<T> values(read_count(sizeof(T)));
+        for (auto& value : values) {
+            value = read<T>();
+        }
+        return values;
+    }
+
+    template <class Container>
+    Container read_strings() {
+        Container values;
+        const auto count = read_count(sizeof(uint32_t));
+        for (size_t i = 0; i < count; ++i) {
+            values.insert(values.end(), read_string());
+        }
+        return values;
+    }
+
+    /// @brief returns the reader of the next bytes and skips them
+    Reader read_block(size_t size) {
+        return {advance(size), size};
+    }
+
+private:
+    const char* advance(size_t size) {
+        OPENVINO_ASSERT(size <= m_size - m_pos, "The binary topology is truncated");
+        const auto data = m_data + m_pos;
+        m_pos += size;
+        return data;
+    }
+
+    const char* m_data;
+    size_t m_size;
+    size_t m_pos = 0;
+};
+
+class ModelReader;
+
+// Finds the attributes visited by the operation in the records of the node, the attributes missing in the records keep
+// their default values as in IR XML
+class AttributeReader : public ov::AttributeVisitor {
+public:
+    AttributeReader(ModelReader& model_reader, Reader& reader) : m_model_reader(model_reader) {
+        const auto count = reader.read_size();
+        for (size_t i = 0; i < count; ++i) {
+            const auto name = reader.read_string_view();
+            const auto type = reader.read<AttributeType>();
+            const auto size = reader.read_size();
+            m_records.insert_or_assign(name, Record{type, reader.read_block(size)});
+        }
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<void>& adapter) override;
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<bool>& adapter) override {
+        if (auto value = find(name, AttributeType::BOOL)) {
+            adapter.set(value->read<uint8_t>() != 0);
+        }
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::string>& adapter) override {
+        if (auto value = find(name, AttributeType::STRING)) {
+            adapter.set(value->read_string());
+        }
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<int64_t>& adapter) override {
+        if (auto value = find(name, AttributeType::INT64)) {
+            adapter.set(value->read<int64_t>());
+        }
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<double>& adapter) override {
+        if (auto value = find(name, AttributeType::DOUBLE)) {
+            adapter.set(value->read<double>());
+        }
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int32_t>>& adapter) override {
+        if (auto value = find(name, AttributeType::VECTOR_INT32)) {
+            adapter.set(value->read_vector<int32_t>());
+        }
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        if (auto value = find(name, AttributeType::VECTOR_INT64)) {
+            adapter.set(value->read_vector<int64_t>());
+        }
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        if (auto value = find(name, AttributeType::VECTOR_UINT64)) {
+            adapter.set(value->read_vector<uint64_t>());
+        }
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<float>>& adapter) override {
+        if (auto value = find(name, AttributeType::VECTOR_FLOAT)) {
+            adapter.set(value->read_vector<float>());
+        }
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<std::string>>& adapter) override {
+        if (auto value = find(name, AttributeType::VECTOR_STRING)) {
+            adapter.set(value->read_strings<std::vector<std::string>>());
+        }
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::shared_ptr<ov::Model>>& adapter) override;
+
+    /// @brief offset and size of the constant data in the weights if the operation has read it
+    const std::optional<std::pair<uint64_t, uint64_t>>& get_constant_data() const {
+        return m_constant_data;
+    }
+
+private:
+    struct Record {
+        AttributeType type;
+        Reader value;
+    };
+
+    std::optional<Reader> find(const std::string& name, AttributeType type) const {
+        const auto it = m_records.find(name);
+        if (it == m_records.end()) {
+            return {};
+        }
+        OPENVINO_ASSERT(it->second.type == type,
+                        "Error binary topology reading. Attribute ",
+                        name,
+                        " has unexpected type ",
+                        static_cast<int>(it->second.type));
+        return it->second.value;
+    }
+
+    char* get_constant_data(Reader& value);
+
+    ModelReader& m_model_reader;
+    std::unordered_map<std::string_view, Record> m_records;
+    std::optional<std::pair<uint64_t, uint64_t>> m_constant_data;
+};
+
+class ModelReader {
+public:
+    ModelReader(const std::shared_ptr<ov::AlignedBuffer>& weights,
+                const std::unordered_map<std::string, ov::OpSet>& opsets,
+                const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions,
+                std::unordered_map<std::string, std::shared_ptr<ov::op::util::Variable>>& variables)
+        : m_weights(weights),
+          m_opsets(opsets),
+          m_extensions(extensions),
+          m_variables(variables) {}
+
+    std::shared_ptr<ov::Model> read_model(Reader& reader) {
+        const auto name = reader.read_string();
+        const auto node_count = reader.read_count(sizeof(uint32_t));
+        std::vector<std::shared_ptr<ov::Node>> nodes;
+        nodes.reserve(node_count);
+        for (size_t i = 0; i < node_count; ++i) {
+            nodes.push_back(read_node(reader, nodes));
+        }
+
+        ov::ParameterVector parameters;
+        for (size_t i = 0, count = reader.read_count(sizeof(uint32_t)); i < count; ++i) {
+            auto parameter = ov::as_type_ptr<ov::op::v0::Parameter>(get_node(nodes, reader.read<uint32_t>()));
+            OPENVINO_ASSERT(parameter, "Error binary topology reading. Model input is not a Parameter");
+            parameters.push_back(std::move(parameter));
+        }
+        ov::ResultVector results;
+        for (size_t i = 0, count = reader.read_count(sizeof(uint32_t)); i < count; ++i) {
+            auto result = ov::as_type_ptr<ov::op::v0::Result>(get_node(nodes, reader.read<uint32_t>()));
+            OPENVINO_ASSERT(result, "Error binary topology reading. Model output is not a Result");
+            results.push_back(std::move(result));
+        }
+        ov::SinkVector sinks;
+        for (size_t i = 0, count = reader.read_count(sizeof(uint32_t)); i < count; ++i) {
+            auto sink = ov::as_type_ptr<ov::op::Sink>(get_node(nodes, reader.read<uint32_t>()));
+            OPENVINO_ASSERT(sink, "Error binary topology reading. Model sink is not a Sink");
+            sinks.push_back(std::move(sink));
+        }
+
+        auto model = std::make_shared<ov::Model>(results, sinks, parameters, name);
+        std::map<std::string, std::shared_ptr<ov::Node>> variable_id_to_read_value;
+        for (const auto& node : nodes) {
+            if (const auto& read_value = ov::as_type_ptr<ov::op::util::ReadValueBase>(node)) {
+                variable_id_to_read_value[read_value->get_variable_id()] = read_value;
+            }
+        }
+        for (const auto& sink : sinks) {
+            if (const auto& assign = ov::as_type_ptr<ov::op::util::AssignBase>(sink)) {
+                const auto read_value = variable_id_to_read_value.find(assign->get_variable_id());
+                if (read_value != variable_id_to_read_value.end()) {
+                    assign->add_control_dependency(read_value->second);
+                }
+            }
+        }
+        read_rt_info(reader, model->get_rt_info());
+        return model;
+    }
+
+    void read_rt_info(Reader& reader, ov::AnyMap& rt_info) {
+        const auto count = reader.read_size();
+        for (size_t i = 0; i < count; ++i) {
+            const auto type = reader.read<RtInfoType>();
+            const auto key = reader.read_string();
+            switch (type) {
+            case RtInfoType::STRING:
+                rt_info[key] = reader.read_string();
+                break;
+            case RtInfoType::MAP: {
+                ov::AnyMap map;
+                read_rt_info(reader, map);
+                rt_info[key] = std::move(map);
+                break;
+            }
+            case RtInfoType::RUNTIME_ATTRIBUTE: {
+                const auto version = reader.read_string();
+                AttributeReader visitor(*this, reader);
+                const auto type_info = ov::DiscreteTypeInfo(key.c_str(), version.c_str());
+                auto attribute = m_attributes_factory.create_by_type_info(type_info);
+                // As runtime attributes are optional, so we skip attribute if it is unknown to avoid exception
+                // when loading new model with new attribute in old OV version.
+                if (!attribute.empty()) {
+                    OPENVINO_ASSERT(attribute.is<ov::RuntimeAttribute>(),
+                                    "Attribute: ",
+                                    key,
+                                    " is not recognized as runtime attribute");
+                    OPENVINO_ASSERT(attribute.as<ov::RuntimeAttribute>().visit_attributes(visitor),
+                                    "VisitAttributes is not supported for: ",
+                                    key,
+                                    " attribute");
+                    OPENVINO_ASSERT(rt_info.emplace(type_info, attribute).second,
+                                    "multiple rt_info attributes are detected: ",
+                                    key);
+                }
+                break;
+            }
+            default:
+                OPENVINO_THROW("Error binary topology reading. Unknown rt_info type ", static_cast<int>(type));
+            }
+        }
+    }
+
+    const std::shared_ptr<ov::AlignedBuffer>& get_weights() const {
+        return m_weights;
+    }
+
+    std::shared_ptr<ov::op::util::Variable> get_variable(const std::string& variable_id) {
+        auto& variable = m_variables[variable_id];
+        if (!variable) {
+            variable = std::make_shared<ov::op::util::Variable>(
+                ov::op::util::VariableInfo{ov::PartialShape::dynamic(), ov::element::dynamic, variable_id});
+        }
+        return variable;
+    }
+
+private:
+    static const std::shared_ptr<ov::Node>& get_node(const std::vector<std::shared_ptr<ov::Node>>& nodes, size_t id) {
+        OPENVINO_ASSERT(id < nodes.size(), "Attempt to access node ", id, " that not in graph.");
+        return nodes[id];
+    }
+
+    std::shared_ptr<ov::Node> read_node(Reader& reader, const std::vector<std::shared_ptr<ov::Node>>& nodes) {
+        // DiscreteTypeInfo keeps the pointers to the type name and the version
+        const auto type_name = reader.read_string();
+        const auto version = reader.read_string();
+        const auto name = reader.read_string_view();
+
+        ov::OutputVector inputs(reader.read_count(sizeof(uint32_t)));
+        std::vector<ov::RTMap> inputs_rt_info(inputs.size());
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            const auto& source = get_node(nodes, reader.read<uint32_t>());
+            const auto output_index = reader.read<uint32_t>();
+            OPENVINO_ASSERT(output_index < source->get_output_size(),
+                            type_name,
+                            " layer ",
+                            name,
+                            " has incorrect input with index ",
+                            i,
+                            "!");
+            inputs[i] = source->output(output_index);
+            read_rt_info(reader, inputs_rt_info[i]);
+        }
+
+        std::vector<std::unordered_set<std::string>> outputs_names(reader.read_count(sizeof(uint32_t)));
+        std::vector<ov::RTMap> outputs_rt_info(outputs_names.size());
+        for (size_t i = 0; i < outputs_names.size(); ++i) {
+            outputs_names[i] = reader.read_strings<std::unordered_set<std::string>>();
+            read_rt_info(reader, outputs_rt_info[i]);
+        }
+
+        ov::RTMap rt_info;
+        read_rt_info(reader, rt_info);
+
+        AttributeReader visitor(*this, reader);
+        std::shared_ptr<ov::Node> node;
+        const ov::DiscreteTypeInfo type(type_name.c_str(), version.c_str());
+        if (const auto extension = m_extensions.find(type); extension != m_extensions.end()) {
+            node = extension->second->create(inputs, visitor).at(0).get_node_shared_ptr();
+        } else if (const auto opset = m_opsets.find(version); opset != m_opsets.end()) {
+            node = std::shared_ptr<ov::Node>(opset->second.create_insensitive(type_name));
+            OPENVINO_ASSERT(node, "Opset ", version, " doesn't contain the operation with type: ", type_name);
+            // Share Weights form constant blob
+            if (auto constant = ov::as_type_ptr<ov::op::v0::Constant>(node)) {
+                constant->alloc_buffer_on_visit_attributes(false);
+            }
+            node->set_arguments(inputs);
+            if (node->visit_attributes(visitor)) {
+                node->constructor_validate_and_infer_types();
+            }
+            // To be sure that all default values will be initialized:
+            node = node->clone_with_new_inputs(node->input_values());
+        }
+        OPENVINO_ASSERT(node, "Cannot create ", type_name, " layer ", name, " from unsupported opset: ", version);
+
+        if (const auto& constant_data = visitor.get_constant_data()) {
+            node->get_rt_info().emplace(ov::WeightlessCacheAttribute::get_type_info_static(),
+                                        ov::WeightlessCacheAttribute(static_cast<size_t>(constant_data->second),
+                                                                     static_cast<size_t>(constant_data->first),
+                                                                     node->get_output_element_type(0)));
+        }
+        node->set_friendly_name(std::string{name});
+        node->get_rt_info().insert(rt_info.begin(), rt_info.end());
+        for (size_t i = 0; i < inputs_rt_info.size() && i < node->get_input_size(); ++i) {
+            node->input(i).get_rt_info().insert(inputs_rt_info[i].begin(), inputs_rt_info[i].end());
+        }
+        for (size_t i = 0; i < outputs_rt_info.size() && i < node->get_output_size(); ++i) {
+            node->output(i).get_rt_info().insert(outputs_rt_info[i].begin(), outputs_rt_info[i].end());
+        }
+
+        if (auto result = ov::as_type<ov::op::v0::Result>(node.get())) {
+            // If the model has no dedicated output names for Result node (model output), assume all names from parent
+            // node are Result's (model's) tensor names.
+            if (outputs_names.empty() || outputs_names[0].empty()) {
+                descriptor::add_not_parameter_names(result->get_output_tensor(0), result->get_input_tensor(0));
+            } else {
+                result->get_output_tensor(0).set_names(outputs_names[0]);
+            }
+        } else {
+            for (size_t i = 0; i < outputs_names.size() && i < node->get_output_size(); ++i) {
+                if (!outputs_names[i].empty()) {
+                    node->get_output_tensor(i).set_names(outputs_names[i]);
+                }
+            }
+        }
+        return node;
+    }
+
+    std::shared_ptr<ov::AlignedBuffer> m_weights;
+    const std::unordered_map<std::string, ov::OpSet>& m_opsets;
+    const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& m_extensions;
+    std::unordered_map<std::string, std::shared_ptr<ov::op::util::Variable>>& m_variables;
+    ov::pass::Attributes m_attributes_factory;
+};
+
+void AttributeReader::on_adapter(const std::string& name, ov::ValueAccessor<void>& adapter) {
+    using InputDescriptions = std::vector<std::shared_ptr<ov::op::util::MultiSubGraphOp::InputDescription>>;
+    using OutputDescriptions = std::vector<std::shared_ptr<ov::op::util::MultiSubGraphOp::OutputDescription>>;
+    const auto record = m_records.find(name);
+    if (record == m_records.end()) {
+        return;
+    }
+
+    if (auto a = ov::as_type<ov::AttributeAdapter<InputDescriptions>>(&adapter)) {
+        auto value = *find(name, AttributeType::INPUT_DESCRIPTIONS);
+        InputDescriptions descriptions(value.read_count(sizeof(InputDescriptionType)));
+        for (auto& description : descriptions) {
+            const auto type = value.read<InputDescriptionType>();
+            const auto input_index = value.read<uint64_t>();
+            const auto body_parameter_index = value.read<uint64_t>();
+            if (type == InputDescriptionType::SLICE) {
+                const auto start = value.read<int64_t>();
+                const auto stride = value.read<int64_t>();
+                const auto part_size = value.read<int64_t>();
+                const auto end = value.read<int64_t>();
+                const auto axis = value.read<int64_t>();
+                description =
+                    std::make_shared<ov::op::util::MultiSubGraphOp::SliceInputDescription>(input_index,
+                                                                                           body_parameter_index,
+                                                                                           start,
+                                                                                           stride,
+                                                                                           part_size,
+                                                                                           end,
+                                                                                           axis);
+            } else if (type == InputDescriptionType::MERGED) {
+                description = std::make_shared<ov::op::util::MultiSubGraphOp::MergedInputDescription>(
+                    input_index,
+                    body_parameter_index,
+                    value.read<uint64_t>());
+            } else if (type == InputDescriptionType::INVARIANT) {
+                description =
+                    std::make_shared<ov::op::util::MultiSubGraphOp::InvariantInputDescription>(input_index,
+                                                                                               body_parameter_index);
+            } else {
+                OPENVINO_THROW("Error binary topology reading. Unknown input description of ", name);
+            }
+        }
+        a->set(descriptions);
+    } else if (auto a = ov::as_type<ov::AttributeAdapter<OutputDescriptions>>(&adapter)) {
+        auto value = *find(name, AttributeType::OUTPUT_DESCRIPTIONS);
+        OutputDescriptions descriptions(value.read_count(sizeof(OutputDescriptionType)));
+        for (auto& description : descriptions) {
+            const auto type = value.read<OutputDescriptionType>();
+            const auto body_value_index = value.read<uint64_t>();
+            const auto output_index = value.read<uint64_t>();
+            if (type == OutputDescriptionType::CONCAT) {
+                const auto start = value.read<int64_t>();
+                const auto stride = value.read<int64_t>();
+                const auto part_size = value.read<int64_t>();
+                const auto end = value.read<int64_t>();
+                const auto axis = value.read<int64_t>();
+                description = std::make_shared<ov::op::util::MultiSubGraphOp::ConcatOutputDescription>(body_value_index,
+                                                                                                      output_index,
+                                                                                                      start,
+                                                                                                      stride,
+                                                                                                      part_size,
+                                                                                                      end,
+                                                                                                      axis);
+            } else if (type == OutputDescriptionType::BODY) {
+                description = std::make_shared<ov::op::util::MultiSubGraphOp::BodyOutputDescription>(
+                    body_value_index,
+                    output_index,
+                    value.read<int64_t>());
+            } else {
+                OPENVINO_THROW("Error binary topology reading. Unknown output description of ", name);
+            }
+        }
+        a->set(descriptions);
+    } else if (auto a = ov::as_type<ov::AttributeAdapter<ov::op::v5::Loop::SpecialBodyPorts>>(&adapter)) {
+        auto value = *find(name, AttributeType::SPECIAL_BODY_PORTS);
+        const auto current_iteration_input_idx = value.read<int64_t>();
+        a->set({current_iteration_input_idx, value.read<int64_t>()});
+    } else if (auto a = ov::as_type<ov::AttributeAdapter<std::shared_ptr<ov::op::util::Variable>>>(&adapter)) {
+        auto value = *find(name, AttributeType::VARIABLE);
+        a->set(m_model_reader.get_variable(value.read_string()));
+    } else if (auto a = ov::as_type<ov::AttributeAdapter<std::shared_ptr<ov::AlignedBuffer>>>(&adapter)) {
+        auto value = *find(name, AttributeType::CONSTANT_DATA);
+        const auto data = get_constant_data(value);
+        const auto size = static_cast<size_t>(m_constant_data->second);
+        auto element_type = find("element_type", AttributeType::STRING);
+        OPENVINO_ASSERT(element_type, "Error binary topology reading. No element type of the constant ", name);
+        const auto el_type = ov::element::Type(element_type->read_string());
+        if (el_type == ov::element::string) {
+            a->set(ov::AttributeAdapter<std::shared_ptr<ov::StringAlignedBuffer>>::unpack_string_tensor(data, size));
+        } else {
+            auto shape = find("shape", AttributeType::VECTOR_INT64);
+            OPENVINO_ASSERT(shape, "Error binary topology reading. No shape of the constant ", name);
+            const auto expected_size = (ov::shape_size(shape->read_vector<int64_t>()) * el_type.bitwidth() + 7) >> 3;
+            OPENVINO_ASSERT(size >= expected_size,
+                            "Attribute and shape size are inconsistent for Constant op! ",
+                            size,
+                            ", ",
+                            expected_size);
+            a->set(std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(
+                data,
+                size,
+                m_model_reader.get_weights()));
+        }
+    } else if (auto a = ov::as_type<ov::AttributeAdapter<std::shared_ptr<ov::StringAlignedBuffer>>>(&adapter)) {
+        auto value = *find(name, AttributeType::CONSTANT_DATA);
+        const auto data = get_constant_data(value);
+        a->set(ov::AttributeAdapter<std::shared_ptr<ov::StringAlignedBuffer>>::unpack_string_tensor(
+            data,
+            static_cast<size_t>(m_constant_data->second)));
+    } else if (auto a = ov::as_type<ov::AttributeAdapter<ov::element::TypeVector>>(&adapter)) {
+        auto value = *find(name, AttributeType::VECTOR_STRING);
+        ov::element::TypeVector types;
+        for (const auto& type : value.read_strings<std::vector<std::string>>()) {
+            types.emplace_back(type);
+        }
+        a->set(types);
+    } else if (auto a = ov::as_type<ov::AttributeAdapter<ov::PartialShape>>(&adapter)) {
+        auto value = *find(name, AttributeType::PARTIAL_SHAPE);
+        if (value.read<uint8_t>() == 0) {
+            a->set(ov::PartialShape::dynamic());
+        } else {
+            std::vector<ov::Dimension> dims(value.read_count(2 * sizeof(int64_t)));
+            for (auto& dim : dims) {
+                const auto min = value.read<int64_t>();
+                dim = ov::Dimension(min, value.read<int64_t>());
+            }
+            a->set(ov::PartialShape(dims));
+        }
+    } else if (auto a = ov::as_type<ov::AttributeAdapter<ov::Dimension>>(&adapter)) {
+        auto value = *find(name, AttributeType::DIMENSION);
+        const auto min = value.read<int64_t>();
+        a->set(ov::Dimension(min, value.read<int64_t>()));
+    } else if (auto a = ov::as_type<ov::AttributeAdapter<std::set<std::string>>>(&adapter)) {
+        auto value = *find(name, AttributeType::STRING_SET);
+        a->set(value.read_strings<std::set<std::string>>());
+    } else {
+        OPENVINO_THROW("Error binary topology reading. Attribute adapter can not be found for ", name, " parameter");
+    }
+}
+
+void AttributeReader::on_adapter(const std::string& name, ov::ValueAccessor<std::shared_ptr<ov::Model>>& adapter) {
+    if (auto value = find(name, AttributeType::MODEL)) {
+        adapter.set(m_model_reader.read_model(*value));
+    }
+}
+
+char* AttributeReader::get_constant_data(Reader& value) {
+    const auto& weights = m_model_reader.get_weights();
+    OPENVINO_ASSERT(weights, "Empty weights data in bin file or bin file cannot be found!");
+    const auto offset = value.read<uint64_t>();
+    const auto size = value.read<uint64_t>();
+    OPENVINO_ASSERT(offset <= weights->size() && size <= weights->size() - offset, "Incorrect weights in bin file!");
+    m_constant_data = {offset, size};
+    return weights->get_ptr<char>() + offset;
+}
+}  // namespace
+
+std::shared_ptr<ov::Model> deserialize(
+    const std::shared_ptr<ov::AlignedBuffer>& topology,
+    const std::shared_ptr<ov::AlignedBuffer>& weights,
+    const std::unordered_map<std::string, ov::OpSet>& opsets,
+    const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions,
+    std::unordered_map<std::string, std::shared_ptr<ov::op::util::Variable>>& variables) {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::ReadTime, "binary_topology::deserialize");
+    const auto data = topology->get_ptr<char>();
+    OPENVINO_ASSERT(is_binary_topology(data, topology->size()), "The model is not a binary topology");
+    const auto header = read_header(data);
+    OPENVINO_ASSERT(header.format_version == format_version,
+                    "Unsupported version of the binary topology: ",
+                    header.format_version);
+    OPENVINO_ASSERT(header.ir_version == supported_ir_version,
+                    "Unsupported IR version of the binary topology: ",
+                    header.ir_version);
+
+    Reader reader(data + header_size, topology->size() - header_size);
+    return ModelReader(weights, opsets, extensions, variables).read_model(reader);
+}
+}  // namespace ov::util::binary_topology
@@ -0,0 +1,17 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Defines openvino domains for tracing
+ * @file itt.hpp
+ */
+
+#pragma once
+
+#include "openvino/itt.hpp"
+
+namespace ov::util::itt::domains {
+// the steps of the model reading are reported along with ov::Core::read_model
+OV_ITT_DOMAIN(ReadTime, "ov::ReadTime");
+}  // namespace ov::util::itt::domains
@@ -8,6 +8,7 @@
 #include <stack>
 #include <string_view>
 
+#include "itt.hpp"
 #include "openvino/core/descriptor_tensor.hpp"
 #include "openvino/core/memory_util.hpp"
 #include "openvino/core/meta_data.hpp"
@@ -932,7 +933,7 @@ void XmlDeserializer::set_constant_num_buffer(ov::AttributeAdapter<std::shared_p
 
 std::shared_ptr<ov::Model> XmlDeserializer::parse_function(const pugi::xml_node& root,
                                                            const std::shared_ptr<ov::AlignedBuffer>& weights) {
-    // OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::V10Reader_RT, "V10Parser", "Parse");
+    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::ReadTime, "XmlDeserializer::parse_function", "Layers");
 
     struct FunctionNodes {
         ov::ParameterVector parameters;
@@ -972,6 +973,7 @@ std::shared_ptr<ov::Model> XmlDeserializer::parse_function(const pugi::xml_node&
         }
     }
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "Edges");
     // Read all edges and store them for further usage
     FOREACH_CHILD (_ec, root.child("edges"), "edge") {
         size_t fromLayer = static_cast<size_t>(pugixml::get_uint64_attr(_ec, "from-layer"));
@@ -981,6 +983,7 @@ std::shared_ptr<ov::Model> XmlDeserializer::parse_function(const pugi::xml_node&
         edges[toLayer].push_back({fromLayer, fromPort, toPort});
     }
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "TopologicalSort");
     // Run DFS starting from outputs to get nodes topological order
     std::function<void(size_t)> dfs = [&edges, &order, &dfs_used_nodes](const size_t start_id) {
         std::stack<size_t> stack;
@@ -1009,6 +1012,7 @@ std::shared_ptr<ov::Model> XmlDeserializer::parse_function(const pugi::xml_node&
     };
     std::for_each(outputs.begin(), outputs.end(), dfs);
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "Nodes");
     FunctionNodes func_nodes;
     std::map<size_t, std::shared_ptr<ov::Node>> id_to_node;
     std::map<std::string, std::shared_ptr<ov::Node>> variable_id_to_read_value;
@@ -1082,6 +1086,7 @@ std::shared_ptr<ov::Model> XmlDeserializer::parse_function(const pugi::xml_node&
         }
     }
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "MetaData");
     // Read meta data from legacy representation
     if (root.child("rt_info").empty()) {
         // Legacy representation
@@ -16,6 +16,7 @@
 #include "openvino/util/file_util.hpp"
 #include "openvino/util/mmap_object.hpp"
 #include "openvino/util/xml_parse_utils.hpp"
+#include "openvino/xml_util/binary_topology.hpp"
 #include "transformations/resolve_names_collisions.hpp"
 #include "utils.hpp"
 
@@ -45,6 +46,10 @@ constexpr size_t HEADER_SIZE_LIM = 512lu;
  * @return IR version, 0 if model does represent IR
  */
 size_t get_ir_version(const char* model, size_t model_size) {
+    if (ov::util::binary_topology::is_binary_topology(model, model_size)) {
+        return static_cast<size_t>(ov::util::binary_topology::read_header(model).ir_version);
+    }
+
     // IR version is a value of root tag attribuite thought not need to parse the whole stream.
 
     size_t header_size = model_size > HEADER_SIZE_LIM ? HEADER_SIZE_LIM : model_size;
@@ -75,9 +80,13 @@ size_t get_ir_version(std::istream& model) {
 
     model.seekg(0, model.beg);
     model.read(header, HEADER_SIZE_LIM);
+    const auto header_size = static_cast<size_t>(model.gcount());
     model.clear();
     model.seekg(0, model.beg);
 
+    if (ov::util::binary_topology::is_binary_topology(header, header_size)) {
+        return get_ir_version(header, header_size);
+    }
     auto ir_version = get_ir_version(header, HEADER_SIZE_LIM);
     if (ir_version == 0lu) {
         pugi::xml_document doc;
@@ -239,6 +248,22 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
     }
     bool enable_mmap = variants[variants.size() - 1].is<bool>() ? variants[variants.size() - 1].as<bool>() : false;
 
+    // The binary topology is mapped as the weights, so the model is read without copying the file
+    if (enable_mmap && local_model_stream.is_open()) {
+        char header[ov::util::binary_topology::header_size];
+        local_model_stream.read(header, sizeof(header));
+        const auto header_size = static_cast<size_t>(local_model_stream.gcount());
+        local_model_stream.clear();
+        local_model_stream.seekg(0, local_model_stream.beg);
+        if (ov::util::binary_topology::is_binary_topology(header, header_size)) {
+            local_model_stream.close();
+            auto mapped_memory = ov::load_mmap_object(model_path);
+            model_buf = std::make_shared<ov::SharedBuffer<std::shared_ptr<MappedMemory>>>(mapped_memory->data(),
+                                                                                          mapped_memory->size(),
+                                                                                          mapped_memory);
+        }
+    }
+
     // Find weights if only path to xml was provided
     if (weights_path.empty()) {
         auto pos = model_path.rfind('.');
@@ -6,6 +6,7 @@
 
 #include <pugixml.hpp>
 
+#include "itt.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/validation_util.hpp"
 #include "openvino/op/concat.hpp"
@@ -16,6 +17,8 @@
 #include "openvino/opsets/opset.hpp"
 #include "openvino/util/common_util.hpp"
 #include "openvino/util/xml_parse_utils.hpp"
+#include "openvino/xml_util/binary_topology.hpp"
+#include "openvino/xml_util/binary_topology_deserialize_util.hpp"
 #include "openvino/xml_util/xml_deserialize_util.hpp"
 #include "utils.hpp"
 
@@ -205,6 +208,8 @@ class InputModel::InputModelIRImpl {
     std::unordered_map<std::string, ov::OpSet> m_opsets;
     pugi::xml_node m_root;
     pugi::xml_document m_xml_doc;
+    // the model in the binary topology format, it's decoded by convert() instead of XML parsing
+    std::shared_ptr<ov::AlignedBuffer> m_topology;
     std::string m_weights_path;
 
 public:
@@ -215,8 +220,22 @@ public:
         : m_weights(weights),
           m_extensions(extensions),
           m_weights_path(std::move(weights_path)) {
-        pugi::xml_parse_result res = m_xml_doc.load(model);
-        OPENVINO_ASSERT(res.status == pugi::status_ok, res.description(), " at offset ", res.offset);
+        char header[ov::util::binary_topology::header_size];
+        model.read(header, sizeof(header));
+        const auto header_size = static_cast<size_t>(model.gcount());
+        model.clear();
+        model.seekg(0, model.beg);
+        if (ov::util::binary_topology::is_binary_topology(header, header_size)) {
+            model.seekg(0, model.end);
+            const auto size = static_cast<size_t>(model.tellg());
+            model.seekg(0, model.beg);
+            m_topology = std::make_shared<ov::AlignedBuffer>(size);
+            model.read(m_topology->get_ptr<char>(), size);
+        } else {
+            OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::ReadTime, "InputModelIRImpl::parse XML");
+            pugi::xml_parse_result res = m_xml_doc.load(model);
+            OPENVINO_ASSERT(res.status == pugi::status_ok, res.description(), " at offset ", res.offset);
+        }
         init_opset();
     }
 
@@ -227,8 +246,14 @@ public:
         : m_weights(weights),
           m_extensions(extensions),
           m_weights_path(std::move(weights_path)) {
-        auto res = m_xml_doc.load_buffer(model->get_ptr(), model->size(), pugi::parse_default, pugi::encoding_utf8);
-        OPENVINO_ASSERT(res.status == pugi::status_ok, res.description(), " at offset ", res.offset);
+        if (ov::util::binary_topology::is_binary_topology(model->get_ptr<char>(), model->size())) {
+            m_topology = model;
+        } else {
+            OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::ReadTime, "InputModelIRImpl::parse XML");
+            auto res =
+                m_xml_doc.load_buffer(model->get_ptr(), model->size(), pugi::parse_default, pugi::encoding_utf8);
+            OPENVINO_ASSERT(res.status == pugi::status_ok, res.description(), " at offset ", res.offset);
+        }
         init_opset();
     }
 
@@ -262,8 +287,20 @@ std::shared_ptr<ov::Model> InputModel::convert() {
 }
 
 std::shared_ptr<ov::Model> InputModel::InputModelIRImpl::convert() {
+    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::ReadTime, "InputModelIRImpl::convert", "Model");
     std::unordered_map<std::string, std::shared_ptr<ov::op::util::Variable>> variables;
 
+    // The binary topology is written for IR v11 only and its reader rejects the others, so unlike IR v10 XML it has
+    // no legacy pre-processing section to parse
+    if (m_topology) {
+        auto model = ov::util::binary_topology::deserialize(m_topology, m_weights, m_opsets, m_extensions, variables);
+        model->get_rt_info()["version"] =
+            ov::util::binary_topology::read_header(m_topology->get_ptr<char>()).ir_version;
+        if (!m_weights_path.empty())
+            model->get_rt_info()["__weights_path"] = m_weights_path;
+        return model;
+    }
+
     // Load default opsets
     size_t version = static_cast<size_t>(ov::util::pugixml::get_uint64_attr(m_root, "version", 0));
     ov::util::XmlDeserializer visitor(m_root, m_weights, m_opsets, m_extensions, variables, version);
@@ -272,6 +309,8 @@ std::shared_ptr<ov::Model> InputModel::InputModelIRImpl::convert() {
     model->get_rt_info()["version"] = int64_t(version);
     if (!m_weights_path.empty())
         model->get_rt_info()["__weights_path"] = m_weights_path;
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "PreProcess");
     parse_pre_process(m_root, m_weights, model);
 
     return model;
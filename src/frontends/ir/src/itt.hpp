@@ -0,0 +1,25 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Defines openvino domains for tracing
+ * @file itt.hpp
+ */
+
+#pragma once
+
+#include "openvino/itt.hpp"
+
+namespace ov {
+namespace frontend {
+namespace ir {
+namespace itt {
+namespace domains {
+// the steps of the model reading are reported along with ov::Core::read_model
+OV_ITT_DOMAIN(ReadTime, "ov::ReadTime");
+}  // namespace domains
+}  // namespace itt
+}  // namespace ir
+}  // namespace frontend
+}  // namespace ov
@@ -9,10 +9,13 @@
 
 #pragma once
 
+#include <cstdint>
+#include <map>
 #include <memory>
 #include <string>
 
 #include "openvino/runtime/common.hpp"
+#include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
 
 namespace ov {
@@ -23,7 +26,8 @@ namespace threading {
  * @ingroup ov_dev_api_threading
  * @brief CPU Streams executor implementation. The executor splits the CPU into groups of threads,
  *        that can be pinned to cores or NUMA nodes.
- *        It uses custom threads to pull tasks from single queue.
+ *        It uses custom threads to pull tasks from per-stream queues, an idle stream steals the tasks queued for
+ *        the other streams.
  */
 class OPENVINO_RUNTIME_API CPUStreamsExecutor : public IStreamsExecutor {
 public:
@@ -43,8 +47,37 @@ public:
      */
     ~CPUStreamsExecutor() override;
 
+    /**
+     * @brief Statistics of a priority lane of the task queue
+     */
+    struct QueueStatistics {
+        uint64_t enqueued = 0;       //!< Number of the tasks passed to the lane
+        uint64_t depth = 0;          //!< Number of the tasks waiting in the lane
+        uint64_t max_depth = 0;      //!< Maximum number of the tasks waiting in the lane at once
+        uint64_t total_wait_ns = 0;  //!< Total time the started tasks have waited in the lane
+        uint64_t max_wait_ns = 0;    //!< Maximum time a started task has waited in the lane
+    };
+
+    /**
+     * @brief Runs the task in the default (MEDIUM) priority lane
+     * @param task A task to run
+     */
     void run(Task task) override;
 
+    /**
+     * @brief Runs the task in the given priority lane. An idle stream takes the tasks of the higher priority lanes
+     * first, so the latency critical tasks overtake the tasks queued earlier in the lower priority lanes.
+     * @param task A task to run
+     * @param priority A priority lane
+     */
+    void run(Task task, ov::hint::Priority priority);
+
+    /**
+     * @brief Returns the statistics of the task queue per priority lane
+     * @return The statistics of the LOW, MEDIUM and HIGH lanes
+     */
+    std::map<ov::hint::Priority, QueueStatistics> get_queue_statistics() const;
+
     void execute(Task task) override;
 
     int get_stream_id() override;
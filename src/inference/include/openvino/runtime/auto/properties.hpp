@@ -37,6 +37,7 @@ static constexpr Property<bool> enable_runtime_fallback{"ENABLE_RUNTIME_FALLBACK
 enum class SchedulePolicy {
     ROUND_ROBIN = 0,            // will schedule the infer request using round robin policy
     DEVICE_PRIORITY = 1,        // will schedule the infer request based on the device priority
+    LOAD_AWARE = 2,             // will schedule the infer request to the device with the lowest predicted completion time
     DEFAULT = DEVICE_PRIORITY,  //!<  Default schedule policy is DEVICE_PRIORITY
 };
 
@@ -47,6 +48,8 @@ inline std::ostream& operator<<(std::ostream& os, const SchedulePolicy& policy)
         return os << "ROUND_ROBIN";
     case SchedulePolicy::DEVICE_PRIORITY:
         return os << "DEVICE_PRIORITY";
+    case SchedulePolicy::LOAD_AWARE:
+        return os << "LOAD_AWARE";
     default:
         OPENVINO_THROW("Unsupported schedule policy value");
     }
@@ -59,6 +62,8 @@ inline std::istream& operator>>(std::istream& is, SchedulePolicy& policy) {
         policy = SchedulePolicy::ROUND_ROBIN;
     } else if (str == "DEVICE_PRIORITY") {
         policy = SchedulePolicy::DEVICE_PRIORITY;
+    } else if (str == "LOAD_AWARE") {
+        policy = SchedulePolicy::LOAD_AWARE;
     } else if (str == "DEFAULT") {
         policy = SchedulePolicy::DEFAULT;
     } else {
@@ -74,5 +79,13 @@ inline std::istream& operator>>(std::istream& is, SchedulePolicy& policy) {
  * @ingroup ov_runtime_cpp_prop_api
  */
 static constexpr Property<SchedulePolicy> schedule_policy{"SCHEDULE_POLICY"};
+
+/**
+ * @brief Read-only property to get the routing statistics of every device in AUTO CUMULATIVE_THROUGHPUT or MULTI case.
+ * The value maps the device name to the map of its statistics: REQUESTS, IN_FLIGHT, INFERENCES, LATENCY_MS (moving
+ * average of the inference latency) and PREDICTED_COMPLETION_MS
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<ov::AnyMap, PropertyMutability::RO> device_routing_statistics{"DEVICE_ROUTING_STATISTICS"};
 }  // namespace intel_auto
 }  // namespace ov
\ No newline at end of file
@@ -889,6 +889,33 @@ static constexpr Property<uint32_t, PropertyMutability::RO> max_batch_size{"MAX_
  */
 static constexpr Property<uint32_t, PropertyMutability::RW> auto_batch_timeout{"AUTO_BATCH_TIMEOUT"};
 
+/**
+ * @brief Read-write property to let the auto-batching tune the timeout from the observed arrival rate of the inputs and
+ * the batch execution latency, ov::auto_batch_timeout is the upper bound of the tuned value. Unless
+ * ov::auto_batch_sizes is set, up to 4 of the largest power-of-2 batch sizes below the device batch size are compiled
+ * to execute the partially collected batches.
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<bool, PropertyMutability::RW> auto_batch_adaptive_timeout{"AUTO_BATCH_ADAPTIVE_TIMEOUT"};
+
+/**
+ * @brief Read-write property to set the ladder of the batch sizes the auto-batching compiles the model with, e.g.
+ * {1, 2, 4, 8, 16}. The sizes above the device batch size are ignored. The batch that is partially collected by the
+ * timeout is executed with the smallest compiled batch size that covers it, rather than request by request with the
+ * batch 1. Every size is compiled as a separate model on the device, which adds to the compilation time and the memory
+ * footprint, so at most 4 sizes between 1 and the device batch size are allowed.
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<std::vector<uint32_t>, PropertyMutability::RW> auto_batch_sizes{"AUTO_BATCH_SIZES"};
+
+/**
+ * @brief Read-only property to get the number of the inferences the auto-batching has executed with every compiled
+ * batch size, the requests executed with the batch 1 are counted one by one.
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<std::map<uint32_t, uint64_t>, PropertyMutability::RO> auto_batch_dispatch_counts{
+    "AUTO_BATCH_DISPATCH_COUNTS"};
+
 /**
  * @brief Read-only property to provide a hint for a range for number of async infer requests. If device supports
  * streams, the metric provides range for number of IRs per stream.
@@ -66,7 +66,8 @@ std::string ModelCache::compute_hash(const std::shared_ptr<const ov::Model>& mod
     OPENVINO_ASSERT(model);
 
     uint64_t seed = 0;
-    // 1. Calculate hash on function, skipping weights if model path is provided
+    // 1. Calculate hash on function, skipping weights if model path is provided. Otherwise the memoized content
+    // hashes of the constant buffers are used, so the weights are read once per model rather than on every call
     ov::pass::Manager m;
     m.register_pass<ov::pass::Hash>(seed, !model_path.empty());
     m.run_passes(std::const_pointer_cast<ov::Model>(model));
@@ -77,12 +78,13 @@ std::string ModelCache::compute_hash(const std::shared_ptr<const ov::Model>& mod
     }
 
     // 3. Add runtime information which may not be serialized
+    std::stringstream strm;
     for (const auto& op : model->get_ordered_ops()) {
         // Skip runtime attributes which are not hash-able
         for (const auto& [name, attribute] : op->get_rt_info()) {
             if (!attribute.is<ov::RuntimeAttribute>() || attribute.as<ov::RuntimeAttribute>().is_deterministic()) {
                 seed = hash_combine(seed, name);
-                std::stringstream strm;
+                strm.str({});
                 attribute.print(strm);
                 seed = hash_combine(seed, strm.str());
             }
@@ -4,8 +4,11 @@
 
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
 
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <queue>
@@ -371,6 +374,9 @@ struct CPUStreamsExecutor::Impl {
         } else {
             _usedNumaNodes = std::move(numaNodes);
         }
+        for (auto streamId = 0; streamId < streams_num; ++streamId) {
+            _shards.emplace_back(new TaskShard);
+        }
         for (auto streamId = 0; streamId < streams_num; ++streamId) {
             if (_config.get_cpu_reservation()) {
                 std::lock_guard<std::mutex> lock(_cpu_ids_mutex);
@@ -379,34 +385,82 @@ struct CPUStreamsExecutor::Impl {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config.get_name() + "_" + std::to_string(streamId));
                 for (bool stopped = false; !stopped;) {
-                    Task task;
-                    {
-                        std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] {
-                            return !_taskQueue.empty() || (stopped = _isStopped);
-                        });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
-                        }
-                    }
+                    Task task = Dequeue(streamId);
                     if (task) {
                         Execute(task, *(_streams.local()));
+                        continue;
                     }
+                    // the mutex is taken only to sleep, the producers take it only if there are sleeping streams
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    ++_sleeping;
+                    _queueCondVar.wait(lock, [&] {
+                        return _pending > 0 || (stopped = _isStopped);
+                    });
+                    --_sleeping;
+                    stopped = stopped && _pending == 0;
                 }
             });
         }
         _streams.set_thread_ids_map(_threads);
     }
 
-    void Enqueue(Task task) {
+    void Enqueue(Task task, ov::hint::Priority priority) {
+        const auto lane_id = static_cast<size_t>(priority);
+        auto& shard = *_shards[_nextShard++ % _shards.size()];
+        auto& lane = _lanes[lane_id];
         {
+            // the counters are updated under the lock, so a stream taking the task never sees them before the push
+            std::lock_guard<std::mutex> lock(shard._mutex);
+            shard._lanes[lane_id].push_back({std::move(task), std::chrono::steady_clock::now()});
+            ++lane._enqueued;
+            update_max(lane._maxDepth, ++lane._depth);
+            ++_pending;
+        }
+        if (_sleeping > 0) {
+            // synchronizes with a stream checking the pending tasks before it sleeps
             std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
         }
         _queueCondVar.notify_one();
     }
 
+    // takes the oldest task of the highest priority lane, the own shard of the stream first
+    Task Dequeue(int streamId) {
+        const auto shards_num = _shards.size();
+        for (size_t lane_id = lanes_num; lane_id-- > 0;) {
+            auto& lane = _lanes[lane_id];
+            if (lane._depth == 0) {
+                continue;
+            }
+            for (size_t i = 0; i < shards_num; ++i) {
+                auto& shard = *_shards[(streamId + i) % shards_num];
+                std::unique_lock<std::mutex> lock(shard._mutex);
+                auto& queue = shard._lanes[lane_id];
+                if (queue.empty()) {
+                    continue;
+                }
+                auto queued = std::move(queue.front());
+                queue.pop_front();
+                lock.unlock();
+
+                --lane._depth;
+                --_pending;
+                const auto wait = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                            std::chrono::steady_clock::now() - queued._enqueueTime)
+                                                            .count());
+                lane._totalWaitNs += wait;
+                update_max(lane._maxWaitNs, wait);
+                return std::move(queued._task);
+            }
+        }
+        return {};
+    }
+
+    static void update_max(std::atomic<uint64_t>& max, uint64_t value) {
+        auto current = max.load();
+        while (current < value && !max.compare_exchange_weak(current, value)) {
+        }
+    }
+
     void Execute(const Task& task, Stream& stream) {
 #if OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO || OV_THREAD == OV_THREAD_TBB_ADAPTIVE
         auto& arena = stream._taskArena;
@@ -472,9 +526,30 @@ struct CPUStreamsExecutor::Impl {
     int _streamId = 0;
     std::queue<int> _streamIdQueue;
     std::vector<std::thread> _threads;
+    static constexpr size_t lanes_num = 3;  // ov::hint::Priority LOW, MEDIUM, HIGH
+    struct QueuedTask {
+        Task _task;
+        std::chrono::steady_clock::time_point _enqueueTime;
+    };
+    // the tasks queued for a stream, other streams steal them when idle
+    struct TaskShard {
+        std::mutex _mutex;
+        std::array<std::deque<QueuedTask>, lanes_num> _lanes;
+    };
+    struct LaneCounters {
+        std::atomic<uint64_t> _enqueued{0};
+        std::atomic<uint64_t> _depth{0};
+        std::atomic<uint64_t> _maxDepth{0};
+        std::atomic<uint64_t> _totalWaitNs{0};
+        std::atomic<uint64_t> _maxWaitNs{0};
+    };
+    std::vector<std::unique_ptr<TaskShard>> _shards;
+    std::atomic<size_t> _nextShard{0};
+    std::array<LaneCounters, lanes_num> _lanes;
+    std::atomic<size_t> _pending{0};
+    std::atomic<int> _sleeping{0};
     std::mutex _mutex;
     std::condition_variable _queueCondVar;
-    std::queue<Task> _taskQueue;
     bool _isStopped = false;
     std::vector<int> _usedNumaNodes;
     CustomThreadLocal _streams;
@@ -547,11 +622,29 @@ void CPUStreamsExecutor::execute(Task task) {
 }
 
 void CPUStreamsExecutor::run(Task task) {
+    run(std::move(task), ov::hint::Priority::DEFAULT);
+}
+
+void CPUStreamsExecutor::run(Task task, ov::hint::Priority priority) {
     if (0 == _impl->_config.get_streams()) {
         _impl->Defer(std::move(task));
     } else {
-        _impl->Enqueue(std::move(task));
+        _impl->Enqueue(std::move(task), priority);
+    }
+}
+
+std::map<ov::hint::Priority, CPUStreamsExecutor::QueueStatistics> CPUStreamsExecutor::get_queue_statistics() const {
+    std::map<ov::hint::Priority, QueueStatistics> statistics;
+    for (auto priority : {ov::hint::Priority::LOW, ov::hint::Priority::MEDIUM, ov::hint::Priority::HIGH}) {
+        const auto& lane = _impl->_lanes[static_cast<size_t>(priority)];
+        auto& lane_statistics = statistics[priority];
+        lane_statistics.enqueued = lane._enqueued;
+        lane_statistics.depth = lane._depth;
+        lane_statistics.max_depth = lane._maxDepth;
+        lane_statistics.total_wait_ns = lane._totalWaitNs;
+        lane_statistics.max_wait_ns = lane._maxWaitNs;
     }
+    return statistics;
 }
 
 }  // namespace threading
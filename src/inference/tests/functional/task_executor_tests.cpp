@@ -263,3 +263,49 @@ static auto AsyncExecutors = ::testing::Values(
     });
 
 INSTANTIATE_TEST_SUITE_P(ASyncTaskExecutorTests, ASyncTaskExecutorTests, AsyncExecutors);
+
+TEST(CPUStreamsExecutorPriorityTests, highPriorityTasksOvertakeQueuedTasks) {
+    CPUStreamsExecutor executor{IStreamsExecutor::Config{"TestCPUStreamsExecutor", 1}};
+    std::promise<void> started;
+    std::promise<void> unblock;
+    auto blocked = unblock.get_future().share();
+    executor.run([&started, blocked] {
+        started.set_value();
+        blocked.wait();
+    });
+    // the only stream is busy, so all the following tasks stay queued until it is unblocked
+    started.get_future().wait();
+
+    std::mutex mutex;
+    std::vector<int> order;
+    std::vector<Future> futures;
+    for (int i = 0; i < 4; i++) {
+        auto p = std::make_shared<std::packaged_task<void()>>([&, i] {
+            std::lock_guard<std::mutex> lock{mutex};
+            order.push_back(i);
+        });
+        futures.emplace_back(p->get_future());
+        executor.run(
+            [p] {
+                (*p)();
+            },
+            i < 2 ? ov::hint::Priority::LOW : ov::hint::Priority::HIGH);
+    }
+    auto statistics = executor.get_queue_statistics();
+    ASSERT_EQ(2, statistics[ov::hint::Priority::LOW].depth);
+    ASSERT_EQ(2, statistics[ov::hint::Priority::HIGH].depth);
+
+    unblock.set_value();
+    for (auto& f : futures) {
+        f.wait();
+    }
+    ASSERT_EQ(std::vector<int>({2, 3, 0, 1}), order);
+
+    statistics = executor.get_queue_statistics();
+    ASSERT_EQ(2, statistics[ov::hint::Priority::LOW].enqueued);
+    ASSERT_EQ(0, statistics[ov::hint::Priority::LOW].depth);
+    ASSERT_EQ(2, statistics[ov::hint::Priority::LOW].max_depth);
+    ASSERT_LE(statistics[ov::hint::Priority::LOW].max_wait_ns, statistics[ov::hint::Priority::LOW].total_wait_ns);
+    ASSERT_EQ(2, statistics[ov::hint::Priority::HIGH].enqueued);
+    ASSERT_EQ(1, statistics[ov::hint::Priority::MEDIUM].enqueued);
+}
@@ -10,9 +10,11 @@
 #include <fstream>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include "common_test_utils/common_utils.hpp"
 #include "common_test_utils/test_constants.hpp"
+#include "openvino/core/graph_util.hpp"
 #include "openvino/core/preprocess/pre_post_process.hpp"
 #include "openvino/op/add.hpp"
 #include "openvino/op/constant.hpp"
@@ -322,6 +324,38 @@ TEST(NetworkContext, HashWithDifferentResults) {
     ASSERT_EQ(ov::ModelCache::compute_hash(net2, {}), ov::ModelCache::compute_hash(net3, {}));
 }
 
+TEST(NetworkContext, HashWithDifferentWeights) {
+    auto net1 = create_simple_model();
+    auto net2 = create_simple_model();
+    auto replace_add_constant = [](const std::shared_ptr<ov::Model>& model,
+                                   const std::shared_ptr<ov::op::v0::Constant>& constant) {
+        for (const auto& op : model->get_ordered_ops()) {
+            if (op->get_friendly_name() == "add_constant") {
+                constant->set_friendly_name("add_constant");
+                constant->get_output_tensor(0).set_names({"add_constant"});
+                ov::replace_node(op, constant);
+            }
+        }
+    };
+    auto net3 = create_simple_model();
+    replace_add_constant(net3, ov::op::v0::Constant::create(ov::element::i8, ov::Shape{1}, {5}));
+    // the memoized hashes of the weights are reused by the second calculation
+    ASSERT_EQ(ov::ModelCache::compute_hash(net1, {}), ov::ModelCache::compute_hash(net2, {}));
+    ASSERT_EQ(ov::ModelCache::compute_hash(net1, {}), ov::ModelCache::compute_hash(net2, {}));
+    ASSERT_NE(ov::ModelCache::compute_hash(net2, {}), ov::ModelCache::compute_hash(net3, {}));
+
+    // the weights shared with their owner (like the mapped IR weights) are not read again either: the change
+    // bypassing the constant is not seen by the second calculation
+    auto weights = std::make_shared<std::vector<int8_t>>(1, 2);
+    auto net4 = create_simple_model();
+    auto shared_constant =
+        std::make_shared<ov::op::v0::Constant>(ov::element::i8, ov::Shape{1}, weights->data(), weights);
+    replace_add_constant(net4, shared_constant);
+    const auto hash = ov::ModelCache::compute_hash(net4, {});
+    weights->front() = 5;
+    ASSERT_EQ(hash, ov::ModelCache::compute_hash(net4, {}));
+}
+
 // Verify all internal hash calculations are thread-safe (like ov::Model serialization)
 TEST(NetworkContext, HashOfSameMultiThreading) {
     auto net1 = create_simple_model();
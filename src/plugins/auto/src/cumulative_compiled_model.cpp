@@ -48,6 +48,7 @@ ov::Any AutoCumuCompiledModel::get_property(const std::string& name) const {
                                                     ov::hint::model_priority,
                                                     ov::loaded_from_cache,
                                                     ov::intel_auto::schedule_policy,
+                                                    ov::intel_auto::device_routing_statistics,
                                                     ov::enable_profiling};
         return ro_properties;
     };
@@ -70,6 +71,8 @@ ov::Any AutoCumuCompiledModel::get_property(const std::string& name) const {
         return m_context->m_performance_hint;
     } else if (name == ov::intel_auto::schedule_policy) {
         return m_context->m_schedule_policy;
+    } else if (name == ov::intel_auto::device_routing_statistics) {
+        return decltype(ov::intel_auto::device_routing_statistics)::value_type{m_scheduler->get_routing_statistics()};
     } else if (name == ov::device::priorities) {
         // device priority does not support change on-the-fly
         return decltype(ov::device::priorities)::value_type(m_context->m_str_devices);
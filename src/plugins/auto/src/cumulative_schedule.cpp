@@ -4,6 +4,9 @@
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #include "cumulative_schedule.hpp"
+
+#include <algorithm>
+
 #include "async_infer_request.hpp"
 #include "plugin.hpp"
 
@@ -23,12 +26,83 @@ std::string CumuSchedule::schedule_to_next_device(const std::vector<DeviceInform
     if (schedule_policy == ov::intel_auto::SchedulePolicy::ROUND_ROBIN) {
         std::lock_guard<std::mutex> lock(m_context->m_mutex);
         m_n_ctput_schedule_next_device++;
-    } else if (schedule_policy == ov::intel_auto::SchedulePolicy::DEVICE_PRIORITY) {
+    } else if (schedule_policy == ov::intel_auto::SchedulePolicy::DEVICE_PRIORITY ||
+               schedule_policy == ov::intel_auto::SchedulePolicy::LOAD_AWARE) {
+        // LOAD_AWARE devices are already ranked by the predicted completion time
         selected_device_name = devices[current_device_index].device_name;
     }
     return selected_device_name;
 }
 
+double CumuSchedule::RoutingStatistics::predicted_completion_ms() const {
+    const auto requests = static_cast<double>(std::max<std::size_t>(m_requests, 1));
+    return m_latency_ms * static_cast<double>(m_in_flight + 1) / requests;
+}
+
+void CumuSchedule::record_request_dispatch(const DeviceName& device) {
+    std::lock_guard<std::mutex> lock(m_routing_mutex);
+    m_routing_statistics[device].m_in_flight++;
+}
+
+void CumuSchedule::record_request_completion(const DeviceName& device, double latency_ms, bool succeeded) {
+    // weight of the latest latency in the moving average
+    constexpr double latency_smoothing = 0.2;
+    std::lock_guard<std::mutex> lock(m_routing_mutex);
+    auto& statistics = m_routing_statistics[device];
+    if (statistics.m_in_flight > 0) {
+        statistics.m_in_flight--;
+    }
+    if (!succeeded) {
+        return;
+    }
+    if (statistics.m_inferences == 0) {
+        statistics.m_latency_ms = latency_ms;
+    } else {
+        statistics.m_latency_ms += latency_smoothing * (latency_ms - statistics.m_latency_ms);
+    }
+    statistics.m_inferences++;
+}
+
+void CumuSchedule::rank_devices_by_predicted_completion(std::vector<DeviceInformation>& devices) const {
+    std::vector<std::pair<double, DeviceInformation>> ranked;
+    ranked.reserve(devices.size());
+    {
+        std::lock_guard<std::mutex> lock(m_routing_mutex);
+        for (auto& device : devices) {
+            const auto it = m_routing_statistics.find(device.device_name);
+            // a device without statistics is tried first to measure its latency
+            ranked.emplace_back(it == m_routing_statistics.end() ? 0.0 : it->second.predicted_completion_ms(),
+                                std::move(device));
+        }
+    }
+    std::stable_sort(ranked.begin(), ranked.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.first < rhs.first;
+    });
+    for (size_t i = 0; i < ranked.size(); i++) {
+        devices[i] = std::move(ranked[i].second);
+    }
+}
+
+ov::AnyMap CumuSchedule::get_routing_statistics() const {
+    ov::AnyMap routing_statistics;
+    std::lock_guard<std::mutex> lock(m_routing_mutex);
+    for (const auto& item : m_routing_statistics) {
+        const auto& statistics = item.second;
+        routing_statistics[item.first] = ov::AnyMap{{"REQUESTS", static_cast<uint64_t>(statistics.m_requests)},
+                                                    {"IN_FLIGHT", static_cast<uint64_t>(statistics.m_in_flight)},
+                                                    {"INFERENCES", statistics.m_inferences},
+                                                    {"LATENCY_MS", statistics.m_latency_ms},
+                                                    {"PREDICTED_COMPLETION_MS", statistics.predicted_completion_ms()}};
+    }
+    return routing_statistics;
+}
+
+void CumuSchedule::on_worker_request_completed(const DeviceName& device, const WorkerInferRequest& worker_request) {
+    std::chrono::duration<double, std::milli> latency =
+        std::chrono::steady_clock::now() - worker_request.m_dispatch_time;
+    record_request_completion(device, latency.count(), worker_request.m_exception_ptr == nullptr);
+}
+
 bool CumuSchedule::select_other_device(const std::string& cur_dev_name) {
     {
         std::lock_guard<std::mutex> lock(m_context->m_fallback_mutex);
@@ -92,6 +166,11 @@ void CumuSchedule::init() {
                 context_ptr->m_worker_name = context_ptr->m_device_info.device_name;
             }
             generate_workers(context_ptr->m_worker_name, context_ptr->m_compiled_model);
+            {
+                std::lock_guard<std::mutex> lock(m_routing_mutex);
+                m_routing_statistics[context_ptr->m_worker_name].m_requests =
+                    m_worker_requests[context_ptr->m_worker_name].size();
+            }
             context_ptr->m_is_already = true;
             // reloadsuccess flag only for m_compile_context[FALLBACKDEVICE]
             context_ptr->m_is_reload_success = true;
@@ -146,6 +225,7 @@ void CumuSchedule::init() {
         m_idle_worker_requests[device.device_name];
         m_worker_requests[device.device_name];
         m_infer_pipeline_tasks_device_specific[device.device_name] = nullptr;
+        m_routing_statistics[device.device_name];
     }
     // load devices other than CPU first
     if (other_devices_loads.size() > 0) {
@@ -235,6 +315,9 @@ bool CumuSchedule::schedule_to_worker_infer_request(ov::threading::Task pipeline
             devices = m_context->m_device_priorities;
         }
     }
+    if (preferred_device.empty() && m_context->m_schedule_policy == ov::intel_auto::SchedulePolicy::LOAD_AWARE) {
+        rank_devices_by_predicted_completion(devices);
+    }
 
     std::size_t current_device_index = 0;
     while (current_device_index < devices.size()) {
@@ -244,9 +327,13 @@ bool CumuSchedule::schedule_to_worker_infer_request(ov::threading::Task pipeline
         }
         auto selected_device_name =
             preferred_device.empty() ? schedule_to_next_device(devices, current_device_index) : preferred_device;
+        // the request may complete before the pipeline task returns, count it in flight before
+        record_request_dispatch(selected_device_name);
         if (run_pipeline_task(pipeline_task, m_idle_worker_requests[selected_device_name], preferred_device)) {
             return true;
         } else {
+            // no idle worker request, nothing was started on the device
+            record_request_completion(selected_device_name, 0.0, false);
             current_device_index++;
         }
     }
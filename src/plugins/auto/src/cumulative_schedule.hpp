@@ -20,12 +20,31 @@ public:
     size_t                                  m_n_ctput_schedule_next_device = 0;
     std::string schedule_to_next_device(const std::vector<DeviceInformation>& devices,
                                         std::size_t current_device_index);
+
+    // routing statistics of the device used by the LOAD_AWARE schedule policy
+    struct RoutingStatistics {
+        std::size_t m_requests = 0;
+        std::size_t m_in_flight = 0;
+        uint64_t    m_inferences = 0;
+        // moving average of the latency of the successful inferences
+        double      m_latency_ms = 0.0;
+        // expected time to complete one more request: the device runs its worker requests in parallel
+        double predicted_completion_ms() const;
+    };
+    DeviceMap<RoutingStatistics>            m_routing_statistics;
+    mutable std::mutex                      m_routing_mutex;
+    void record_request_dispatch(const DeviceName& device);
+    void record_request_completion(const DeviceName& device, double latency_ms, bool succeeded);
+    // stable sort of the devices by the predicted completion time, the device priority breaks the ties
+    void rank_devices_by_predicted_completion(std::vector<DeviceInformation>& devices) const;
+    ov::AnyMap get_routing_statistics() const;
 private:
     void init() override;
     SoCompiledModel wait_first_compiled_model_ready() override;
     bool schedule_to_worker_infer_request(ov::threading::Task, DeviceName preferred_device = "") override;
     void try_to_compile_model(AutoCompileContext& context, const std::shared_ptr<ov::Model>& model) override;
     bool select_other_device(const std::string& cur_dev_name) override;
+    void on_worker_request_completed(const DeviceName& device, const WorkerInferRequest& worker_request) override;
 };
 } // namespace auto_plugin
 } // namespace ov
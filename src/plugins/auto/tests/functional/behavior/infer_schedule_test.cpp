@@ -70,6 +70,38 @@ TEST_P(InferSchedulePolicyTest, can_run_sync_requests_with_different_schedule_po
     }
 }
 
+TEST_F(AutoFuncTests, can_get_device_routing_statistics_with_load_aware_schedule_policy) {
+    ov::CompiledModel compiled_model;
+    OV_ASSERT_NO_THROW(compiled_model = core.compile_model(
+                           model_cannot_batch,
+                           "AUTO",
+                           {ov::device::priorities("MOCK_GPU", "MOCK_CPU"),
+                            ov::hint::performance_mode(ov::hint::PerformanceMode::CUMULATIVE_THROUGHPUT),
+                            ov::intel_auto::schedule_policy(ov::intel_auto::SchedulePolicy::LOAD_AWARE)}));
+    std::vector<ov::InferRequest> inferReqsQueue;
+    for (int i = 0; i < 20; i++) {
+        ov::InferRequest req;
+        OV_ASSERT_NO_THROW(req = compiled_model.create_infer_request());
+        inferReqsQueue.push_back(req);
+    }
+    for (auto& req : inferReqsQueue) {
+        OV_ASSERT_NO_THROW(req.start_async());
+    }
+    for (auto& req : inferReqsQueue) {
+        OV_ASSERT_NO_THROW(req.wait());
+    }
+    ov::AnyMap routing_statistics;
+    OV_ASSERT_NO_THROW(routing_statistics = compiled_model.get_property(ov::intel_auto::device_routing_statistics));
+    EXPECT_EQ(routing_statistics.size(), 2);
+    uint64_t inferences = 0;
+    for (auto& item : routing_statistics) {
+        auto statistics = item.second.as<ov::AnyMap>();
+        EXPECT_EQ(statistics.at("IN_FLIGHT").as<uint64_t>(), 0);
+        inferences += statistics.at("INFERENCES").as<uint64_t>();
+    }
+    EXPECT_EQ(inferences, inferReqsQueue.size());
+}
+
 auto properties = std::vector<ov::AnyMap>{
     {ov::device::priorities("MOCK_GPU"), ov::intel_auto::schedule_policy(ov::intel_auto::SchedulePolicy::ROUND_ROBIN)},
     {ov::device::priorities("MOCK_GPU"),
@@ -82,7 +114,9 @@ auto properties = std::vector<ov::AnyMap>{
     {ov::device::priorities("MOCK_GPU", "MOCK_CPU"),
      ov::intel_auto::schedule_policy(ov::intel_auto::SchedulePolicy::DEVICE_PRIORITY)},
     {ov::device::priorities("MOCK_CPU", "MOCK_GPU"),
-     ov::intel_auto::schedule_policy(ov::intel_auto::SchedulePolicy::ROUND_ROBIN)}};
+     ov::intel_auto::schedule_policy(ov::intel_auto::SchedulePolicy::ROUND_ROBIN)},
+    {ov::device::priorities("MOCK_GPU", "MOCK_CPU"),
+     ov::intel_auto::schedule_policy(ov::intel_auto::SchedulePolicy::LOAD_AWARE)}};
 auto niters = std::vector<int>{10, 20, 30};
 
 INSTANTIATE_TEST_SUITE_P(AutoFuncTests,
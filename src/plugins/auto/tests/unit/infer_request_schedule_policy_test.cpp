@@ -131,9 +131,62 @@ const std::vector<ConfigParams> configs = {
     ConfigParams{metaDevices,
                  ov::intel_auto::SchedulePolicy::DEVICE_PRIORITY,
                  {{"DEVICE_0", 3}, {"DEVICE_1", 2}, {"DEVICE_2", 1}},
+                 {"DEVICE_0", "DEVICE_0", "DEVICE_0", "DEVICE_1", "DEVICE_1", "DEVICE_2"}},
+    // the candidate list is ranked by the predicted completion time before scheduling
+    ConfigParams{metaDevices,
+                 ov::intel_auto::SchedulePolicy::LOAD_AWARE,
+                 {{"DEVICE_0", 3}, {"DEVICE_1", 2}, {"DEVICE_2", 1}},
                  {"DEVICE_0", "DEVICE_0", "DEVICE_0", "DEVICE_1", "DEVICE_1", "DEVICE_2"}}};
 
 INSTANTIATE_TEST_SUITE_P(smoke_Auto_BehaviorTests,
                          MockCumuSchedule,
                          ::testing::ValuesIn(configs),
-                         MockCumuSchedule::getTestCaseName);
\ No newline at end of file
+                         MockCumuSchedule::getTestCaseName);
+
+class LoadAwareCumuSchedule : public ov::auto_plugin::CumuSchedule, public ::testing::Test {};
+
+TEST_F(LoadAwareCumuSchedule, rankDevicesByPredictedCompletion) {
+    // DEVICE_0 is slow, DEVICE_1 is fast, DEVICE_2 has not completed any inference yet
+    m_routing_statistics["DEVICE_0"].m_requests = 2;
+    m_routing_statistics["DEVICE_1"].m_requests = 2;
+    record_request_dispatch("DEVICE_0");
+    record_request_completion("DEVICE_0", 20.0, true);
+    record_request_dispatch("DEVICE_1");
+    record_request_completion("DEVICE_1", 4.0, true);
+
+    auto devices = metaDevices;
+    rank_devices_by_predicted_completion(devices);
+    ASSERT_EQ(devices.size(), 3);
+    EXPECT_EQ(devices[0].device_name, "DEVICE_2");
+    EXPECT_EQ(devices[1].device_name, "DEVICE_1");
+    EXPECT_EQ(devices[2].device_name, "DEVICE_0");
+
+    // the queue of DEVICE_1 makes it slower than DEVICE_0: 4 * (9 + 1) / 2 > 20 * (0 + 1) / 2
+    for (int i = 0; i < 9; i++) {
+        record_request_dispatch("DEVICE_1");
+    }
+    devices = metaDevicesWithTwoDevs;
+    rank_devices_by_predicted_completion(devices);
+    EXPECT_EQ(devices[0].device_name, "DEVICE_0");
+    EXPECT_EQ(devices[1].device_name, "DEVICE_1");
+}
+
+TEST_F(LoadAwareCumuSchedule, routingStatisticsTrackLatencyAndInFlightRequests) {
+    m_routing_statistics["DEVICE_0"].m_requests = 4;
+    record_request_dispatch("DEVICE_0");
+    record_request_dispatch("DEVICE_0");
+    record_request_completion("DEVICE_0", 10.0, true);
+    // failed inference does not change the latency
+    record_request_dispatch("DEVICE_0");
+    record_request_completion("DEVICE_0", 100.0, false);
+    record_request_dispatch("DEVICE_0");
+    record_request_completion("DEVICE_0", 20.0, true);
+
+    auto statistics = get_routing_statistics().at("DEVICE_0").as<ov::AnyMap>();
+    EXPECT_EQ(statistics.at("REQUESTS").as<uint64_t>(), 4);
+    EXPECT_EQ(statistics.at("IN_FLIGHT").as<uint64_t>(), 1);
+    EXPECT_EQ(statistics.at("INFERENCES").as<uint64_t>(), 2);
+    // moving average: 10 + 0.2 * (20 - 10)
+    EXPECT_DOUBLE_EQ(statistics.at("LATENCY_MS").as<double>(), 12.0);
+    EXPECT_DOUBLE_EQ(statistics.at("PREDICTED_COMPLETION_MS").as<double>(), 12.0 * 2 / 4);
+}
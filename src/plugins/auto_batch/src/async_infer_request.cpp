@@ -65,12 +65,22 @@ AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<SyncInferRequest>& re
                 std::pair<AsyncInferRequest*, ov::threading::Task> t;
                 t.first = _this;
                 t.second = std::move(task);
+                if (workerInferRequest->_adaptive_timeout)
+                    workerInferRequest->_adaptive_timeout->on_request_arrived();
                 workerInferRequest->_tasks.push(t);
                 // it is ok to call size() here as the queue only grows (and the bulk removal happens under the mutex)
                 const int sz = static_cast<int>(workerInferRequest->_tasks.size());
                 if (sz == workerInferRequest->_batch_size) {
                     workerInferRequest->_is_wakeup = true;
                     workerInferRequest->_cond.notify_one();
+                } else if (sz == 1 && workerInferRequest->_adaptive_timeout) {
+                    // let the worker count the tuned timeout from the first request of the batch. The worker checks
+                    // the queue under the mutex before it waits, so taking the mutex here ensures the notification
+                    // is not lost between the check and the wait
+                    {
+                        std::lock_guard<std::mutex> lock(workerInferRequest->_mutex);
+                    }
+                    workerInferRequest->_cond.notify_one();
                 }
             };
             AsyncInferRequest* _this = nullptr;
@@ -112,6 +122,8 @@ std::vector<ov::ProfilingInfo> AsyncInferRequest::get_profiling_info() const {
     check_state();
     if (SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED == m_sync_request->m_batched_request_status)
         return m_sync_request->get_profiling_info();
+    else if (SyncInferRequest::eExecutionFlavor::SUB_BATCH_EXECUTED == m_sync_request->m_batched_request_status)
+        return m_sync_request->m_sub_batch_request->get_profiling_info();
     else
         return m_request_without_batch->get_profiling_info();
 }
@@ -120,6 +132,8 @@ std::vector<ov::SoPtr<ov::IVariableState>> AsyncInferRequest::query_state() cons
     check_state();
     if (SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED == m_sync_request->m_batched_request_status)
         return m_sync_request->query_state();
+    else if (SyncInferRequest::eExecutionFlavor::SUB_BATCH_EXECUTED == m_sync_request->m_batched_request_status)
+        return m_sync_request->m_sub_batch_request->query_state();
     else
         return m_request_without_batch->query_state();
 }
@@ -5,10 +5,55 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #include "compiled_model.hpp"
 
+#include <algorithm>
+
 #include "async_infer_request.hpp"
 
 namespace ov {
 namespace autobatch_plugin {
+namespace {
+// weight of the new sample in the moving averages
+constexpr double smoothing = 0.125;
+// allowance for the jitter of the arrival intervals
+constexpr double arrival_margin = 1.5;
+
+void update_average(double& average, double sample) {
+    average = average < 0 ? sample : average + smoothing * (sample - average);
+}
+
+double to_microseconds(AdaptiveTimeout::Clock::duration duration) {
+    return std::chrono::duration<double, std::micro>(duration).count();
+}
+}  // namespace
+
+AdaptiveTimeout::AdaptiveTimeout(int batch_size) : m_batch_size(batch_size) {}
+
+void AdaptiveTimeout::on_request_arrived(Clock::time_point now) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_has_arrived)
+        update_average(m_arrival_interval, to_microseconds(now - m_last_arrival));
+    m_last_arrival = now;
+    m_has_arrived = true;
+}
+
+void AdaptiveTimeout::on_batch_executed(int batch_size, Clock::duration latency) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    update_average(m_batch_latency.emplace(batch_size, -1.0).first->second, to_microseconds(latency));
+}
+
+std::chrono::microseconds AdaptiveTimeout::get(std::chrono::microseconds limit) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_arrival_interval < 0)
+        return limit;
+    // expected time to collect the rest of the batch
+    double time_out = m_arrival_interval * (m_batch_size - 1) * arrival_margin;
+    // the collected requests gain nothing from waiting longer than the full batch is executed
+    const auto full_batch_latency = m_batch_latency.find(m_batch_size);
+    if (full_batch_latency != m_batch_latency.end())
+        time_out = std::min(time_out, full_batch_latency->second);
+    return std::min(limit, std::chrono::microseconds(static_cast<int64_t>(time_out)));
+}
+
 CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                              const std::shared_ptr<const ov::IPlugin>& plugin,
                              const ov::AnyMap& config,
@@ -17,18 +62,35 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                              const std::set<std::size_t>& batched_outputs,
                              const ov::SoPtr<ov::ICompiledModel>& compiled_model_with_batch,
                              const ov::SoPtr<ov::ICompiledModel>& compiled_model_without_batch,
-                             const ov::SoPtr<ov::IRemoteContext>& context)
+                             const ov::SoPtr<ov::IRemoteContext>& context,
+                             const std::map<int, ov::SoPtr<ov::ICompiledModel>>& compiled_models_with_sub_batch)
     : ov::ICompiledModel(model, plugin, context),
       m_config(config),
       m_batched_inputs(batched_inputs),
       m_batched_outputs(batched_outputs),
       m_compiled_model_with_batch(compiled_model_with_batch),
-      m_compiled_model_without_batch(compiled_model_without_batch) {
+      m_compiled_model_without_batch(compiled_model_without_batch),
+      m_compiled_models_with_sub_batch(compiled_models_with_sub_batch) {
     // WA for gcc 4.8 ( fails compilation with member init-list)
     m_device_info = device_info;
     auto time_out = config.find(ov::auto_batch_timeout.name());
     OPENVINO_ASSERT(time_out != config.end(), "No timeout property be set in config, default will be used!");
     m_time_out = time_out->second.as<std::uint32_t>();
+    auto adaptive_time_out = config.find(ov::auto_batch_adaptive_timeout.name());
+    if (adaptive_time_out != config.end())
+        m_adaptive_time_out = adaptive_time_out->second.as<bool>();
+    auto batch_sizes = config.find(ov::auto_batch_sizes.name());
+    if (batch_sizes != config.end()) {
+        m_batch_ladder = !batch_sizes->second.as<std::vector<uint32_t>>().empty();
+        // the compiled sizes are reported rather than the requested ones
+        m_config.erase(ov::auto_batch_sizes.name());
+    }
+    m_batch_ladder = m_batch_ladder || m_adaptive_time_out;
+    m_dispatch_counts.emplace(1, 0);
+    if (m_compiled_model_with_batch)
+        m_dispatch_counts.emplace(m_device_info.device_batch_size, 0);
+    for (const auto& sub_batch : m_compiled_models_with_sub_batch)
+        m_dispatch_counts.emplace(sub_batch.first, 0);
 }
 
 CompiledModel::~CompiledModel() {
@@ -65,10 +127,21 @@ CompiledModel::GetWorkerInferRequest() const {
         workerRequestPtr->_batch_size = m_device_info.device_batch_size;
         workerRequestPtr->_completion_tasks.resize(workerRequestPtr->_batch_size);
         workerRequestPtr->_is_wakeup = false;
+        for (const auto& sub_batch : m_compiled_models_with_sub_batch) {
+            const auto& compiled_model = sub_batch.second;
+            workerRequestPtr->_sub_batch_requests[sub_batch.first] = {compiled_model->create_infer_request(),
+                                                                       compiled_model._so};
+        }
+        if (m_adaptive_time_out)
+            workerRequestPtr->_adaptive_timeout = std::make_unique<AdaptiveTimeout>(workerRequestPtr->_batch_size);
         workerRequestPtr->_infer_request_batched->set_callback(
             [workerRequestPtr](std::exception_ptr exceptionPtr) mutable {
                 if (exceptionPtr)
                     workerRequestPtr->_exception_ptr = exceptionPtr;
+                if (workerRequestPtr->_adaptive_timeout)
+                    workerRequestPtr->_adaptive_timeout->on_batch_executed(
+                        workerRequestPtr->_batch_size,
+                        AdaptiveTimeout::Clock::now() - workerRequestPtr->_batch_start);
                 OPENVINO_ASSERT(workerRequestPtr->_completion_tasks.size() == (size_t)workerRequestPtr->_batch_size);
                 // notify the individual requests on the completion
                 for (int c = 0; c < workerRequestPtr->_batch_size; c++) {
@@ -80,11 +153,25 @@ CompiledModel::GetWorkerInferRequest() const {
             });
 
         workerRequestPtr->_thread = std::thread([workerRequestPtr, this] {
+            // when the first of the currently collected requests was seen (used by the adaptive timeout only)
+            AdaptiveTimeout::Clock::time_point collection_start;
+            bool collecting = false;
             while (1) {
                 std::cv_status status;
                 {
                     std::unique_lock<std::mutex> lock(workerRequestPtr->_mutex);
-                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(m_time_out));
+                    std::chrono::microseconds time_out = std::chrono::milliseconds(m_time_out);
+                    if (workerRequestPtr->_adaptive_timeout && workerRequestPtr->_tasks.size()) {
+                        const auto now = AdaptiveTimeout::Clock::now();
+                        if (!collecting) {
+                            collection_start = now;
+                            collecting = true;
+                        }
+                        const auto deadline = collection_start + workerRequestPtr->_adaptive_timeout->get(time_out);
+                        time_out = std::max(std::chrono::microseconds(0),
+                                            std::chrono::duration_cast<std::chrono::microseconds>(deadline - now));
+                    }
+                    status = workerRequestPtr->_cond.wait_for(lock, time_out);
                     if ((status != std::cv_status::timeout) && (workerRequestPtr->_is_wakeup == false))
                         continue;
                     workerRequestPtr->_is_wakeup = false;
@@ -96,6 +183,7 @@ CompiledModel::GetWorkerInferRequest() const {
                     // it is ok to call size() (as the _tasks can only grow in parallel)
                     const int sz = static_cast<int>(workerRequestPtr->_tasks.size());
                     if (sz == workerRequestPtr->_batch_size) {
+                        collecting = false;
                         std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
                         for (int n = 0; n < sz; n++) {
                             OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
@@ -104,31 +192,13 @@ CompiledModel::GetWorkerInferRequest() const {
                             t.first->m_sync_request->m_batched_request_status =
                                 ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED;
                         }
+                        workerRequestPtr->_batch_start = AdaptiveTimeout::Clock::now();
+                        m_dispatch_counts.at(workerRequestPtr->_batch_size)++;
                         workerRequestPtr->_infer_request_batched->start_async();
                     } else if ((status == std::cv_status::timeout) && sz) {
-                        // timeout to collect the batch is over, have to execute the requests in the batch1 mode
-                        std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
-                        // popping all tasks collected by the moment of the time-out and execute each with batch1
-                        std::atomic<int> arrived = {0};
-                        std::promise<void> all_completed;
-                        auto all_completed_future = all_completed.get_future();
-                        for (int n = 0; n < sz; n++) {
-                            OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
-                            t.first->m_request_without_batch->set_callback(
-                                [t, sz, &arrived, &all_completed](std::exception_ptr p) {
-                                    if (p)
-                                        t.first->m_sync_request->m_exception_ptr = p;
-                                    t.second();
-                                    if (sz == ++arrived) {
-                                        all_completed.set_value();
-                                    }
-                                });
-                            t.first->m_sync_request->m_batched_request_status =
-                                ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::TIMEOUT_EXECUTED;
-                            t.first->m_sync_request->set_tensors_to_another_request(t.first->m_request_without_batch);
-                            t.first->m_request_without_batch->start_async();
-                        }
-                        all_completed_future.get();
+                        collecting = false;
+                        // timeout to collect the batch is over, have to execute the requests as a partial batch
+                        execute_partial_batch(*workerRequestPtr, sz);
                         // now when all the tasks for this batch are completed, start waiting for the timeout again
                     }
                 }
@@ -138,6 +208,86 @@ CompiledModel::GetWorkerInferRequest() const {
     return {m_worker_requests.back(), static_cast<int>(batch_id)};
 }
 
+void CompiledModel::execute_partial_batch(WorkerInferRequest& worker_request, int size) const {
+    // popping all tasks collected by the moment of the time-out and execute them with the smallest batch of the ladder
+    // that covers them, or each with batch1 when there is no ladder
+    std::atomic<int> arrived = {0};
+    std::promise<void> all_completed;
+    auto all_completed_future = all_completed.get_future();
+    auto on_completed = [size, &arrived, &all_completed](int num) {
+        if (size == (arrived += num)) {
+            all_completed.set_value();
+        }
+    };
+    auto sub_batch = worker_request._sub_batch_requests.lower_bound(size);
+    if (size > 1 && sub_batch != worker_request._sub_batch_requests.end()) {
+        const int batch_size = sub_batch->first;
+        auto& request = sub_batch->second;
+        std::vector<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>> tasks(size);
+        for (int n = 0; n < size; n++) {
+            OPENVINO_ASSERT(worker_request._tasks.try_pop(tasks[n]));
+            tasks[n].first->m_sync_request->copy_inputs_to_sub_batch(request, n, batch_size);
+            tasks[n].first->m_sync_request->m_batched_request_status =
+                ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::SUB_BATCH_EXECUTED;
+        }
+        const auto start = AdaptiveTimeout::Clock::now();
+        request->set_callback(
+            [&worker_request, &request, tasks, batch_size, start, &on_completed](std::exception_ptr p) {
+                if (worker_request._adaptive_timeout)
+                    worker_request._adaptive_timeout->on_batch_executed(batch_size,
+                                                                        AdaptiveTimeout::Clock::now() - start);
+                for (size_t n = 0; n < tasks.size(); n++) {
+                    if (p)
+                        tasks[n].first->m_sync_request->m_exception_ptr = p;
+                    else
+                        tasks[n].first->m_sync_request->copy_outputs_from_sub_batch(request, n, batch_size);
+                    tasks[n].second();
+                }
+                on_completed(static_cast<int>(tasks.size()));
+            });
+        m_dispatch_counts.at(batch_size)++;
+        request->start_async();
+    } else if (size > 1 && m_batch_ladder) {
+        // the largest batch of the ladder, the requests already share the tensors with their slots of the batched
+        // request, while the rest of the slots are the padding
+        std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
+        for (int n = 0; n < worker_request._batch_size; n++) {
+            if (n < size) {
+                OPENVINO_ASSERT(worker_request._tasks.try_pop(t));
+                worker_request._completion_tasks[n] = [task = std::move(t.second), &on_completed] {
+                    task();
+                    on_completed(1);
+                };
+                t.first->m_sync_request->copy_inputs_if_needed();
+                t.first->m_sync_request->m_batched_request_status =
+                    ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED;
+            } else {
+                worker_request._completion_tasks[n] = [] {};
+            }
+        }
+        worker_request._batch_start = AdaptiveTimeout::Clock::now();
+        m_dispatch_counts.at(worker_request._batch_size)++;
+        worker_request._infer_request_batched->start_async();
+    } else {
+        std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
+        for (int n = 0; n < size; n++) {
+            OPENVINO_ASSERT(worker_request._tasks.try_pop(t));
+            t.first->m_request_without_batch->set_callback([t, &on_completed](std::exception_ptr p) {
+                if (p)
+                    t.first->m_sync_request->m_exception_ptr = p;
+                t.second();
+                on_completed(1);
+            });
+            t.first->m_sync_request->m_batched_request_status =
+                ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::TIMEOUT_EXECUTED;
+            t.first->m_sync_request->set_tensors_to_another_request(t.first->m_request_without_batch);
+            m_dispatch_counts.at(1)++;
+            t.first->m_request_without_batch->start_async();
+        }
+    }
+    all_completed_future.get();
+}
+
 std::shared_ptr<ov::IAsyncInferRequest> CompiledModel::create_infer_request() const {
     ov::SoPtr<ov::IAsyncInferRequest> infer_request_without_batch = {
         m_compiled_model_without_batch->create_infer_request(),
@@ -212,7 +362,22 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
                 ov::PropertyName{ov::optimal_number_of_infer_requests.name(), ov::PropertyMutability::RO},
                 ov::PropertyName{ov::model_name.name(), ov::PropertyMutability::RO},
                 ov::PropertyName{ov::execution_devices.name(), ov::PropertyMutability::RO},
-                ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW}};
+                ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW},
+                ov::PropertyName{ov::auto_batch_adaptive_timeout.name(), ov::PropertyMutability::RO},
+                ov::PropertyName{ov::auto_batch_sizes.name(), ov::PropertyMutability::RO},
+                ov::PropertyName{ov::auto_batch_dispatch_counts.name(), ov::PropertyMutability::RO}};
+        } else if (name == ov::auto_batch_adaptive_timeout) {
+            return m_adaptive_time_out;
+        } else if (name == ov::auto_batch_sizes) {
+            std::vector<uint32_t> batch_sizes;
+            for (const auto& counts : m_dispatch_counts)
+                batch_sizes.push_back(counts.first);
+            return batch_sizes;
+        } else if (name == ov::auto_batch_dispatch_counts) {
+            std::map<uint32_t, uint64_t> dispatch_counts;
+            for (const auto& counts : m_dispatch_counts)
+                dispatch_counts[counts.first] = counts.second;
+            return dispatch_counts;
         } else if (name == ov::auto_batch_timeout) {
             uint32_t time_out = m_time_out;
             return time_out;
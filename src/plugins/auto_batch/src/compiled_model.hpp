@@ -5,7 +5,9 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include <chrono>
 #include <condition_variable>
+#include <map>
 #include <thread>
 
 #include "openvino/runtime/iasync_infer_request.hpp"
@@ -18,6 +20,41 @@ namespace autobatch_plugin {
 
 class AsyncInferRequest;
 
+/**
+ * Tunes the time to collect a batch from the observed arrival rate of the requests and the batch execution latency.
+ * Waiting for the missing requests pays off only while they are expected to arrive sooner than a batch is executed,
+ * otherwise the collected requests are executed right away.
+ */
+class AdaptiveTimeout {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit AdaptiveTimeout(int batch_size);
+
+    void on_request_arrived(Clock::time_point now = Clock::now());
+
+    /**
+     * @brief Records the latency of a batch execution
+     * @param batch_size the size of the executed batch, the full and the partial batches are estimated separately
+     */
+    void on_batch_executed(int batch_size, Clock::duration latency);
+
+    /**
+     * @brief Returns the time to wait for the batch to be collected since the first request of the batch arrived
+     * @param limit the upper bound of the timeout, it is used until the arrival rate is known
+     */
+    std::chrono::microseconds get(std::chrono::microseconds limit) const;
+
+private:
+    const int m_batch_size;
+    mutable std::mutex m_mutex;
+    Clock::time_point m_last_arrival;
+    bool m_has_arrived = false;
+    // exponential moving averages, in microseconds
+    double m_arrival_interval = -1.0;
+    std::map<int, double> m_batch_latency;
+};
+
 class CompiledModel : public ov::ICompiledModel {
 public:
     struct WorkerInferRequest {
@@ -31,6 +68,11 @@ public:
         std::mutex _mutex;
         std::exception_ptr _exception_ptr;
         bool _is_wakeup;
+        // the requests to execute the partially collected batches, by the batch size
+        std::map<int, ov::SoPtr<ov::IAsyncInferRequest>> _sub_batch_requests;
+        // set when the timeout is tuned adaptively
+        std::unique_ptr<AdaptiveTimeout> _adaptive_timeout;
+        AdaptiveTimeout::Clock::time_point _batch_start;
     };
 
     CompiledModel(const std::shared_ptr<ov::Model>& model,
@@ -41,7 +83,8 @@ public:
                   const std::set<std::size_t>& batched_outputs,
                   const ov::SoPtr<ov::ICompiledModel>& compiled_model_with_batch,
                   const ov::SoPtr<ov::ICompiledModel>& compiled_model_without_batch,
-                  const ov::SoPtr<ov::IRemoteContext>& context);
+                  const ov::SoPtr<ov::IRemoteContext>& context,
+                  const std::map<int, ov::SoPtr<ov::ICompiledModel>>& compiled_models_with_sub_batch = {});
 
     void set_property(const ov::AnyMap& properties) override;
 
@@ -68,17 +111,24 @@ protected:
 
     std::pair<std::shared_ptr<ov::autobatch_plugin::CompiledModel::WorkerInferRequest>, int> GetWorkerInferRequest()
         const;
+    void execute_partial_batch(WorkerInferRequest& worker_request, int size) const;
     mutable std::vector<std::shared_ptr<WorkerInferRequest>> m_worker_requests;
     mutable std::mutex m_worker_requests_mutex;
 
     mutable std::atomic_size_t m_num_requests_created = {0};
     std::atomic<std::uint32_t> m_time_out = {0};  // in ms
+    bool m_adaptive_time_out = false;
+    // whether the partially collected batches are executed with the smallest covering batch size rather than batch1
+    bool m_batch_ladder = false;
+    // number of the inferences executed with every compiled batch size
+    mutable std::map<uint32_t, std::atomic<uint64_t>> m_dispatch_counts;
 
     const std::set<std::size_t> m_batched_inputs;
     const std::set<std::size_t> m_batched_outputs;
 
     ov::SoPtr<ov::ICompiledModel> m_compiled_model_with_batch;
     ov::SoPtr<ov::ICompiledModel> m_compiled_model_without_batch;
+    std::map<int, ov::SoPtr<ov::ICompiledModel>> m_compiled_models_with_sub_batch;
 };
 }  // namespace autobatch_plugin
 }  // namespace ov
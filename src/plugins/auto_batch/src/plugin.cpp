@@ -22,6 +22,8 @@ namespace autobatch_plugin {
 std::vector<ov::PropertyName> supported_configKeys = {
     ov::PropertyName{ov::device::priorities.name(), ov::PropertyMutability::RW},
     ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW},
+    ov::PropertyName{ov::auto_batch_adaptive_timeout.name(), ov::PropertyMutability::RW},
+    ov::PropertyName{ov::auto_batch_sizes.name(), ov::PropertyMutability::RW},
     ov::PropertyName{ov::enable_profiling.name(), ov::PropertyMutability::RW}};
 
 inline ov::AnyMap merge_properties(ov::AnyMap config, const ov::AnyMap& user_config) {
@@ -118,6 +120,8 @@ OV_DEFINE_PLUGIN_CREATE_FUNCTION(Plugin, version)
 Plugin::Plugin() {
     set_device_name("BATCH");
     m_plugin_config.insert(ov::auto_batch_timeout(1000));  // default value (ms)
+    m_plugin_config.insert(ov::auto_batch_adaptive_timeout(false));
+    m_plugin_config.insert(ov::auto_batch_sizes(std::vector<uint32_t>{}));  // only batch1 and the device batch
     m_plugin_config.insert(ov::enable_profiling(false));
 }
 
@@ -268,28 +272,67 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
         if (supported_configKeys.end() != std::find(supported_configKeys.begin(), supported_configKeys.end(), c.first))
             compiled_model_config.insert(c);
     }
+    auto compile_model_with_batch = [&](uint32_t batch_size) {
+        auto reshaped = model->clone();
+        auto inputs = reshaped->inputs();
+        std::map<std::size_t, ov::PartialShape> partial_shapes;
+        for (size_t input_id = 0; input_id < inputs.size(); input_id++) {
+            auto input_shape = inputs[input_id].get_shape();
+            if (batched_inputs.find(input_id) != batched_inputs.end()) {
+                input_shape[0] = batch_size;
+            }
+            partial_shapes.insert({input_id, ov::PartialShape(input_shape)});
+        }
+
+        reshaped->reshape(partial_shapes);
+        return context ? core->compile_model(reshaped, context, device_config_no_auto_batch)
+                       : core->compile_model(reshaped, device_name, device_config_no_auto_batch);
+    };
     ov::SoPtr<ov::ICompiledModel> compiled_model_with_batch;
-    auto reshaped = model->clone();
     if (meta_device.device_batch_size > 1 && batched_inputs.size()) {
         try {
-            auto inputs = reshaped->inputs();
-            std::map<std::size_t, ov::PartialShape> partial_shapes;
-            for (size_t input_id = 0; input_id < inputs.size(); input_id++) {
-                auto input_shape = inputs[input_id].get_shape();
-                if (batched_inputs.find(input_id) != batched_inputs.end()) {
-                    input_shape[0] = meta_device.device_batch_size;
-                }
-                partial_shapes.insert({input_id, ov::PartialShape(input_shape)});
-            }
-
-            reshaped->reshape(partial_shapes);
-            compiled_model_with_batch = context
-                                            ? core->compile_model(reshaped, context, device_config_no_auto_batch)
-                                            : core->compile_model(reshaped, device_name, device_config_no_auto_batch);
+            compiled_model_with_batch = compile_model_with_batch(meta_device.device_batch_size);
         } catch (const ov::Exception&) {
             meta_device.device_batch_size = 1;
         }
     }
+    // the intermediate sizes of the batch ladder, to execute the partially collected batches
+    std::set<uint32_t> sub_batch_sizes;
+    const auto batch_sizes = full_properties.at(ov::auto_batch_sizes.name()).as<std::vector<uint32_t>>();
+    for (const auto batch_size : batch_sizes) {
+        if (batch_size > 1 && batch_size < meta_device.device_batch_size)
+            sub_batch_sizes.insert(batch_size);
+    }
+    // every size is one more model compiled on the device, so the ladder is capped to bound the compilation time and
+    // the memory footprint
+    constexpr size_t max_sub_batch_sizes = 4;
+    if (sub_batch_sizes.size() > max_sub_batch_sizes)
+        OPENVINO_THROW("Too many batch sizes in ",
+                       ov::auto_batch_sizes.name(),
+                       ": ",
+                       sub_batch_sizes.size(),
+                       " sizes between 1 and the device batch size ",
+                       meta_device.device_batch_size,
+                       ", the maximum is ",
+                       max_sub_batch_sizes);
+    if (batch_sizes.empty() && full_properties.at(ov::auto_batch_adaptive_timeout.name()).as<bool>()) {
+        // the largest power-of-2 sizes, the smaller partial batches are padded to the smallest of them
+        for (uint32_t batch_size = meta_device.device_batch_size / 2;
+             batch_size > 1 && sub_batch_sizes.size() < max_sub_batch_sizes;
+             batch_size /= 2)
+            sub_batch_sizes.insert(batch_size);
+    }
+    std::map<int, ov::SoPtr<ov::ICompiledModel>> compiled_models_with_sub_batch;
+    if (compiled_model_with_batch) {
+        for (const auto batch_size : sub_batch_sizes) {
+            try {
+                compiled_models_with_sub_batch[batch_size] = compile_model_with_batch(batch_size);
+            } catch (const ov::Exception&) {
+                // the batches are executed with the next compiled size that covers them
+                break;
+            }
+        }
+    }
 
     ov::SoPtr<ov::IRemoteContext> device_context;
     if (!context) {
@@ -311,7 +354,8 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
                                            batched_outputs,
                                            compiled_model_with_batch,
                                            compiled_model_without_batch,
-                                           device_context);
+                                           device_context,
+                                           compiled_models_with_sub_batch);
 }
 
 ov::SupportedOpsMap Plugin::query_model(const std::shared_ptr<const ov::Model>& model,
@@ -27,6 +27,13 @@ public:
 
     void copy_outputs_if_needed();
 
+    // Batch-Device impl specific: copies the data to/from the given slot of the request executing a partial batch
+    void copy_inputs_to_sub_batch(ov::SoPtr<ov::IAsyncInferRequest>& req, size_t sub_batch_id, size_t sub_batch_size);
+
+    void copy_outputs_from_sub_batch(ov::SoPtr<ov::IAsyncInferRequest>& req,
+                                     size_t sub_batch_id,
+                                     size_t sub_batch_size);
+
     void infer() override;
 
     std::vector<ov::SoPtr<ov::IVariableState>> query_state() const override;
@@ -40,13 +47,21 @@ public:
     enum eExecutionFlavor : uint8_t {
         NOT_EXECUTED,
         BATCH_EXECUTED,
-        TIMEOUT_EXECUTED
+        TIMEOUT_EXECUTED,
+        SUB_BATCH_EXECUTED
     } m_batched_request_status = eExecutionFlavor::NOT_EXECUTED;
 
+    // the request the partial batch with this request was executed with
+    ov::SoPtr<ov::IAsyncInferRequest> m_sub_batch_request;
+
     size_t get_batch_size() const;
 
 protected:
-    void copy_tensor_if_needed(const ov::SoPtr<ov::ITensor>& src, ov::SoPtr<ov::ITensor>& dst, const bool bInput);
+    void copy_tensor_if_needed(const ov::SoPtr<ov::ITensor>& src,
+                               ov::SoPtr<ov::ITensor>& dst,
+                               const bool bInput,
+                               size_t batch_id,
+                               size_t batch_size);
 
     void share_tensors_with_batched_req(const std::set<std::size_t>& batched_inputs,
                                         const std::set<std::size_t>& batched_outputs);
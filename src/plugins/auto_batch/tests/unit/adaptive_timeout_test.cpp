@@ -0,0 +1,53 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mock_common.hpp"
+
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+
+namespace {
+void arrive(AdaptiveTimeout& timeout, int num, microseconds interval) {
+    auto now = AdaptiveTimeout::Clock::now();
+    for (int n = 0; n < num; n++) {
+        timeout.on_request_arrived(now);
+        now += interval;
+    }
+}
+}  // namespace
+
+TEST(AdaptiveTimeoutTest, LimitIsUsedUntilArrivalRateIsKnown) {
+    AdaptiveTimeout timeout(4);
+    EXPECT_EQ(timeout.get(milliseconds(100)), milliseconds(100));
+    arrive(timeout, 1, microseconds(0));
+    EXPECT_EQ(timeout.get(milliseconds(100)), milliseconds(100));
+}
+
+TEST(AdaptiveTimeoutTest, WaitsForRestOfBatch) {
+    AdaptiveTimeout timeout(4);
+    arrive(timeout, 8, microseconds(1000));
+    // 3 missing requests, arriving every 1ms, with the allowance for the jitter
+    EXPECT_EQ(timeout.get(milliseconds(100)), microseconds(4500));
+    EXPECT_EQ(timeout.get(milliseconds(2)), milliseconds(2));
+}
+
+TEST(AdaptiveTimeoutTest, DoesNotWaitLongerThanBatchLatency) {
+    AdaptiveTimeout timeout(4);
+    arrive(timeout, 8, microseconds(1000));
+    timeout.on_batch_executed(4, milliseconds(2));
+    EXPECT_EQ(timeout.get(milliseconds(100)), milliseconds(2));
+    timeout.on_batch_executed(4, milliseconds(10));
+    EXPECT_EQ(timeout.get(milliseconds(100)), microseconds(3000));
+}
+
+TEST(AdaptiveTimeoutTest, SubBatchLatencyIsEstimatedSeparately) {
+    AdaptiveTimeout timeout(4);
+    arrive(timeout, 8, microseconds(1000));
+    // the partial batches don't tell how long the full batch takes
+    timeout.on_batch_executed(2, microseconds(500));
+    EXPECT_EQ(timeout.get(milliseconds(100)), microseconds(4500));
+    timeout.on_batch_executed(4, milliseconds(2));
+    timeout.on_batch_executed(2, microseconds(500));
+    EXPECT_EQ(timeout.get(milliseconds(100)), milliseconds(2));
+}
@@ -0,0 +1,239 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "async_infer_request.hpp"
+#include "mock_common.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/result.hpp"
+#include "sync_infer_request.hpp"
+#include "unit_test_utils/mocks/openvino/runtime/mock_icore.hpp"
+
+namespace {
+constexpr size_t channels = 4;
+constexpr int device_batch_size = 8;
+
+std::shared_ptr<ov::Model> make_model(size_t batch_size) {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{batch_size, channels});
+    auto relu = std::make_shared<ov::op::v0::Relu>(param);
+    auto result = std::make_shared<ov::op::v0::Result>(relu);
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+}
+
+// the device request, the inference multiplies every input element by 10
+class FakeDeviceInferRequest : public ov::IAsyncInferRequest {
+public:
+    explicit FakeDeviceInferRequest(const std::shared_ptr<ov::IInferRequest>& request)
+        : ov::IAsyncInferRequest(request, nullptr, nullptr) {}
+
+    void set_callback(std::function<void(std::exception_ptr)> callback) override {
+        m_callback = std::move(callback);
+    }
+
+    void start_async() override {
+        m_num_started++;
+        const auto input = get_tensor(get_inputs()[0]);
+        const auto output = get_tensor(get_outputs()[0]);
+        ASSERT_EQ(input->get_size(), output->get_size());
+        const auto* src = input->data<const float>();
+        auto* dst = output->data<float>();
+        for (size_t i = 0; i < input->get_size(); i++) {
+            dst[i] = src[i] * 10.0f;
+        }
+        m_callback(nullptr);
+    }
+
+    int m_num_started = 0;
+
+private:
+    std::function<void(std::exception_ptr)> m_callback;
+};
+
+// exposes the execution of the partially collected batches
+class PartialBatchCompiledModel : public CompiledModel {
+public:
+    using CompiledModel::CompiledModel;
+    using CompiledModel::execute_partial_batch;
+};
+}  // namespace
+
+using PartialBatchTestParams = std::tuple<int,                // number of the collected requests
+                                          std::vector<int>>;  // compiled sizes of the batch ladder
+
+class AutoBatchPartialBatchTest : public ::testing::TestWithParam<PartialBatchTestParams> {
+public:
+    std::shared_ptr<NiceMock<ov::MockICore>> m_core;
+    std::shared_ptr<NiceMock<MockAutoBatchInferencePlugin>> m_auto_batch_plugin;
+    std::shared_ptr<NiceMock<MockICompiledModel>> m_i_compile_model_without_batch;
+    std::map<int, std::shared_ptr<FakeDeviceInferRequest>> m_device_requests;
+    std::shared_ptr<PartialBatchCompiledModel> m_auto_batch_compile_model;
+    std::shared_ptr<CompiledModel::WorkerInferRequest> m_worker;
+    std::vector<std::shared_ptr<AsyncInferRequest>> m_requests;
+    std::vector<std::shared_ptr<FakeDeviceInferRequest>> m_requests_without_batch;
+    std::vector<int> m_completed;
+    int m_size;
+    std::vector<int> m_batch_sizes;
+
+    static std::string getTestCaseName(const testing::TestParamInfo<PartialBatchTestParams>& obj) {
+        const auto& [size, batch_sizes] = obj.param;
+        std::string res = "size_" + std::to_string(size) + "_batch_sizes";
+        for (const auto batch_size : batch_sizes)
+            res += "_" + std::to_string(batch_size);
+        return res;
+    }
+
+    void TearDown() override {
+        m_requests.clear();
+        m_requests_without_batch.clear();
+        m_completed.clear();
+        m_worker.reset();
+        m_auto_batch_compile_model.reset();
+        m_device_requests.clear();
+        m_i_compile_model_without_batch.reset();
+        m_auto_batch_plugin.reset();
+        m_core.reset();
+    }
+
+    void SetUp() override {
+        std::tie(m_size, m_batch_sizes) = this->GetParam();
+        m_core = std::shared_ptr<NiceMock<ov::MockICore>>(new NiceMock<ov::MockICore>());
+        m_auto_batch_plugin =
+            std::shared_ptr<NiceMock<MockAutoBatchInferencePlugin>>(new NiceMock<MockAutoBatchInferencePlugin>());
+        m_auto_batch_plugin->set_core(m_core);
+
+        auto compile = [&](size_t batch_size) -> ov::SoPtr<ov::ICompiledModel> {
+            auto compiled_model = std::make_shared<NiceMock<MockICompiledModel>>(make_model(batch_size),
+                                                                                 m_auto_batch_plugin);
+            auto request = std::make_shared<FakeDeviceInferRequest>(
+                std::make_shared<NiceMock<MockISyncInferRequest>>(compiled_model));
+            if (batch_size == 1)
+                m_i_compile_model_without_batch = compiled_model;
+            else
+                m_device_requests[static_cast<int>(batch_size)] = request;
+            return {compiled_model, {}};
+        };
+        auto compiled_model_with_batch = compile(device_batch_size);
+        auto compiled_model_without_batch = compile(1);
+        std::map<int, ov::SoPtr<ov::ICompiledModel>> compiled_models_with_sub_batch;
+        for (const auto batch_size : m_batch_sizes)
+            compiled_models_with_sub_batch[batch_size] = compile(batch_size);
+
+        ov::AnyMap config = {{ov::auto_batch_timeout(static_cast<uint32_t>(200))}};
+        if (!m_batch_sizes.empty())
+            config[ov::auto_batch_sizes.name()] = std::vector<uint32_t>(m_batch_sizes.begin(), m_batch_sizes.end());
+        m_auto_batch_compile_model =
+            std::make_shared<PartialBatchCompiledModel>(make_model(1),
+                                                        m_auto_batch_plugin,
+                                                        config,
+                                                        DeviceInformation{"CPU", {}, device_batch_size},
+                                                        std::set<std::size_t>{0},
+                                                        std::set<std::size_t>{0},
+                                                        compiled_model_with_batch,
+                                                        compiled_model_without_batch,
+                                                        ov::SoPtr<ov::IRemoteContext>{},
+                                                        compiled_models_with_sub_batch);
+
+        m_worker = std::make_shared<CompiledModel::WorkerInferRequest>();
+        m_worker->_infer_request_batched = {m_device_requests.at(device_batch_size), {}};
+        m_worker->_batch_size = device_batch_size;
+        m_worker->_completion_tasks.resize(device_batch_size);
+        m_worker->_infer_request_batched->set_callback([this](std::exception_ptr) {
+            for (int c = 0; c < m_worker->_batch_size; c++) {
+                m_worker->_completion_tasks[c]();
+            }
+        });
+        for (const auto batch_size : m_batch_sizes)
+            m_worker->_sub_batch_requests[batch_size] = {m_device_requests.at(batch_size), {}};
+    }
+
+    // collects the requests as the worker does and fills the input of every request with its own values
+    void collect(int size) {
+        m_completed.assign(size, 0);
+        for (int n = 0; n < size; n++) {
+            auto sync_request = std::make_shared<SyncInferRequest>(m_auto_batch_compile_model,
+                                                                   m_worker,
+                                                                   n,
+                                                                   device_batch_size,
+                                                                   std::set<std::size_t>{0},
+                                                                   std::set<std::size_t>{0});
+            auto request_without_batch = std::make_shared<FakeDeviceInferRequest>(
+                std::make_shared<NiceMock<MockISyncInferRequest>>(m_i_compile_model_without_batch));
+            m_requests_without_batch.push_back(request_without_batch);
+            auto request = std::make_shared<AsyncInferRequest>(sync_request,
+                                                               ov::SoPtr<ov::IAsyncInferRequest>{request_without_batch},
+                                                               nullptr);
+            m_requests.push_back(request);
+
+            auto* data = sync_request->get_tensor(sync_request->get_inputs()[0])->data<float>();
+            for (size_t i = 0; i < channels; i++)
+                data[i] = static_cast<float>(n * channels + i + 1);
+            m_worker->_tasks.push({request.get(), [this, n] {
+                                       m_completed[n]++;
+                                   }});
+        }
+    }
+
+    // the batch size the collected requests are expected to be executed with
+    int expected_batch_size() const {
+        if (m_size == 1 || m_batch_sizes.empty())
+            return 1;
+        for (const auto batch_size : m_batch_sizes) {
+            if (batch_size >= m_size)
+                return batch_size;
+        }
+        return device_batch_size;
+    }
+};
+
+TEST_P(AutoBatchPartialBatchTest, OutputsMatchEveryRequest) {
+    collect(m_size);
+    m_auto_batch_compile_model->execute_partial_batch(*m_worker, m_size);
+    EXPECT_EQ(m_worker->_tasks.size(), 0u);
+
+    const int batch_size = expected_batch_size();
+    auto expected_status = SyncInferRequest::eExecutionFlavor::SUB_BATCH_EXECUTED;
+    if (batch_size == 1)
+        expected_status = SyncInferRequest::eExecutionFlavor::TIMEOUT_EXECUTED;
+    else if (batch_size == device_batch_size)
+        expected_status = SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED;
+    for (int n = 0; n < m_size; n++) {
+        EXPECT_EQ(m_completed[n], 1);
+        const auto& sync_request = m_requests[n]->m_sync_request;
+        EXPECT_EQ(sync_request->m_batched_request_status, expected_status);
+        EXPECT_EQ(sync_request->m_exception_ptr, nullptr);
+        // every request gets the results of its own inputs, whatever slot of the batch it was executed in
+        const auto* output = sync_request->get_tensor(sync_request->get_outputs()[0])->data<const float>();
+        for (size_t i = 0; i < channels; i++)
+            EXPECT_EQ(output[i], static_cast<float>(n * channels + i + 1) * 10.0f);
+    }
+
+    const auto dispatch_counts = m_auto_batch_compile_model->get_property(ov::auto_batch_dispatch_counts.name())
+                                     .as<std::map<uint32_t, uint64_t>>();
+    for (const auto& counts : dispatch_counts) {
+        const uint64_t expected = static_cast<int>(counts.first) != batch_size ? 0 : batch_size == 1 ? m_size : 1;
+        EXPECT_EQ(counts.second, expected) << "batch size " << counts.first;
+    }
+    for (const auto& request : m_device_requests)
+        EXPECT_EQ(request.second->m_num_started, request.first == batch_size ? 1 : 0) << "batch size " << request.first;
+    for (const auto& request : m_requests_without_batch)
+        EXPECT_EQ(request->m_num_started, batch_size == 1 ? 1 : 0);
+}
+
+const std::vector<PartialBatchTestParams> partial_batch_params = {
+    // batch 1 for a single request
+    PartialBatchTestParams{1, {2, 4}},
+    // the smallest compiled size that covers the collected requests
+    PartialBatchTestParams{2, {2, 4}},
+    PartialBatchTestParams{3, {2, 4}},
+    // the device batch size, the rest of the slots are the padding
+    PartialBatchTestParams{5, {2, 4}},
+    PartialBatchTestParams{7, {2, 4}},
+    // no ladder, every request is executed with batch 1
+    PartialBatchTestParams{3, {}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_AutoBatch_BehaviorTests,
+                         AutoBatchPartialBatchTest,
+                         ::testing::ValuesIn(partial_batch_params),
+                         AutoBatchPartialBatchTest::getTestCaseName);
@@ -126,6 +126,15 @@ TEST_P(PluginCompileModelTest, PluginCompileModelBatchedModelWithRemoteContextTe
     OV_ASSERT_NO_THROW(m_plugin->compile_model(m_model, m_plugin_properities, m_remote_context));
 }
 
+TEST_P(PluginCompileModelTest, PluginCompileModelBatchLadderIsCappedTestCase) {
+    m_model = ov::test::utils::make_multi_single_conv();
+    m_plugin_properities[ov::device::priorities.name()] = "CPU(16)";
+    m_plugin_properities[ov::auto_batch_sizes.name()] = std::vector<uint32_t>{1, 2, 4, 8, 16};
+    OV_ASSERT_NO_THROW(m_plugin->compile_model(m_model, m_plugin_properities));
+    m_plugin_properities[ov::auto_batch_sizes.name()] = std::vector<uint32_t>{2, 3, 4, 6, 8};
+    ASSERT_THROW(m_plugin->compile_model(m_model, m_plugin_properities), ov::Exception);
+}
+
 const std::vector<plugin_compile_model_param> plugin_compile_model_param_test = {
     // Case 1: explicitly apply batch size by config of AUTO_BATCH_DEVICE_CONFIG
     plugin_compile_model_param{{{ov::hint::performance_mode.name(), ov::hint::PerformanceMode::THROUGHPUT},
@@ -205,6 +214,16 @@ const std::vector<plugin_compile_model_param> plugin_compile_model_param_test =
                                 {ov::intel_gpu::device_total_mem_size.name(), static_cast<uint64_t>(4096000000)}},
                                {{ov::auto_batch_timeout(static_cast<uint32_t>(200))}, {ov::device::priorities("CPU(32)")}},
                                32},
+    // Case 5: the ladder of the batch sizes compiled for the adaptive timeout
+    plugin_compile_model_param{{{ov::hint::performance_mode.name(), ov::hint::PerformanceMode::THROUGHPUT},
+                                {ov::optimal_batch_size.name(), static_cast<unsigned int>(16)},
+                                {ov::hint::num_requests(12)},
+                                {ov::intel_gpu::memory_statistics.name(), static_cast<uint64_t>(1024000)},
+                                {ov::intel_gpu::device_total_mem_size.name(), static_cast<uint64_t>(4096000000)}},
+                               {{ov::auto_batch_timeout(static_cast<uint32_t>(200))},
+                                {ov::auto_batch_adaptive_timeout(true)},
+                                {ov::device::priorities("CPU(16)")}},
+                               16},
 };
 
 INSTANTIATE_TEST_SUITE_P(smoke_AutoBatch_BehaviorTests,
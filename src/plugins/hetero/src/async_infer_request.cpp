@@ -21,18 +21,50 @@ struct RequestExecutor : ov::threading::ITaskExecutor {
     ov::threading::Task m_task;
 };
 
+struct PipelineStageExecutor : ov::threading::ITaskExecutor {
+    using JobFactory =
+        std::function<ov::hetero::PipelineStage::Job(std::function<void(std::exception_ptr)> done)>;
+    PipelineStageExecutor(std::shared_ptr<ov::hetero::PipelineStage> stage, JobFactory create_job)
+        : m_stage(std::move(stage)),
+          m_create_job(std::move(create_job)) {}
+    void run(ov::threading::Task task) override {
+        m_stage->run(m_create_job([this, task](std::exception_ptr exception_ptr) {
+            m_exception_ptr = std::move(exception_ptr);
+            task();
+        }));
+    };
+    std::shared_ptr<ov::hetero::PipelineStage> m_stage;
+    JobFactory m_create_job;
+    std::exception_ptr m_exception_ptr;
+};
+
 ov::hetero::AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<ov::hetero::InferRequest>& request,
                                                  const std::shared_ptr<ov::threading::ITaskExecutor>& task_executor,
                                                  const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor)
     : ov::IAsyncInferRequest(request, task_executor, callback_executor),
       m_infer_request(std::static_pointer_cast<ov::hetero::InferRequest>(request)) {
     m_pipeline.clear();
-    for (auto&& request : m_infer_request->m_subrequests) {
-        auto request_executor = std::make_shared<RequestExecutor>(request);
-        m_pipeline.emplace_back(request_executor, [request_executor] {
+    for (size_t i = 0; i < m_infer_request->m_stages.size(); i++) {
+        auto infer_request = m_infer_request.get();
+        auto stage_executor = std::make_shared<PipelineStageExecutor>(
+            m_infer_request->m_stages[i],
+            [infer_request, i](std::function<void(std::exception_ptr)> done) {
+                return infer_request->create_stage_job(i, std::move(done));
+            });
+        m_pipeline.emplace_back(stage_executor, [stage_executor] {
+            if (nullptr != stage_executor->m_exception_ptr) {
+                std::rethrow_exception(stage_executor->m_exception_ptr);
+            }
+        });
+    }
+    for (size_t i = 0; i < m_infer_request->m_subrequests.size(); i++) {
+        auto infer_request = m_infer_request.get();
+        auto request_executor = std::make_shared<RequestExecutor>(m_infer_request->m_subrequests[i]);
+        m_pipeline.emplace_back(request_executor, [request_executor, infer_request, i] {
             if (nullptr != request_executor->m_exception_ptr) {
                 std::rethrow_exception(request_executor->m_exception_ptr);
             }
+            infer_request->update_tensor_handoffs(i);
         });
     }
 }
@@ -46,4 +78,7 @@ void ov::hetero::AsyncInferRequest::cancel() {
     for (auto&& request : m_infer_request->m_subrequests) {
         request->cancel();
     }
+    for (auto&& stage : m_infer_request->m_stages) {
+        stage->cancel(m_infer_request.get());
+    }
 }
\ No newline at end of file
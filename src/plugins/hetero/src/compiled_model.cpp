@@ -4,6 +4,7 @@
 
 #include "compiled_model.hpp"
 
+#include <algorithm>
 #include <memory>
 
 #include "async_infer_request.hpp"
@@ -13,12 +14,28 @@
 #include "openvino/op/util/op_types.hpp"
 #include "openvino/pass/constant_folding.hpp"
 #include "openvino/pass/manager.hpp"
+#include "openvino/runtime/device_id_parser.hpp"
 #include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/system_conf.hpp"
 #include "openvino/util/common_util.hpp"
 #include "openvino/util/xml_parse_utils.hpp"
 #include "properties.hpp"
 
+namespace {
+bool is_cpu(const std::string& device) {
+    return ov::DeviceIDParser(device).get_device_name() == "CPU";
+}
+
+// the pipelined stages on the CPU run concurrently, so they divide the cores instead of each taking all of them
+void share_cpu_cores(size_t cpu_stages, ov::AnyMap& device_config) {
+    if (cpu_stages > 1 && device_config.find(ov::inference_num_threads.name()) == device_config.end()) {
+        const auto threads = std::max(1, ov::get_number_of_cpu_cores() / static_cast<int>(cpu_stages));
+        device_config.insert(ov::inference_num_threads(threads));
+    }
+}
+}  // namespace
+
 ov::hetero::CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                                          const std::vector<ov::hetero::SubmodelInfo>& submodels,
                                          const SubgraphsMappingInfo& mapping_info,
@@ -40,7 +57,8 @@ ov::hetero::CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model
 }
 
 void ov::hetero::CompiledModel::compile_model(const std::vector<ov::hetero::SubmodelInfo>& submodels) {
-    const bool add_exclusive = submodels.size() > 1;
+    // the stages of pipelined execution mode run concurrently, so the submodels do not share the device executor
+    const bool add_exclusive = submodels.size() > 1 && !m_cfg.pipelined_execution;
     const auto& hetero_plugin = get_hetero_plugin();
     const auto& core = hetero_plugin->get_core();
     const auto& device_properties = m_cfg.get_device_properties();
@@ -48,6 +66,12 @@ void ov::hetero::CompiledModel::compile_model(const std::vector<ov::hetero::Subm
     m_compiled_submodels.clear();
     m_compiled_submodels.reserve(submodels.size());
 
+    size_t cpu_stages = 0;
+    for (const auto& submodel : submodels) {
+        if (is_cpu(submodel.first))
+            cpu_stages++;
+    }
+
     for (const auto& [device, sub_model] : submodels) {
         // get meta devices properties for the target device
         auto meta_devices = hetero_plugin->get_properties_per_device(device, device_properties);
@@ -67,6 +91,10 @@ void ov::hetero::CompiledModel::compile_model(const std::vector<ov::hetero::Subm
             }
         }
 
+        if (m_cfg.pipelined_execution && is_cpu(device)) {
+            share_cpu_cores(cpu_stages, device_config);
+        }
+
         // compile the submodel and add to the compiled submodels list
         CompiledModelDesc desc;
         desc.device = device;
@@ -75,6 +103,7 @@ void ov::hetero::CompiledModel::compile_model(const std::vector<ov::hetero::Subm
         m_compiled_submodels.emplace_back(std::move(desc));
     }
     set_inputs_and_outputs();
+    create_pipeline_stages();
 }
 
 ov::hetero::CompiledModel::CompiledModel(std::istream& model,
@@ -109,12 +138,20 @@ ov::hetero::CompiledModel::CompiledModel(std::istream& model,
     m_cfg = ov::hetero::Configuration(properties, m_cfg);
 
     pugi::xml_node subnetworksNode = heteroNode.child("compiled_submodels");
+    size_t cpu_stages = 0;
+    FOREACH_CHILD(subnetworkNode, subnetworksNode, "compiled_submodel") {
+        if (is_cpu(get_str_attr(subnetworkNode, "device")))
+            cpu_stages++;
+    }
     FOREACH_CHILD(subnetworkNode, subnetworksNode, "compiled_submodel") {
         auto device = get_str_attr(subnetworkNode, "device");
 
         auto meta_devices = get_hetero_plugin()->get_properties_per_device(device, m_cfg.get_device_properties());
         assert(meta_devices.size() == 1);
         auto& loadConfig = meta_devices[device];
+        if (m_cfg.pipelined_execution && is_cpu(device)) {
+            share_cpu_cores(cpu_stages, loadConfig);
+        }
 
         ov::SoPtr<ov::ICompiledModel> compiled_model;
         std::shared_ptr<ov::Model> ov_model;
@@ -168,6 +205,22 @@ ov::hetero::CompiledModel::CompiledModel(std::istream& model,
     }
     // clang-format on
     set_inputs_and_outputs();
+    create_pipeline_stages();
+}
+
+void ov::hetero::CompiledModel::create_pipeline_stages() {
+    if (!m_cfg.pipelined_execution)
+        return;
+    for (const auto& comp_model_desc : m_compiled_submodels) {
+        // the variables would be kept by the requests of the pool instead of the infer request they belong to
+        if (comp_model_desc.model && !comp_model_desc.model->get_variables().empty()) {
+            OPENVINO_THROW("Pipelined execution is not supported for the stateful models: submodel on ",
+                           comp_model_desc.device,
+                           " has variables");
+        }
+        m_pipeline_stages.emplace_back(
+            std::make_shared<PipelineStage>(comp_model_desc.device, comp_model_desc.compiled_model));
+    }
 }
 
 std::shared_ptr<ov::ISyncInferRequest> ov::hetero::CompiledModel::create_sync_infer_request() const {
@@ -233,9 +286,13 @@ ov::Any ov::hetero::CompiledModel::get_property(const std::string& name) const {
 
     if (ov::supported_properties == name) {
         auto supported_properties = default_ro_properties();
+        if (!m_pipeline_stages.empty()) {
+            add_ro_properties(ov::hetero::pipeline_stage_statistics.name(), supported_properties);
+        }
         add_ro_properties(ov::supported_properties.name(), supported_properties);
         add_ro_properties(ov::device::properties.name(), supported_properties);
         add_ro_properties(ov::device::priorities.name(), supported_properties);
+        add_ro_properties(ov::hetero::pipelined_execution.name(), supported_properties);
         return decltype(ov::supported_properties)::value_type(std::move(supported_properties));
     } else if (ov::device::properties == name) {
         ov::AnyMap all_devices = {};
@@ -275,6 +332,15 @@ ov::Any ov::hetero::CompiledModel::get_property(const std::string& name) const {
     } else if (ov::hetero::number_of_submodels == name) {
         return decltype(ov::hetero::number_of_submodels)::value_type{
             (m_compiled_submodels.size() - get_hetero_plugin()->independent_submodel_size)};
+    } else if (ov::hetero::pipeline_stage_statistics == name) {
+        OPENVINO_ASSERT(!m_pipeline_stages.empty(),
+                        ov::hetero::pipeline_stage_statistics.name(),
+                        " is available only in pipelined execution mode");
+        std::vector<ov::AnyMap> statistics;
+        for (const auto& stage : m_pipeline_stages) {
+            statistics.emplace_back(stage->get_statistics());
+        }
+        return decltype(ov::hetero::pipeline_stage_statistics)::value_type{std::move(statistics)};
     }
     return m_cfg.get(name);
 }
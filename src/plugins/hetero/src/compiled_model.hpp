@@ -7,6 +7,7 @@
 #include "config.hpp"
 #include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/so_ptr.hpp"
+#include "pipeline_stage.hpp"
 #include "plugin.hpp"
 #include "remote_context.hpp"
 #include "subgraph_collector.hpp"
@@ -56,6 +57,8 @@ private:
 
     void set_inputs_and_outputs();
 
+    void create_pipeline_stages();
+
     Configuration m_cfg;
     std::string m_name;
     const bool m_loaded_from_cache;
@@ -69,6 +72,8 @@ private:
         ov::SoPtr<ov::ICompiledModel> compiled_model;
     };
     std::vector<CompiledModelDesc> m_compiled_submodels;
+    // the stages of pipelined execution mode, one per compiled submodel
+    std::vector<std::shared_ptr<PipelineStage>> m_pipeline_stages;
 };
 }  // namespace hetero
 }  // namespace ov
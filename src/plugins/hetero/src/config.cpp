@@ -33,6 +33,12 @@ Configuration::Configuration(const ov::AnyMap& config, const Configuration& defa
                 }
             }
             modelDistributionPolicy = value.as<std::set<ov::hint::ModelDistributionPolicy>>();
+        } else if (ov::hetero::pipelined_execution == key) {
+            pipelined_execution = value.as<bool>();
+        } else if (ov::hetero::partitioning_mode == key) {
+            partitioning_mode = value.as<PartitioningMode>();
+        } else if (ov::hetero::device_memory_limits == key) {
+            device_memory_limits = value.as<std::map<std::string, uint64_t>>();
         } else if (ov::cache_encryption_callbacks == key) {
             encryption_callbacks = value.as<EncryptionCallbacks>();
         } else {
@@ -48,6 +54,12 @@ ov::Any Configuration::get(const std::string& name) const {
         return {device_priorities};
     } else if (name == ov::hint::model_distribution_policy) {
         return {modelDistributionPolicy};
+    } else if (name == ov::hetero::pipelined_execution) {
+        return {pipelined_execution};
+    } else if (name == ov::hetero::partitioning_mode) {
+        return {partitioning_mode};
+    } else if (name == ov::hetero::device_memory_limits) {
+        return {device_memory_limits};
     } else {
         OPENVINO_THROW("Property was not found: ", name);
     }
@@ -60,7 +72,10 @@ std::vector<ov::PropertyName> Configuration::get_supported() const {
 
 ov::AnyMap Configuration::get_hetero_properties() const {
     return {{ov::device::priorities.name(), device_priorities},
-            {ov::hint::model_distribution_policy.name(), modelDistributionPolicy}};
+            {ov::hint::model_distribution_policy.name(), modelDistributionPolicy},
+            {ov::hetero::pipelined_execution.name(), pipelined_execution},
+            {ov::hetero::partitioning_mode.name(), partitioning_mode},
+            {ov::hetero::device_memory_limits.name(), device_memory_limits}};
 }
 
 ov::AnyMap Configuration::get_device_properties() const {
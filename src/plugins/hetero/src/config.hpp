@@ -38,6 +38,12 @@ struct Configuration {
 
     std::set<ov::hint::ModelDistributionPolicy> modelDistributionPolicy = {};
 
+    bool pipelined_execution = false;
+
+    PartitioningMode partitioning_mode = PartitioningMode::AFFINITY;
+
+    std::map<std::string, uint64_t> device_memory_limits = {};
+
     EncryptionCallbacks encryption_callbacks;
 
     ov::AnyMap device_properties;
@@ -0,0 +1,368 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cost_model_partitioner.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <unordered_map>
+
+#include "openvino/core/except.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convolution.hpp"
+#include "openvino/op/group_conv.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/util/op_types.hpp"
+#include "openvino/op/util/variable_extension.hpp"
+
+namespace {
+
+double estimate_dimension(const ov::Dimension& dimension) {
+    if (dimension.is_static()) {
+        return static_cast<double>(dimension.get_length());
+    }
+    const auto& interval = dimension.get_interval();
+    return interval.has_upper_bound() ? static_cast<double>(interval.get_max_val())
+                                      : std::max(1.0, static_cast<double>(interval.get_min_val()));
+}
+
+double estimate_elements(const ov::PartialShape& shape) {
+    if (shape.rank().is_dynamic()) {
+        return 1.0;
+    }
+    double elements = 1.0;
+    for (const auto& dimension : shape) {
+        elements *= estimate_dimension(dimension);
+    }
+    return elements;
+}
+
+constexpr size_t max_refinement_passes = 16;
+constexpr double objective_epsilon = 1e-6;
+
+}  // namespace
+
+ov::hetero::CostModelPartitioner::CostModelPartitioner(const std::shared_ptr<ov::Model>& model,
+                                                       PartitioningMode mode)
+    : m_model(model),
+      m_mode(mode) {
+    const auto ordered_ops = m_model->get_ordered_ops();
+    std::unordered_map<const ov::Node*, size_t> node_indices;
+    for (size_t i = 0; i < ordered_ops.size(); ++i) {
+        node_indices.emplace(ordered_ops[i].get(), i);
+    }
+
+    m_nodes.resize(ordered_ops.size());
+    for (size_t i = 0; i < ordered_ops.size(); ++i) {
+        auto& node = m_nodes[i];
+        node.node = ordered_ops[i];
+        node.group = std::numeric_limits<size_t>::max();
+        m_output_offsets.push_back(m_outputs.size());
+        for (const auto& output : node.node->outputs()) {
+            node.consumers.emplace_back();
+            for (const auto& target_input : output.get_target_inputs()) {
+                node.consumers.back().push_back(node_indices.at(target_input.get_node()));
+            }
+            m_outputs.emplace_back(i, output.get_index());
+            m_output_bytes.push_back(get_tensor_bytes(output));
+        }
+    }
+
+    // the constants and the parameters used by a single operation follow it
+    const auto get_single_consumer = [&](size_t node_idx) {
+        size_t consumer = std::numeric_limits<size_t>::max();
+        for (const auto& output_consumers : m_nodes[node_idx].consumers) {
+            for (auto consumer_idx : output_consumers) {
+                if (consumer != std::numeric_limits<size_t>::max() && consumer != consumer_idx) {
+                    return std::numeric_limits<size_t>::max();
+                }
+                consumer = consumer_idx;
+            }
+        }
+        if (consumer != std::numeric_limits<size_t>::max() && ov::op::util::is_output(m_nodes[consumer].node)) {
+            return std::numeric_limits<size_t>::max();
+        }
+        return consumer;
+    };
+    std::vector<size_t> owners(m_nodes.size(), std::numeric_limits<size_t>::max());
+    for (size_t i = 0; i < m_nodes.size(); ++i) {
+        const auto& node = m_nodes[i].node;
+        if (ov::op::util::is_constant(node) || ov::op::util::is_parameter(node)) {
+            owners[i] = get_single_consumer(i);
+        }
+    }
+    // the state of a variable is kept by the device, so its ReadValue and Assign operations are moved together
+    std::unordered_map<std::string, size_t> variable_groups;
+    for (size_t i = 0; i < m_nodes.size(); ++i) {
+        const auto& node = m_nodes[i].node;
+        if (owners[i] == std::numeric_limits<size_t>::max() && !ov::op::util::is_output(node)) {
+            if (const auto variable = std::dynamic_pointer_cast<ov::op::util::VariableExtension>(node)) {
+                const auto group = variable_groups.emplace(variable->get_variable_id(), m_groups.size());
+                if (!group.second) {
+                    m_nodes[i].group = group.first->second;
+                    continue;
+                }
+            }
+            m_nodes[i].group = m_groups.size();
+            m_groups.emplace_back();
+        }
+    }
+    for (size_t i = 0; i < m_nodes.size(); ++i) {
+        if (owners[i] != std::numeric_limits<size_t>::max()) {
+            m_nodes[i].group = m_nodes[owners[i]].group;
+        } else if (ov::op::util::is_output(m_nodes[i].node)) {
+            const auto& producer = m_nodes[i].node->get_input_node_ptr(0);
+            m_nodes[i].group = m_nodes[node_indices.at(producer)].group;
+        }
+    }
+
+    for (size_t i = 0; i < m_nodes.size(); ++i) {
+        auto& group = m_groups[m_nodes[i].group];
+        group.nodes.push_back(i);
+        group.cost += get_op_cost(m_nodes[i].node);
+        if (const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(m_nodes[i].node)) {
+            group.constants_bytes += constant->get_byte_size();
+        }
+    }
+    for (size_t g = 0; g < m_groups.size(); ++g) {
+        auto& group = m_groups[g];
+        for (auto node_idx : group.nodes) {
+            const auto& node = m_nodes[node_idx];
+            for (size_t port = 0; port < node.consumers.size(); ++port) {
+                group.affected_outputs.push_back(m_output_offsets[node_idx] + port);
+                for (auto consumer_idx : node.consumers[port]) {
+                    if (m_nodes[consumer_idx].group != g) {
+                        group.neighbours.push_back(consumer_idx);
+                    }
+                }
+            }
+            for (const auto& input : node.node->inputs()) {
+                const auto& source = input.get_source_output();
+                const auto producer_idx = node_indices.at(source.get_node());
+                if (m_nodes[producer_idx].group != g) {
+                    group.affected_outputs.push_back(m_output_offsets[producer_idx] + source.get_index());
+                    group.neighbours.push_back(producer_idx);
+                }
+            }
+        }
+        for (auto* indices : {&group.affected_outputs, &group.neighbours}) {
+            std::sort(indices->begin(), indices->end());
+            indices->erase(std::unique(indices->begin(), indices->end()), indices->end());
+        }
+    }
+}
+
+double ov::hetero::CostModelPartitioner::get_op_cost(const std::shared_ptr<ov::Node>& node) {
+    const auto& rt_info = node->get_rt_info();
+    const auto it = rt_info.find("cost");
+    if (it != rt_info.end()) {
+        return it->second.as<double>();
+    }
+    if (ov::op::util::is_constant(node) || ov::op::util::is_parameter(node) || ov::op::util::is_output(node)) {
+        return 0.0;
+    }
+
+    double elements = 0.0;
+    for (const auto& output : node->outputs()) {
+        elements += estimate_elements(output.get_partial_shape());
+    }
+    double reduction = 1.0;
+    if (const auto matmul = ov::as_type_ptr<ov::op::v0::MatMul>(node)) {
+        const auto& shape = node->get_input_partial_shape(0);
+        if (shape.rank().is_static() && shape.size() > 0) {
+            const auto& dimension =
+                matmul->get_transpose_a() && shape.size() > 1 ? shape[shape.size() - 2] : shape[shape.size() - 1];
+            reduction = estimate_dimension(dimension);
+        }
+    } else if (ov::is_type<ov::op::v1::Convolution>(node) || ov::is_type<ov::op::v1::GroupConvolution>(node)) {
+        // the weights are [C_OUT, C_IN, ...] or [GROUPS, C_OUT, C_IN, ...]
+        const auto& weights = node->get_input_partial_shape(1);
+        const size_t output_channels_dims = ov::is_type<ov::op::v1::Convolution>(node) ? 1 : 2;
+        if (weights.rank().is_static() && weights.size() > output_channels_dims) {
+            double output_channels = 1.0;
+            for (size_t i = 0; i < output_channels_dims; ++i) {
+                output_channels *= estimate_dimension(weights[i]);
+            }
+            if (output_channels > 0.0) {
+                reduction = estimate_elements(weights) / output_channels;
+            }
+        }
+    }
+    return elements * reduction;
+}
+
+uint64_t ov::hetero::CostModelPartitioner::get_tensor_bytes(const ov::Output<ov::Node>& output) {
+    const auto bits = estimate_elements(output.get_partial_shape()) * output.get_element_type().bitwidth();
+    return static_cast<uint64_t>(std::ceil(bits / 8));
+}
+
+ov::SupportedOpsMap ov::hetero::CostModelPartitioner::run(const std::vector<Device>& devices) {
+    OPENVINO_ASSERT(!devices.empty(), "Cost model partitioning requires at least one device");
+    m_loads.assign(devices.size(), 0.0);
+    m_memory.assign(devices.size(), 0);
+    initial_assignment(devices);
+    refine(devices);
+
+    ov::SupportedOpsMap affinities;
+    for (const auto& node : m_nodes) {
+        affinities.emplace(node.node->get_friendly_name(), devices[m_groups[node.group].device].name);
+    }
+    return affinities;
+}
+
+bool ov::hetero::CostModelPartitioner::is_supported(size_t group_idx,
+                                                    size_t device_idx,
+                                                    const std::vector<Device>& devices) const {
+    const auto& group = m_groups[group_idx];
+    const auto& device = devices[device_idx];
+    if (device.memory_limit != 0 && m_memory[device_idx] + group.constants_bytes > device.memory_limit) {
+        return false;
+    }
+    return std::all_of(group.nodes.begin(), group.nodes.end(), [&](size_t node_idx) {
+        return device.supported_ops.count(m_nodes[node_idx].node->get_friendly_name()) != 0;
+    });
+}
+
+size_t ov::hetero::CostModelPartitioner::get_device(size_t node_idx) const {
+    return m_groups[m_nodes[node_idx].group].device;
+}
+
+ov::hetero::CostModelPartitioner::Cut ov::hetero::CostModelPartitioner::get_cut(
+    const std::vector<size_t>& outputs) const {
+    Cut cut;
+    std::vector<size_t> remote_devices;
+    for (auto output_idx : outputs) {
+        const auto& [node_idx, port] = m_outputs[output_idx];
+        const auto device = get_device(node_idx);
+        remote_devices.clear();
+        for (auto consumer_idx : m_nodes[node_idx].consumers[port]) {
+            const auto consumer_device = get_device(consumer_idx);
+            if (consumer_device != device &&
+                std::find(remote_devices.begin(), remote_devices.end(), consumer_device) == remote_devices.end()) {
+                remote_devices.push_back(consumer_device);
+            }
+        }
+        cut.bytes += static_cast<double>(m_output_bytes[output_idx]) * static_cast<double>(remote_devices.size());
+        cut.transfers += remote_devices.size();
+    }
+    return cut;
+}
+
+void ov::hetero::CostModelPartitioner::move(size_t group_idx, size_t device_idx) {
+    auto& group = m_groups[group_idx];
+    m_loads[group.device] -= group.cost;
+    m_memory[group.device] -= group.constants_bytes;
+    group.device = device_idx;
+    m_loads[group.device] += group.cost;
+    m_memory[group.device] += group.constants_bytes;
+}
+
+void ov::hetero::CostModelPartitioner::initial_assignment(const std::vector<Device>& devices) {
+    double total_cost = 0.0;
+    for (const auto& group : m_groups) {
+        total_cost += group.cost;
+    }
+
+    double cumulative_cost = 0.0;
+    for (size_t g = 0; g < m_groups.size(); ++g) {
+        auto& group = m_groups[g];
+        // BALANCED splits the topological order into the equal shares of the cost, MIN_CUT keeps the device of
+        // the producer to avoid the transfers, otherwise the first device in the priority list is taken
+        std::vector<size_t> preferred_devices;
+        if (m_mode == PartitioningMode::BALANCED && total_cost > 0.0) {
+            const auto share = static_cast<size_t>(cumulative_cost / total_cost * static_cast<double>(devices.size()));
+            preferred_devices.push_back(std::min(share, devices.size() - 1));
+        }
+        for (auto neighbour_idx : group.neighbours) {
+            if (neighbour_idx < group.nodes.front() && m_nodes[neighbour_idx].group < g) {
+                preferred_devices.push_back(get_device(neighbour_idx));
+                break;
+            }
+        }
+        for (size_t d = 0; d < devices.size(); ++d) {
+            preferred_devices.push_back(d);
+        }
+        cumulative_cost += group.cost;
+
+        const auto device = std::find_if(preferred_devices.begin(), preferred_devices.end(), [&](size_t device_idx) {
+            return is_supported(g, device_idx, devices);
+        });
+        if (device == preferred_devices.end()) {
+            for (auto node_idx : group.nodes) {
+                const auto& node = m_nodes[node_idx].node;
+                const bool supported = std::any_of(devices.begin(), devices.end(), [&](const Device& device) {
+                    return device.supported_ops.count(node->get_friendly_name()) != 0;
+                });
+                if (!supported) {
+                    OPENVINO_THROW("Hetero device used cost model partitioning, but some layers eg: \n(Name:",
+                                   node->get_friendly_name(),
+                                   ", Type: ",
+                                   node->get_type_name(),
+                                   ") were not able to be assigned on any pointed device.");
+                }
+            }
+            OPENVINO_THROW("Hetero device used cost model partitioning, but the constants of the layer ",
+                           m_nodes[group.nodes.front()].node->get_friendly_name(),
+                           " exceed the memory limits of all the devices supporting it");
+        }
+        group.device = *device;
+        m_loads[group.device] += group.cost;
+        m_memory[group.device] += group.constants_bytes;
+    }
+}
+
+void ov::hetero::CostModelPartitioner::refine(const std::vector<Device>& devices) {
+    if (devices.size() < 2) {
+        return;
+    }
+    for (size_t pass = 0; pass < max_refinement_passes; ++pass) {
+        bool improved = false;
+        for (size_t g = 0; g < m_groups.size(); ++g) {
+            auto& group = m_groups[g];
+            const auto current_device = group.device;
+            const auto current_cut = get_cut(group.affected_outputs);
+
+            size_t best_device = current_device;
+            std::pair<double, double> best_gain{0.0, 0.0};
+            for (auto neighbour_idx : group.neighbours) {
+                const auto device = get_device(neighbour_idx);
+                if (device == current_device || device == best_device) {
+                    continue;
+                }
+                if (!is_supported(g, device, devices)) {
+                    continue;
+                }
+
+                group.device = device;
+                const auto cut = get_cut(group.affected_outputs);
+                group.device = current_device;
+                // the balance is not paid for with more transfers
+                if (m_mode == PartitioningMode::BALANCED && cut.transfers > current_cut.transfers) {
+                    continue;
+                }
+                const auto cut_delta = cut.bytes - current_cut.bytes;
+                // the change of the sum of squared loads
+                const auto load_delta = 2.0 * group.cost * (m_loads[device] - m_loads[current_device] + group.cost);
+
+                const auto gain = m_mode == PartitioningMode::BALANCED ? std::make_pair(load_delta, cut_delta)
+                                                                       : std::make_pair(cut_delta, load_delta);
+                const auto primary_threshold = objective_epsilon * std::max(1.0, std::abs(best_gain.first));
+                if (gain.first < best_gain.first - primary_threshold ||
+                    (gain.first <= best_gain.first + primary_threshold &&
+                     gain.second < best_gain.second - objective_epsilon * std::max(1.0, std::abs(best_gain.second)))) {
+                    best_gain = gain;
+                    best_device = device;
+                }
+            }
+            if (best_device != current_device) {
+                move(g, best_device);
+                improved = true;
+            }
+        }
+        if (!improved) {
+            break;
+        }
+    }
+}
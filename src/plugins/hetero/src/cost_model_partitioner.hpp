@@ -0,0 +1,105 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "openvino/core/model.hpp"
+#include "openvino/runtime/common.hpp"
+#include "properties.hpp"
+
+namespace ov {
+namespace hetero {
+
+/**
+ * Assigns the operations of the model to the devices using the estimated cost of the operations and the bytes of the
+ * tensors transferred between the devices. The initial assignment is refined by moving the operations on the borders
+ * of the subgraphs to the neighbouring devices while it improves the objective of the partitioning mode:
+ *  - MIN_CUT minimizes the transferred bytes, the sum of squared device loads breaks the ties
+ *  - BALANCED minimizes the sum of squared device loads, the transferred bytes break the ties, the moves which
+ *    increase the number of the tensors transferred between the devices are not taken
+ * The size of the constants assigned to a device never exceeds its memory limit. The ReadValue and Assign operations
+ * of a variable are always assigned to the same device.
+ */
+class CostModelPartitioner {
+public:
+    struct Device {
+        std::string name;
+        // friendly names of the operations supported by the device
+        std::unordered_set<std::string> supported_ops;
+        // maximum size of the constants in bytes, 0 - no limit
+        uint64_t memory_limit = 0;
+    };
+
+    CostModelPartitioner(const std::shared_ptr<ov::Model>& model, PartitioningMode mode);
+
+    /**
+     * @param devices the devices in the priority order
+     * @return the device of every operation of the model
+     */
+    ov::SupportedOpsMap run(const std::vector<Device>& devices);
+
+    /**
+     * @brief Estimated cost of the operation: the "cost" runtime info attribute if it is set, otherwise the number of
+     * the output elements multiplied by the reduction size of MatMul and convolutions
+     */
+    static double get_op_cost(const std::shared_ptr<ov::Node>& node);
+
+    /**
+     * @brief Estimated size of the tensor, dynamic dimensions are counted by their upper bound or as 1
+     */
+    static uint64_t get_tensor_bytes(const ov::Output<ov::Node>& output);
+
+private:
+    void initial_assignment(const std::vector<Device>& devices);
+    void refine(const std::vector<Device>& devices);
+    bool is_supported(size_t group_idx, size_t device_idx, const std::vector<Device>& devices) const;
+    size_t get_device(size_t node_idx) const;
+    struct Cut {
+        double bytes = 0.0;
+        // number of the tensors transferred between the devices, counted once per consumer device
+        size_t transfers = 0;
+    };
+    Cut get_cut(const std::vector<size_t>& outputs) const;
+    void move(size_t group_idx, size_t device_idx);
+
+    struct Node {
+        std::shared_ptr<ov::Node> node;
+        size_t group;
+        // indices of the consumer nodes of every output
+        std::vector<std::vector<size_t>> consumers;
+    };
+
+    // the node which is moved between the devices together with the constants and the parameters used only by it
+    // and the results of its outputs, the ReadValue and Assign operations of a variable share the group
+    struct Group {
+        std::vector<size_t> nodes;
+        double cost = 0.0;
+        uint64_t constants_bytes = 0;
+        size_t device = 0;
+        // the outputs the cut of which changes when the group is moved
+        std::vector<size_t> affected_outputs;
+        // the nodes outside of the group connected to it
+        std::vector<size_t> neighbours;
+    };
+
+    const std::shared_ptr<ov::Model> m_model;
+    const PartitioningMode m_mode;
+    std::vector<Node> m_nodes;
+    std::vector<Group> m_groups;
+    // all the outputs of the nodes as (node index, output index), the outputs of a node are stored contiguously
+    std::vector<std::pair<size_t, size_t>> m_outputs;
+    std::vector<size_t> m_output_offsets;
+    std::vector<uint64_t> m_output_bytes;
+    std::vector<double> m_loads;
+    std::vector<uint64_t> m_memory;
+};
+
+}  // namespace hetero
+}  // namespace ov
@@ -0,0 +1,153 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "pipeline_stage.hpp"
+
+#include <algorithm>
+#include <optional>
+#include <utility>
+
+#include "openvino/runtime/exception.hpp"
+#include "openvino/runtime/properties.hpp"
+
+ov::hetero::PipelineStage::PipelineStage(const std::string& device,
+                                         const ov::SoPtr<ov::ICompiledModel>& compiled_model)
+    : m_device(device) {
+    unsigned int pool_size = 1u;
+    try {
+        pool_size = std::max(
+            pool_size,
+            compiled_model->get_property(ov::optimal_number_of_infer_requests.name()).as<unsigned int>());
+    } catch (const ov::Exception&) {
+        // the device does not report the optimal number of requests, one request keeps the stage in order
+    }
+    m_slots.resize(pool_size);
+    for (size_t i = 0; i < m_slots.size(); ++i) {
+        m_slots[i].request = {compiled_model->create_infer_request(), compiled_model._so};
+        m_free_slots.push_back(m_slots.size() - 1 - i);
+    }
+}
+
+void ov::hetero::PipelineStage::run(Job job) {
+    size_t slot_idx = 0;
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        if (m_free_slots.empty()) {
+            m_queue.push_back({std::move(job), Clock::now()});
+            m_max_queue_depth = std::max(m_max_queue_depth, m_queue.size());
+            return;
+        }
+        slot_idx = m_free_slots.back();
+        m_free_slots.pop_back();
+    }
+    start(slot_idx, std::move(job));
+}
+
+void ov::hetero::PipelineStage::start(size_t slot_idx, Job job) {
+    auto& slot = m_slots[slot_idx];
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        slot.job = std::move(job);
+        slot.start = Clock::now();
+        if (!m_started) {
+            m_first_start = slot.start;
+            m_started = true;
+        }
+    }
+    try {
+        slot.job.bind(*slot.request._ptr);
+        // the callback is set before every start: the request may be restarted by its own callback,
+        // while the request still holds the callback being executed
+        slot.request->set_callback([this, slot_idx](std::exception_ptr exception_ptr) {
+            on_completed(slot_idx, std::move(exception_ptr));
+        });
+        slot.request->start_async();
+    } catch (...) {
+        on_completed(slot_idx, std::current_exception());
+    }
+}
+
+void ov::hetero::PipelineStage::on_completed(size_t slot_idx, std::exception_ptr exception_ptr) {
+    auto& slot = m_slots[slot_idx];
+    if (nullptr == exception_ptr && slot.job.collect) {
+        try {
+            slot.job.collect(*slot.request._ptr);
+        } catch (...) {
+            exception_ptr = std::current_exception();
+        }
+    }
+
+    std::optional<QueuedJob> next;
+    Job job;
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        job = std::move(slot.job);
+        slot.job = {};
+        const auto now = Clock::now();
+        m_busy_time += now - slot.start;
+        ++m_inferences;
+        if (m_queue.empty()) {
+            m_free_slots.push_back(slot_idx);
+        } else {
+            next = std::move(m_queue.front());
+            m_queue.pop_front();
+            m_queue_wait_time += now - next->enqueued;
+        }
+    }
+    if (next) {
+        start(slot_idx, std::move(next->job));
+    }
+    job.done(exception_ptr);
+}
+
+void ov::hetero::PipelineStage::cancel(const void* owner) {
+    std::vector<Job> cancelled;
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        for (auto& slot : m_slots) {
+            if (slot.job.owner == owner) {
+                slot.request->cancel();
+            }
+        }
+        for (auto it = m_queue.begin(); it != m_queue.end();) {
+            if (it->job.owner == owner) {
+                cancelled.push_back(std::move(it->job));
+                it = m_queue.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+    if (cancelled.empty()) {
+        return;
+    }
+    std::exception_ptr exception_ptr;
+    try {
+        ov::Cancelled::create("Infer Request was canceled");
+    } catch (...) {
+        exception_ptr = std::current_exception();
+    }
+    for (auto& job : cancelled) {
+        job.done(exception_ptr);
+    }
+}
+
+ov::AnyMap ov::hetero::PipelineStage::get_statistics() const {
+    using Milliseconds = std::chrono::duration<double, std::milli>;
+    std::lock_guard<std::mutex> lock{m_mutex};
+    double utilization = 0.0;
+    if (m_started) {
+        const auto elapsed = Milliseconds(Clock::now() - m_first_start).count() * static_cast<double>(m_slots.size());
+        if (elapsed > 0.0) {
+            utilization = std::min(1.0, Milliseconds(m_busy_time).count() / elapsed);
+        }
+    }
+    return {{"DEVICE", m_device},
+            {"REQUESTS", static_cast<uint64_t>(m_slots.size())},
+            {"INFERENCES", m_inferences},
+            {"BUSY_TIME_MS", Milliseconds(m_busy_time).count()},
+            {"QUEUE_WAIT_TIME_MS", Milliseconds(m_queue_wait_time).count()},
+            {"MAX_QUEUE_DEPTH", static_cast<uint64_t>(m_max_queue_depth)},
+            {"UTILIZATION", utilization}};
+}
@@ -0,0 +1,88 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "openvino/runtime/iasync_infer_request.hpp"
+#include "openvino/runtime/icompiled_model.hpp"
+#include "openvino/runtime/so_ptr.hpp"
+
+namespace ov {
+namespace hetero {
+
+/**
+ * Executes one submodel in pipelined execution mode. The stage owns a pool of infer requests of the submodel shared
+ * by all the infer requests of the HETERO compiled model: a job takes a free request of the pool or waits in the queue
+ * of the stage, so the next job does not wait for the whole chain of submodels of the previous one.
+ */
+class PipelineStage {
+public:
+    struct Job {
+        // the infer request of the HETERO compiled model the job belongs to
+        const void* owner = nullptr;
+        // binds the tensors of the owner to the request of the pool before the inference
+        std::function<void(ov::IAsyncInferRequest&)> bind;
+        // takes the results the request of the pool has allocated itself after the successful inference
+        std::function<void(ov::IAsyncInferRequest&)> collect;
+        // called when the request of the pool is released
+        std::function<void(std::exception_ptr)> done;
+    };
+
+    PipelineStage(const std::string& device, const ov::SoPtr<ov::ICompiledModel>& compiled_model);
+
+    /**
+     * @brief Starts the job on a free request of the pool or puts it to the queue
+     */
+    void run(Job job);
+
+    /**
+     * @brief Cancels the running jobs of the owner and completes its queued jobs with the ov::Cancelled exception
+     */
+    void cancel(const void* owner);
+
+    ov::AnyMap get_statistics() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Slot {
+        ov::SoPtr<ov::IAsyncInferRequest> request;
+        Job job;
+        Clock::time_point start;
+    };
+
+    struct QueuedJob {
+        Job job;
+        Clock::time_point enqueued;
+    };
+
+    void start(size_t slot_idx, Job job);
+
+    void on_completed(size_t slot_idx, std::exception_ptr exception_ptr);
+
+    const std::string m_device;
+    std::vector<Slot> m_slots;
+    std::vector<size_t> m_free_slots;
+    std::deque<QueuedJob> m_queue;
+    mutable std::mutex m_mutex;
+
+    uint64_t m_inferences = 0;
+    size_t m_max_queue_depth = 0;
+    Clock::duration m_busy_time = Clock::duration::zero();
+    Clock::duration m_queue_wait_time = Clock::duration::zero();
+    Clock::time_point m_first_start;
+    bool m_started = false;
+};
+
+}  // namespace hetero
+}  // namespace ov
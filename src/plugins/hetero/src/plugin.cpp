@@ -13,6 +13,7 @@
 #include <vector>
 
 #include "compiled_model.hpp"
+#include "cost_model_partitioner.hpp"
 #include "itt.hpp"
 #include "op/device_subgraph.hpp"
 #include "openvino/core/graph_util.hpp"
@@ -50,11 +51,17 @@ std::pair<ov::hetero::SubgraphsMappingInfo, std::vector<ov::hetero::SubmodelInfo
         }
     }
 
-    if (user_set_affinities) {
-        // All affinities must be defined by user
+    const bool cost_model_partitioning =
+        !user_set_affinities && config.partitioning_mode != ov::hetero::PartitioningMode::AFFINITY;
+    if (cost_model_partitioning) {
+        query_model_result = query_model_by_cost(model, config);
+    }
+
+    if (user_set_affinities || cost_model_partitioning) {
+        // All affinities must be defined by user or by the cost model
         ov::hetero::SubgraphsVector ordered_subgraphs;
         std::tie(ordered_subgraphs, mapping_info) =
-            get_model_subgraphs(model, query_model_result, true, m_cfg.dump_dot_files());
+            get_model_subgraphs(model, query_model_result, user_set_affinities, m_cfg.dump_dot_files());
 
         submodels.resize(ordered_subgraphs.size());
         for (size_t i = 0; i < ordered_subgraphs.size(); ++i) {
@@ -342,6 +349,40 @@ std::pair<ov::SupportedOpsMap, ov::hetero::SubgraphsMappingInfo> ov::hetero::Plu
     return {supported_ops_final, mapping_info};
 }
 
+ov::SupportedOpsMap ov::hetero::Plugin::query_model_by_cost(const std::shared_ptr<ov::Model>& model,
+                                                            const Configuration& config) const {
+    OV_ITT_SCOPED_TASK(itt::domains::Hetero, "Plugin::query_model_by_cost");
+
+    DeviceProperties properties_per_device =
+        get_properties_per_device(config.device_priorities, config.get_device_properties());
+    const auto device_names = ov::DeviceIDParser::get_hetero_devices(config.device_priorities);
+    // the pipeline parallel policy splits the model by the memory of the devices, the cost model takes the memory
+    // of the devices as the limits unless they are set explicitly
+    std::map<std::string, size_t> available_device_mem_map;
+    if (config.modelDistributionPolicy.count(ov::hint::ModelDistributionPolicy::PIPELINE_PARALLEL) != 0) {
+        get_device_memory_map(device_names, available_device_mem_map);
+    }
+    std::vector<CostModelPartitioner::Device> devices;
+    for (const auto& device_name : device_names) {
+        CostModelPartitioner::Device device;
+        device.name = device_name;
+        for (const auto& layer_query_result :
+             get_core()->query_model(model, device_name, properties_per_device.at(device_name))) {
+            device.supported_ops.insert(layer_query_result.first);
+        }
+        const auto memory_limit = config.device_memory_limits.find(device_name);
+        const auto available_memory = available_device_mem_map.find(device_name);
+        if (memory_limit != config.device_memory_limits.end()) {
+            device.memory_limit = memory_limit->second;
+        } else if (available_memory != available_device_mem_map.end() && device_name.find("CPU") != 0) {
+            // the same estimate of the memory required for the constants as the affinity mode uses
+            device.memory_limit = std::max<uint64_t>(1, static_cast<uint64_t>(available_memory->second / 1.2));
+        }
+        devices.emplace_back(std::move(device));
+    }
+    return CostModelPartitioner(model, config.partitioning_mode).run(devices);
+}
+
 ov::SupportedOpsMap ov::hetero::Plugin::query_model(const std::shared_ptr<const ov::Model>& model,
                                                     const ov::AnyMap& properties) const {
     OV_ITT_SCOPED_TASK(itt::domains::Hetero, "Plugin::query_model");
@@ -350,6 +391,10 @@ ov::SupportedOpsMap ov::hetero::Plugin::query_model(const std::shared_ptr<const
 
     std::shared_ptr<ov::Model> query_model = model->clone();
 
+    Configuration full_config{properties, m_cfg};
+    if (full_config.partitioning_mode != ov::hetero::PartitioningMode::AFFINITY) {
+        return query_model_by_cost(query_model, full_config);
+    }
     return query_model_update(query_model, properties).first;
 }
 
@@ -365,7 +410,11 @@ ov::Any ov::hetero::Plugin::get_property(const std::string& name, const ov::AnyM
         return ro_properties;
     };
     const auto& default_rw_properties = []() {
-        std::vector<ov::PropertyName> rw_properties{ov::device::priorities, ov::hint::model_distribution_policy};
+        std::vector<ov::PropertyName> rw_properties{ov::device::priorities,
+                                                    ov::hint::model_distribution_policy,
+                                                    ov::hetero::pipelined_execution,
+                                                    ov::hetero::partitioning_mode,
+                                                    ov::hetero::device_memory_limits};
         return rw_properties;
     };
 
@@ -77,6 +77,8 @@ private:
         const ov::AnyMap& properties,
         bool allow_exception = false) const;
 
+    ov::SupportedOpsMap query_model_by_cost(const std::shared_ptr<ov::Model>& model, const Configuration& config) const;
+
     std::pair<ov::hetero::SubgraphsMappingInfo, std::vector<SubmodelInfo>> split_graph(
         const std::shared_ptr<ov::Model>& model,
         Configuration config) const;
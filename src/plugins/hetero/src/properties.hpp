@@ -17,5 +17,71 @@ static constexpr Property<std::string, PropertyMutability::RO> caching_device_pr
  * @brief Read-only property showing number of compiled submodels
  */
 static constexpr Property<size_t, PropertyMutability::RO> number_of_submodels{"HETERO_NUMBER_OF_SUBMODELS"};
+
+/**
+ * @brief Enables pipelined execution of the submodels: every submodel gets its own pool of infer requests and queue,
+ * so the infer requests of the compiled model overlap on different submodels instead of occupying all of them
+ */
+static constexpr Property<bool, PropertyMutability::RW> pipelined_execution{"HETERO_PIPELINED_EXECUTION"};
+
+/**
+ * @brief Read-only property to get the statistics of every submodel in pipelined execution mode: DEVICE, REQUESTS
+ * (size of the request pool), INFERENCES, BUSY_TIME_MS, QUEUE_WAIT_TIME_MS, MAX_QUEUE_DEPTH and UTILIZATION (share of
+ * the time the requests of the pool were busy since the first inference)
+ */
+static constexpr Property<std::vector<ov::AnyMap>, PropertyMutability::RO> pipeline_stage_statistics{
+    "HETERO_PIPELINE_STAGE_STATISTICS"};
+
+enum class PartitioningMode {
+    AFFINITY = 0,  // every operation is assigned to the first device in the priority list which supports it
+    MIN_CUT = 1,   // minimizes the bytes transferred between the subgraphs, the load balance breaks the ties
+    BALANCED = 2,  // balances the estimated cost of the subgraphs of the devices, the transferred bytes break the ties
+};
+
+/** @cond INTERNAL */
+inline std::ostream& operator<<(std::ostream& os, const PartitioningMode& mode) {
+    switch (mode) {
+    case PartitioningMode::AFFINITY:
+        return os << "AFFINITY";
+    case PartitioningMode::MIN_CUT:
+        return os << "MIN_CUT";
+    case PartitioningMode::BALANCED:
+        return os << "BALANCED";
+    default:
+        OPENVINO_THROW("Unsupported partitioning mode!");
+    }
+}
+
+inline std::istream& operator>>(std::istream& is, PartitioningMode& mode) {
+    std::string str;
+    is >> str;
+    if (str == "AFFINITY") {
+        mode = PartitioningMode::AFFINITY;
+    } else if (str == "MIN_CUT") {
+        mode = PartitioningMode::MIN_CUT;
+    } else if (str == "BALANCED") {
+        mode = PartitioningMode::BALANCED;
+    } else {
+        OPENVINO_THROW("Unsupported partitioning mode: ", str);
+    }
+    return is;
+}
+/** @endcond */
+
+/**
+ * @brief Defines how the operations are assigned to the devices when the affinities are not set by the user.
+ * The cost model modes query all the devices and refine the assignment using the estimated cost of every operation
+ * (can be overridden by the "cost" runtime info attribute of the operation) and the bytes of every tensor transferred
+ * between the devices.
+ */
+static constexpr Property<PartitioningMode, PropertyMutability::RW> partitioning_mode{"HETERO_PARTITIONING_MODE"};
+
+/**
+ * @brief Limits the size of the constants in bytes the cost model modes assign to a device, e.g.
+ * {{"CPU.0", 1 << 30}, {"CPU.1", 1 << 30}}. The devices which are not listed are not limited, unless
+ * ov::hint::model_distribution_policy is PIPELINE_PARALLEL: then the discrete devices are limited by their memory.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RW> device_memory_limits{
+    "HETERO_DEVICE_MEMORY_LIMITS"};
 }  // namespace hetero
 }  // namespace ov
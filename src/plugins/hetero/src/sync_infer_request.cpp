@@ -5,6 +5,7 @@
 #include "sync_infer_request.hpp"
 
 #include <algorithm>
+#include <future>
 #include <map>
 #include <memory>
 #include <string>
@@ -14,11 +15,52 @@
 #include "itt.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/runtime/make_tensor.hpp"
+#include "openvino/runtime/properties.hpp"
 #include "plugin.hpp"
 #include "remote_tensor.hpp"
 
 ov::hetero::InferRequest::InferRequest(const std::shared_ptr<const ov::hetero::CompiledModel>& compiled_model)
-    : ov::ISyncInferRequest(compiled_model) {
+    : ov::ISyncInferRequest(compiled_model),
+      m_stages(compiled_model->m_pipeline_stages) {
+    if (is_pipelined()) {
+        // the requests are taken from the pools of the stages on every inference, so the request keeps the tensors
+        const auto allocate = [](const ov::Output<const ov::Node>& port) {
+            const auto& shape = port.get_partial_shape().is_dynamic() ? ov::Shape{0} : port.get_shape();
+            return std::make_shared<ov::SoPtr<ov::ITensor>>(ov::make_tensor(port.get_element_type(), shape), nullptr);
+        };
+        for (auto&& comp_model_desc : compiled_model->m_compiled_submodels) {
+            m_stage_outputs.emplace_back();
+            for (const auto& output : comp_model_desc.compiled_model->outputs()) {
+                m_stage_outputs.back().emplace_back(allocate(output));
+            }
+        }
+        const auto& submodels_input_to_prev_output = compiled_model->m_mapping_info._submodels_input_to_prev_output;
+        for (size_t i = 0; i < compiled_model->m_compiled_submodels.size(); i++) {
+            m_stage_inputs.emplace_back();
+            const auto& inputs = compiled_model->m_compiled_submodels[i].compiled_model->inputs();
+            for (size_t j = 0; j < inputs.size(); j++) {
+                const auto prev_output = submodels_input_to_prev_output.find({i, j});
+                if (prev_output != submodels_input_to_prev_output.end()) {
+                    const auto& submodel_idx_out = prev_output->second.first;
+                    const auto& port_idx_out = prev_output->second.second;
+                    m_stage_inputs.back().emplace_back(m_stage_outputs[submodel_idx_out][port_idx_out]);
+                } else {
+                    m_stage_inputs.back().emplace_back(allocate(inputs[j]));
+                }
+            }
+        }
+        for (auto&& comp_model_desc : compiled_model->m_compiled_submodels) {
+            bool profiling = false;
+            try {
+                profiling = comp_model_desc.compiled_model->get_property(ov::enable_profiling.name()).as<bool>();
+            } catch (const ov::Exception&) {
+            }
+            m_stage_profiling.push_back(profiling);
+        }
+        m_stage_profiling_info.resize(m_stages.size());
+        return;
+    }
+
     for (auto&& comp_model_desc : compiled_model->m_compiled_submodels) {
         auto& comp_model = comp_model_desc.compiled_model;
         m_subrequests.push_back({comp_model->create_infer_request(), comp_model._so});
@@ -43,6 +85,12 @@ ov::hetero::InferRequest::InferRequest(const std::shared_ptr<const ov::hetero::C
         const auto& port_idx_out = kvp.second.second;
 
         const auto& output_port = m_subrequests[submodel_idx_out]->get_compiled_model()->outputs()[port_idx_out];
+        const auto& input_port = m_subrequests[submodel_idx_in]->get_compiled_model()->inputs()[port_idx_in];
+        if (compiled_model->m_compiled_submodels[submodel_idx_out].device ==
+            compiled_model->m_compiled_submodels[submodel_idx_in].device) {
+            m_tensor_handoffs.push_back({submodel_idx_out, output_port, submodel_idx_in, input_port, {}});
+            continue;
+        }
         const auto& output_tensor = m_subrequests[submodel_idx_out]->get_tensor(output_port);
         if (temp_tensor_map.find(output_port) == temp_tensor_map.end()) {
             temp_tensor_map[output_port] = {
@@ -50,9 +98,27 @@ ov::hetero::InferRequest::InferRequest(const std::shared_ptr<const ov::hetero::C
                 nullptr};
         }
         m_subrequests[submodel_idx_out]->set_tensor(output_port, temp_tensor_map[output_port]);
-        const auto& input_port = m_subrequests[submodel_idx_in]->get_compiled_model()->inputs()[port_idx_in];
         m_subrequests[submodel_idx_in]->set_tensor(input_port, temp_tensor_map[output_port]);
     }
+    for (size_t i = 0; i < m_subrequests.size(); i++) {
+        update_tensor_handoffs(i);
+    }
+}
+
+void ov::hetero::InferRequest::update_tensor_handoffs(size_t producer_idx) {
+    for (auto& handoff : m_tensor_handoffs) {
+        if (handoff.producer_idx != producer_idx)
+            continue;
+        // the producer may reallocate the output of dynamic shape or get a new output tensor from the user
+        auto tensor = m_subrequests[producer_idx]->get_tensor(handoff.output);
+        if (tensor._ptr == handoff.tensor._ptr)
+            continue;
+        if (!tensor._so) {
+            tensor._so = m_subrequests[producer_idx]._so;
+        }
+        m_subrequests[handoff.consumer_idx]->set_tensor(handoff.input, tensor);
+        handoff.tensor = std::move(tensor);
+    }
 }
 
 ov::hetero::InferRequest::~InferRequest() = default;
@@ -69,7 +135,70 @@ ov::SoPtr<ov::IAsyncInferRequest> ov::hetero::InferRequest::get_request(const ov
     return m_subrequests[m_port_to_subrequest_idx.at(internal_port)];
 }
 
+bool ov::hetero::InferRequest::is_pipelined() const {
+    return !m_stages.empty();
+}
+
+std::pair<size_t, ov::hetero::InferRequest::TensorSlot> ov::hetero::InferRequest::get_stage_tensor(
+    const ov::Output<const ov::Node>& port) const {
+    auto found_port = find_port(port);
+    OPENVINO_ASSERT(found_port.found(), "Cannot find tensor for port ", port);
+    const auto compiled_model = std::static_pointer_cast<const ov::hetero::CompiledModel>(get_compiled_model());
+    if (found_port.is_input()) {
+        const auto& submodel_input = compiled_model->m_mapping_info._inputs_to_submodels_inputs.at(found_port.idx);
+        return {submodel_input.first, m_stage_inputs.at(submodel_input.first).at(submodel_input.second)};
+    }
+    const auto& submodel_output = compiled_model->m_mapping_info._outputs_to_submodels_outputs.at(found_port.idx);
+    return {submodel_output.first, m_stage_outputs.at(submodel_output.first).at(submodel_output.second)};
+}
+
+ov::hetero::PipelineStage::Job ov::hetero::InferRequest::create_stage_job(
+    size_t stage_idx,
+    std::function<void(std::exception_ptr)> done) {
+    PipelineStage::Job job;
+    job.owner = this;
+    job.bind = [this, stage_idx](ov::IAsyncInferRequest& request) {
+        const auto& compiled_model = request.get_compiled_model();
+        for (size_t i = 0; i < compiled_model->inputs().size(); i++) {
+            const auto& slot = m_stage_inputs[stage_idx][i];
+            const auto batched = m_stage_batched_inputs.find(slot);
+            if (batched != m_stage_batched_inputs.end()) {
+                request.set_tensors(compiled_model->inputs()[i], batched->second);
+            } else {
+                request.set_tensor(compiled_model->inputs()[i], *slot);
+            }
+        }
+        // the outputs of dynamic shapes are allocated by the request and copied after the inference
+        for (size_t i = 0; i < compiled_model->outputs().size(); i++) {
+            const auto& output = compiled_model->outputs()[i];
+            if (!output.get_partial_shape().is_dynamic()) {
+                request.set_tensor(output, *m_stage_outputs[stage_idx][i]);
+            }
+        }
+    };
+    job.collect = [this, stage_idx](ov::IAsyncInferRequest& request) {
+        const auto& compiled_model = request.get_compiled_model();
+        for (size_t i = 0; i < compiled_model->outputs().size(); i++) {
+            const auto& output = compiled_model->outputs()[i];
+            if (output.get_partial_shape().is_dynamic()) {
+                const auto tensor = request.get_tensor(output);
+                auto& slot = *m_stage_outputs[stage_idx][i];
+                slot->set_shape(tensor->get_shape());
+                tensor->copy_to(slot._ptr);
+            }
+        }
+        if (m_stage_profiling[stage_idx]) {
+            m_stage_profiling_info[stage_idx] = request.get_profiling_info();
+        }
+    };
+    job.done = std::move(done);
+    return job;
+}
+
 ov::SoPtr<ov::ITensor> ov::hetero::InferRequest::get_tensor(const ov::Output<const ov::Node>& port) const {
+    if (is_pipelined()) {
+        return *get_stage_tensor(port).second;
+    }
     const auto infer_request = get_request(port);
     auto tensor = infer_request->get_tensor(port);
     if (!tensor._so) {
@@ -80,6 +209,19 @@ ov::SoPtr<ov::ITensor> ov::hetero::InferRequest::get_tensor(const ov::Output<con
 
 void ov::hetero::InferRequest::set_tensor(const ov::Output<const ov::Node>& port,
                                           const ov::SoPtr<ov::ITensor>& tensor) {
+    if (is_pipelined()) {
+        const auto stage_tensor = get_stage_tensor(port);
+        auto resolved_tensor = tensor;
+        if (auto remote = std::dynamic_pointer_cast<ov::hetero::RemoteTensor>(tensor._ptr)) {
+            const auto compiled_model = std::static_pointer_cast<const ov::hetero::CompiledModel>(get_compiled_model());
+            const auto& submodel = compiled_model->m_compiled_submodels[stage_tensor.first].compiled_model;
+            resolved_tensor = remote->get_tensor_by_name(submodel->get_context()->get_device_name());
+        }
+        check_tensor(port, resolved_tensor);
+        *stage_tensor.second = resolved_tensor;
+        m_stage_batched_inputs.erase(stage_tensor.second);
+        return;
+    }
     if (auto remote = std::dynamic_pointer_cast<ov::hetero::RemoteTensor>(tensor._ptr)) {
         auto device_name = get_request(port)->get_compiled_model()->get_context()->get_device_name();
         get_request(port)->set_tensor(port, remote->get_tensor_by_name(device_name));
@@ -90,6 +232,12 @@ void ov::hetero::InferRequest::set_tensor(const ov::Output<const ov::Node>& port
 
 std::vector<ov::SoPtr<ov::ITensor>> ov::hetero::InferRequest::get_tensors(
     const ov::Output<const ov::Node>& port) const {
+    if (is_pipelined()) {
+        const auto batched = m_stage_batched_inputs.find(get_stage_tensor(port).second);
+        if (batched == m_stage_batched_inputs.end())
+            return {};
+        return batched->second;
+    }
     const auto infer_request = get_request(port);
     auto tensors = infer_request->get_tensors(port);
     for (auto& tensor : tensors) {
@@ -102,6 +250,25 @@ std::vector<ov::SoPtr<ov::ITensor>> ov::hetero::InferRequest::get_tensors(
 
 void ov::hetero::InferRequest::set_tensors(const ov::Output<const ov::Node>& port,
                                            const std::vector<ov::SoPtr<ov::ITensor>>& tensors) {
+    if (is_pipelined()) {
+        if (tensors.size() == 1) {
+            return set_tensor(port, tensors[0]);
+        }
+        // the tensors are checked by the request of the pool they are set to
+        const auto stage_tensor = get_stage_tensor(port);
+        const auto compiled_model = std::static_pointer_cast<const ov::hetero::CompiledModel>(get_compiled_model());
+        const auto& submodel = compiled_model->m_compiled_submodels[stage_tensor.first].compiled_model;
+        std::vector<ov::SoPtr<ov::ITensor>> resolved_tensors;
+        for (const auto& tensor : tensors) {
+            if (auto remote = std::dynamic_pointer_cast<ov::hetero::RemoteTensor>(tensor._ptr)) {
+                resolved_tensors.emplace_back(remote->get_tensor_by_name(submodel->get_context()->get_device_name()));
+            } else {
+                resolved_tensors.emplace_back(tensor);
+            }
+        }
+        m_stage_batched_inputs[stage_tensor.second] = std::move(resolved_tensors);
+        return;
+    }
     return get_request(port)->set_tensors(port, tensors);
 }
 
@@ -125,19 +292,37 @@ std::vector<ov::SoPtr<ov::IVariableState>> ov::hetero::InferRequest::query_state
 }
 
 void ov::hetero::InferRequest::infer() {
-    for (auto&& request : m_subrequests) {
-        OPENVINO_ASSERT(request);
-        request->infer();
+    for (size_t i = 0; i < m_stages.size(); i++) {
+        std::promise<void> promise;
+        auto future = promise.get_future();
+        m_stages[i]->run(create_stage_job(i, [&promise](std::exception_ptr exception_ptr) {
+            if (nullptr != exception_ptr) {
+                promise.set_exception(exception_ptr);
+            } else {
+                promise.set_value();
+            }
+        }));
+        future.get();
+    }
+    for (size_t i = 0; i < m_subrequests.size(); i++) {
+        OPENVINO_ASSERT(m_subrequests[i]);
+        m_subrequests[i]->infer();
+        update_tensor_handoffs(i);
     }
 }
 
 std::vector<ov::ProfilingInfo> ov::hetero::InferRequest::get_profiling_info() const {
     std::vector<ov::ProfilingInfo> info;
-    for (size_t i = 0; i < m_subrequests.size(); ++i) {
-        auto&& subreq_info = m_subrequests[i]->get_profiling_info();
+    const auto add_info = [&info](size_t i, std::vector<ov::ProfilingInfo> subreq_info) {
         for (auto&& rec : subreq_info)
             rec.node_name = std::string("subgraph") + std::to_string(i) + ": " + rec.node_name;
         info.insert(info.end(), subreq_info.begin(), subreq_info.end());
+    };
+    for (size_t i = 0; i < m_stage_profiling_info.size(); ++i) {
+        add_info(i, m_stage_profiling_info[i]);
+    }
+    for (size_t i = 0; i < m_subrequests.size(); ++i) {
+        add_info(i, m_subrequests[i]->get_profiling_info());
     }
     return info;
 }
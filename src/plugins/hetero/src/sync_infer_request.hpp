@@ -6,15 +6,18 @@
 
 #include <array>
 #include <chrono>
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "openvino/itt.hpp"
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/isync_infer_request.hpp"
 #include "openvino/runtime/so_ptr.hpp"
+#include "pipeline_stage.hpp"
 
 namespace ov {
 namespace hetero {
@@ -50,8 +53,45 @@ private:
 
     ov::SoPtr<ov::IAsyncInferRequest> get_request(const ov::Output<const ov::Node>& port) const;
 
+    // pipelined execution mode
+    using TensorSlot = std::shared_ptr<ov::SoPtr<ov::ITensor>>;
+
+    bool is_pipelined() const;
+
+    // returns the index of the stage the port belongs to and the tensor slot of the port
+    std::pair<size_t, TensorSlot> get_stage_tensor(const ov::Output<const ov::Node>& port) const;
+
+    PipelineStage::Job create_stage_job(size_t stage_idx, std::function<void(std::exception_ptr)> done);
+
+    // rebinds the outputs of the subrequest to the consumers on the same device if the output tensors were replaced
+    void update_tensor_handoffs(size_t producer_idx);
+
     std::vector<ov::SoPtr<ov::IAsyncInferRequest>> m_subrequests;
     std::map<ov::Output<const ov::Node>, size_t> m_port_to_subrequest_idx;
+
+    // the output tensor of a subrequest bound directly as the input of a subrequest on the same device,
+    // so the tensor stays in the memory of the device between the submodels
+    struct TensorHandoff {
+        size_t producer_idx;
+        ov::Output<const ov::Node> output;
+        size_t consumer_idx;
+        ov::Output<const ov::Node> input;
+        // the bound tensor, holds the memory and the library of the producer while the consumer uses it
+        ov::SoPtr<ov::ITensor> tensor;
+    };
+    std::vector<TensorHandoff> m_tensor_handoffs;
+
+    // the stages of the compiled model and the tensors of the inputs and the outputs of every stage,
+    // the input of a stage shares the slot with the output of the previous stage it is connected to
+    std::vector<std::shared_ptr<PipelineStage>> m_stages;
+    std::vector<std::vector<TensorSlot>> m_stage_inputs;
+    std::vector<std::vector<TensorSlot>> m_stage_outputs;
+    // the batched tensors set to the input slots, passed to the requests of the pool with set_tensors
+    std::map<TensorSlot, std::vector<ov::SoPtr<ov::ITensor>>> m_stage_batched_inputs;
+    // the profiling info of the last inference of every stage with the profiling enabled, taken from the request of
+    // the pool it was executed on
+    std::vector<bool> m_stage_profiling;
+    std::vector<std::vector<ov::ProfilingInfo>> m_stage_profiling_info;
 };
 
 }  // namespace hetero
@@ -3,9 +3,11 @@
 //
 #include "common_test_utils/test_constants.hpp"
 #include "hetero_tests.hpp"
+#include "openvino/opsets/opset11.hpp"
 #include "openvino/runtime/exec_model_info.hpp"
 #include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "properties.hpp"
 
 using namespace ov::hetero::tests;
 
@@ -123,4 +125,91 @@ TEST_F(HeteroTests, get_runtime_model) {
         ASSERT_TRUE(info.count(ov::exec_model_info::OUTPUT_PRECISIONS));
     }
     EXPECT_EQ(0, original_names.size());
-}
\ No newline at end of file
+}
+
+TEST_F(HeteroTests, infer_with_pipelined_execution) {
+    ov::AnyMap config = {ov::device::priorities("MOCK0,MOCK1"), ov::hetero::pipelined_execution(true)};
+    auto model = create_model_with_subtract();
+    auto compiled_model = core.compile_model(model, ov::test::utils::DEVICE_HETERO, config);
+    EXPECT_TRUE(compiled_model.get_property(ov::hetero::pipelined_execution));
+
+    const size_t num_requests = 4;
+    std::vector<ov::InferRequest> infer_requests;
+    std::vector<ov::Tensor> input_tensors;
+    for (size_t i = 0; i < num_requests; i++) {
+        infer_requests.emplace_back(compiled_model.create_infer_request());
+        input_tensors.emplace_back(
+            create_and_fill_tensor(compiled_model.input().get_element_type(), compiled_model.input().get_shape()));
+        infer_requests.back().set_input_tensor(input_tensors.back());
+    }
+    for (auto& infer_request : infer_requests) {
+        infer_request.start_async();
+    }
+    for (size_t i = 0; i < num_requests; i++) {
+        infer_requests[i].wait();
+        auto output_tensor = infer_requests[i].get_output_tensor();
+        EXPECT_EQ(input_tensors[i].get_shape(), output_tensor.get_shape());
+        EXPECT_EQ(memcmp(input_tensors[i].data(), output_tensor.data(), input_tensors[i].get_byte_size()), 0);
+    }
+    infer_requests[0].infer();
+
+    auto statistics = compiled_model.get_property(ov::hetero::pipeline_stage_statistics);
+    EXPECT_EQ(compiled_model.get_property(ov::hetero::number_of_submodels), statistics.size());
+    for (const auto& stage_statistics : statistics) {
+        EXPECT_EQ(num_requests + 1, stage_statistics.at("INFERENCES").as<uint64_t>());
+        const auto utilization = stage_statistics.at("UTILIZATION").as<double>();
+        EXPECT_GE(utilization, 0.0);
+        EXPECT_LE(utilization, 1.0);
+    }
+}
+
+TEST_F(HeteroTests, pipeline_stage_statistics_without_pipelined_execution_throw) {
+    auto model = create_model_with_subtract();
+    auto compiled_model =
+        core.compile_model(model, ov::test::utils::DEVICE_HETERO, ov::device::priorities("MOCK0,MOCK1"));
+    EXPECT_THROW(compiled_model.get_property(ov::hetero::pipeline_stage_statistics), ov::Exception);
+}
+
+TEST_F(HeteroTests, infer_with_tensor_handoff_on_same_device) {
+    // input -> add -> sub -> add2 -> res, add2 also consumes add directly, so the submodels of add and add2 are on
+    // MOCK0 and the output of add is passed to add2 without the intermediate host tensor
+    auto param = std::make_shared<ov::opset11::Parameter>(ov::element::i64, ov::PartialShape{1, 3, 2, 2});
+    param->set_friendly_name("input");
+    auto const_value = ov::opset11::Constant::create(ov::element::i64, ov::Shape{1, 1, 1, 1}, {1});
+    const_value->set_friendly_name("const_val");
+    auto add = std::make_shared<ov::opset11::Add>(param, const_value);
+    add->set_friendly_name("add");
+    auto subtract = std::make_shared<ov::opset11::Subtract>(add, const_value);
+    subtract->set_friendly_name("sub");
+    auto add2 = std::make_shared<ov::opset11::Add>(subtract, add);
+    add2->set_friendly_name("add2");
+    auto result = std::make_shared<ov::opset11::Result>(add2);
+    result->set_friendly_name("res");
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+    for (const auto& op : model->get_ordered_ops()) {
+        op->get_rt_info()["affinity"] = op->get_friendly_name() == "sub" ? "MOCK1" : "MOCK0";
+    }
+
+    auto compiled_model =
+        core.compile_model(model, ov::test::utils::DEVICE_HETERO, ov::device::priorities("MOCK0,MOCK1"));
+    EXPECT_EQ(3, compiled_model.get_property(ov::hetero::number_of_submodels));
+    auto infer_request = compiled_model.create_infer_request();
+    for (size_t iteration = 0; iteration < 2; iteration++) {
+        auto input_tensor =
+            create_and_fill_tensor(compiled_model.input().get_element_type(), compiled_model.input().get_shape());
+        infer_request.set_input_tensor(input_tensor);
+        if (iteration == 0) {
+            infer_request.infer();
+        } else {
+            infer_request.start_async();
+            infer_request.wait();
+        }
+        auto output_tensor = infer_request.get_output_tensor();
+        ASSERT_EQ(input_tensor.get_shape(), output_tensor.get_shape());
+        const auto input_data = input_tensor.data<int64_t>();
+        const auto output_data = output_tensor.data<int64_t>();
+        for (size_t i = 0; i < input_tensor.get_size(); i++) {
+            EXPECT_EQ(2 * input_data[i] + 1, output_data[i]);
+        }
+    }
+}
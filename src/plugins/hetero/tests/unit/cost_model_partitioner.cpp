@@ -0,0 +1,188 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cost_model_partitioner.hpp"
+
+#include <gtest/gtest.h>
+
+#include "openvino/core/except.hpp"
+#include "openvino/op/ops.hpp"
+
+using namespace ov::hetero;
+
+namespace {
+// input -> relu1 -> relu2 -> relu3 -> relu4 -> res
+std::shared_ptr<ov::Model> create_relu_chain() {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{1, 16});
+    param->set_friendly_name("input");
+    std::shared_ptr<ov::Node> node = param;
+    for (size_t i = 1; i <= 4; ++i) {
+        node = std::make_shared<ov::op::v0::Relu>(node);
+        node->set_friendly_name("relu" + std::to_string(i));
+    }
+    auto result = std::make_shared<ov::op::v0::Result>(node);
+    result->set_friendly_name("res");
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+}
+
+// input -> matmul1(weights1) -> matmul2(weights2) -> res
+std::shared_ptr<ov::Model> create_matmul_chain() {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{1, 10});
+    param->set_friendly_name("input");
+    auto weights1 = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{10, 10}, std::vector<float>(100, 1.f));
+    weights1->set_friendly_name("weights1");
+    auto matmul1 = std::make_shared<ov::op::v0::MatMul>(param, weights1);
+    matmul1->set_friendly_name("matmul1");
+    auto weights2 = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{10, 10}, std::vector<float>(100, 1.f));
+    weights2->set_friendly_name("weights2");
+    auto matmul2 = std::make_shared<ov::op::v0::MatMul>(matmul1, weights2);
+    matmul2->set_friendly_name("matmul2");
+    auto result = std::make_shared<ov::op::v0::Result>(matmul2);
+    result->set_friendly_name("res");
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+}
+
+CostModelPartitioner::Device create_device(const std::string& name,
+                                           const std::shared_ptr<ov::Model>& model,
+                                           const std::unordered_set<std::string>& unsupported = {},
+                                           uint64_t memory_limit = 0) {
+    CostModelPartitioner::Device device;
+    device.name = name;
+    for (const auto& op : model->get_ordered_ops()) {
+        if (unsupported.count(op->get_friendly_name()) == 0)
+            device.supported_ops.insert(op->get_friendly_name());
+    }
+    device.memory_limit = memory_limit;
+    return device;
+}
+}  // namespace
+
+TEST(CostModelPartitionerTest, MinCutKeepsProducerDevice) {
+    auto model = create_relu_chain();
+    // relu3 is not supported by DEV0, the rest of the chain stays on DEV1 instead of returning to DEV0
+    auto affinities = CostModelPartitioner(model, PartitioningMode::MIN_CUT)
+                          .run({create_device("DEV0", model, {"relu3"}), create_device("DEV1", model)});
+    const ov::SupportedOpsMap expected = {{"input", "DEV0"},
+                                          {"relu1", "DEV0"},
+                                          {"relu2", "DEV0"},
+                                          {"relu3", "DEV1"},
+                                          {"relu4", "DEV1"},
+                                          {"res", "DEV1"}};
+    EXPECT_EQ(expected, affinities);
+}
+
+TEST(CostModelPartitionerTest, BalancedSplitsCostEvenly) {
+    auto model = create_relu_chain();
+    auto affinities = CostModelPartitioner(model, PartitioningMode::BALANCED)
+                          .run({create_device("DEV0", model), create_device("DEV1", model)});
+    const ov::SupportedOpsMap expected = {{"input", "DEV0"},
+                                          {"relu1", "DEV0"},
+                                          {"relu2", "DEV0"},
+                                          {"relu3", "DEV1"},
+                                          {"relu4", "DEV1"},
+                                          {"res", "DEV1"}};
+    EXPECT_EQ(expected, affinities);
+}
+
+TEST(CostModelPartitionerTest, MemoryLimitMovesConstantsWithConsumers) {
+    auto model = create_matmul_chain();
+    // every device fits only one of the weights of 400 bytes
+    auto affinities = CostModelPartitioner(model, PartitioningMode::MIN_CUT)
+                          .run({create_device("DEV0", model, {}, 500), create_device("DEV1", model, {}, 500)});
+    EXPECT_EQ("DEV0", affinities.at("weights1"));
+    EXPECT_EQ("DEV0", affinities.at("matmul1"));
+    EXPECT_EQ("DEV1", affinities.at("weights2"));
+    EXPECT_EQ("DEV1", affinities.at("matmul2"));
+    EXPECT_EQ("DEV1", affinities.at("res"));
+
+    EXPECT_THROW(CostModelPartitioner(model, PartitioningMode::MIN_CUT)
+                     .run({create_device("DEV0", model, {}, 300), create_device("DEV1", model, {}, 300)}),
+                 ov::Exception);
+}
+
+TEST(CostModelPartitionerTest, UnsupportedOperationThrows) {
+    auto model = create_relu_chain();
+    EXPECT_THROW(CostModelPartitioner(model, PartitioningMode::MIN_CUT)
+                     .run({create_device("DEV0", model, {"relu2"}), create_device("DEV1", model, {"relu2"})}),
+                 ov::Exception);
+}
+
+TEST(CostModelPartitionerTest, OperationCost) {
+    auto model = create_matmul_chain();
+    for (const auto& op : model->get_ordered_ops()) {
+        if (op->get_friendly_name() == "matmul1") {
+            // M * N * K
+            EXPECT_DOUBLE_EQ(1 * 10 * 10, CostModelPartitioner::get_op_cost(op));
+            op->get_rt_info()["cost"] = 5.0;
+            EXPECT_DOUBLE_EQ(5.0, CostModelPartitioner::get_op_cost(op));
+        } else if (op->get_friendly_name() == "weights1") {
+            EXPECT_DOUBLE_EQ(0.0, CostModelPartitioner::get_op_cost(op));
+            EXPECT_EQ(400, CostModelPartitioner::get_tensor_bytes(op->output(0)));
+        }
+    }
+}
+
+TEST(CostModelPartitionerTest, BalancedDoesNotIncreaseTransfers) {
+    // input_a -> relu_a (DEV0) -> add -> relu_c (DEV0) -> res
+    // input_b -> relu_b (DEV1) ----^
+    auto input_a = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{1, 16});
+    input_a->set_friendly_name("input_a");
+    auto relu_a = std::make_shared<ov::op::v0::Relu>(input_a);
+    relu_a->set_friendly_name("relu_a");
+    auto input_b = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{1, 16});
+    input_b->set_friendly_name("input_b");
+    auto relu_b = std::make_shared<ov::op::v0::Relu>(input_b);
+    relu_b->set_friendly_name("relu_b");
+    auto add = std::make_shared<ov::op::v1::Add>(relu_a, relu_b);
+    add->set_friendly_name("add");
+    auto relu_c = std::make_shared<ov::op::v0::Relu>(add);
+    relu_c->set_friendly_name("relu_c");
+    auto result = std::make_shared<ov::op::v0::Result>(relu_c);
+    result->set_friendly_name("res");
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{input_a, input_b});
+    for (const auto& node : std::vector<std::shared_ptr<ov::Node>>{relu_a, relu_b, add}) {
+        node->get_rt_info()["cost"] = 10.0;
+    }
+    relu_c->get_rt_info()["cost"] = 30.0;
+
+    // moving add to DEV1 would balance the loads better, but add would take two transfers instead of one
+    auto affinities =
+        CostModelPartitioner(model, PartitioningMode::BALANCED)
+            .run({create_device("DEV0", model, {"relu_b"}), create_device("DEV1", model, {"relu_a", "relu_c"})});
+    EXPECT_EQ("DEV0", affinities.at("relu_a"));
+    EXPECT_EQ("DEV1", affinities.at("relu_b"));
+    EXPECT_EQ("DEV0", affinities.at("add"));
+    EXPECT_EQ("DEV0", affinities.at("relu_c"));
+}
+
+TEST(CostModelPartitionerTest, VariableOperationsShareDevice) {
+    // input -> add(read_value) -> relu -> res, relu -> assign
+    auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{1, 16});
+    input->set_friendly_name("input");
+    auto variable = std::make_shared<ov::op::util::Variable>(
+        ov::op::util::VariableInfo{ov::PartialShape{1, 16}, ov::element::f32, "state"});
+    auto init = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, 16}, std::vector<float>(16, 0.f));
+    init->set_friendly_name("init");
+    auto read_value = std::make_shared<ov::op::v6::ReadValue>(init, variable);
+    read_value->set_friendly_name("read_value");
+    auto add = std::make_shared<ov::op::v1::Add>(input, read_value);
+    add->set_friendly_name("add");
+    auto relu = std::make_shared<ov::op::v0::Relu>(add);
+    relu->set_friendly_name("relu");
+    auto assign = std::make_shared<ov::op::v6::Assign>(relu, variable);
+    assign->set_friendly_name("assign");
+    auto result = std::make_shared<ov::op::v0::Result>(relu);
+    result->set_friendly_name("res");
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{result},
+                                             ov::SinkVector{assign},
+                                             ov::ParameterVector{input},
+                                             ov::op::util::VariableVector{variable});
+
+    // the state written by assign on DEV1 has to be read on DEV1
+    auto affinities = CostModelPartitioner(model, PartitioningMode::MIN_CUT)
+                          .run({create_device("DEV0", model, {"assign"}), create_device("DEV1", model)});
+    EXPECT_EQ("DEV1", affinities.at("assign"));
+    EXPECT_EQ("DEV1", affinities.at("read_value"));
+    EXPECT_EQ("DEV1", affinities.at("init"));
+}
@@ -5,19 +5,80 @@
 #include "async_infer_request.h"
 
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/iinfer_request.hpp"
+#include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/threading/cpu_streams_executor.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
 
+namespace {
+// queues the tasks in the given priority lane of the CPU streams executor. It is a streams executor itself, so the
+// synchronous inferences of the request still run in the stream context (see IAsyncInferRequest)
+class PriorityTaskExecutor : public ov::threading::IStreamsExecutor {
+public:
+    PriorityTaskExecutor(std::shared_ptr<ov::threading::CPUStreamsExecutor> executor, ov::hint::Priority priority)
+        : m_executor(std::move(executor)),
+          m_priority(priority) {}
+
+    void run(ov::threading::Task task) override {
+        m_executor->run(std::move(task), m_priority);
+    }
+
+    void execute(ov::threading::Task task) override {
+        m_executor->execute(std::move(task));
+    }
+
+    int get_stream_id() override {
+        return m_executor->get_stream_id();
+    }
+
+    int get_streams_num() override {
+        return m_executor->get_streams_num();
+    }
+
+    int get_numa_node_id() override {
+        return m_executor->get_numa_node_id();
+    }
+
+    int get_socket_id() override {
+        return m_executor->get_socket_id();
+    }
+
+    std::vector<int> get_rank() override {
+        return m_executor->get_rank();
+    }
+
+    void cpu_reset() override {
+        m_executor->cpu_reset();
+    }
+
+private:
+    std::shared_ptr<ov::threading::CPUStreamsExecutor> m_executor;
+    ov::hint::Priority m_priority;
+};
+
+std::shared_ptr<ov::threading::ITaskExecutor> with_priority(
+    const std::shared_ptr<ov::threading::ITaskExecutor>& task_executor,
+    ov::hint::Priority priority) {
+    auto streams_executor = std::dynamic_pointer_cast<ov::threading::CPUStreamsExecutor>(task_executor);
+    if (priority == ov::hint::Priority::DEFAULT || !streams_executor) {
+        return task_executor;
+    }
+    return std::make_shared<PriorityTaskExecutor>(std::move(streams_executor), priority);
+}
+}  // namespace
+
 ov::intel_cpu::AsyncInferRequest::AsyncInferRequest(
     const std::shared_ptr<IInferRequest>& request,
     const std::shared_ptr<ov::threading::ITaskExecutor>& task_executor,
     const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor,
-    const bool is_optimized_single_stream)
-    : ov::IAsyncInferRequest(request, task_executor, callback_executor),
+    const bool is_optimized_single_stream,
+    ov::hint::Priority priority)
+    : ov::IAsyncInferRequest(request, with_priority(task_executor, priority), callback_executor),
       m_internal_request(request) {
     static_cast<SyncInferRequest*>(request.get())->set_async_request(this);
     m_stream_executor = std::dynamic_pointer_cast<ov::threading::IStreamsExecutor>(task_executor);
@@ -11,6 +11,7 @@
 #include "infer_request.h"
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/iinfer_request.hpp"
+#include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
 
@@ -21,7 +22,8 @@ public:
     AsyncInferRequest(const std::shared_ptr<IInferRequest>& request,
                       const std::shared_ptr<ov::threading::ITaskExecutor>& task_executor,
                       const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor,
-                      bool is_optimized_single_stream = false);
+                      bool is_optimized_single_stream = false,
+                      ov::hint::Priority priority = ov::hint::Priority::DEFAULT);
     ~AsyncInferRequest() override;
 
     void infer() override;
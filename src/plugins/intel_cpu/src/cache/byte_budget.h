@@ -0,0 +1,135 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Limit of the total size in bytes of the records of several cost aware caches, e.g. of the entries of a
+ * MultiCache created for different key/value types.
+ * When the limit is reached, the record with the lowest priority among all the caches sharing the budget is evicted,
+ * so a cache is never flushed or starved because of the records stored by the others. The inflation value of the
+ * GreedyDual-Size policy is shared by the caches, so the priorities of their records are comparable.
+ *
+ * @attention The budget is not thread safe. The thread safe caches sharing the budget must access it and each other
+ * only under the budget mutex (see getMutex()).
+ */
+class ByteBudget {
+public:
+    using Ptr = std::shared_ptr<ByteBudget>;
+
+    /**
+     * @brief The cache which stores its records within the budget
+     */
+    class Participant {
+    public:
+        virtual ~Participant() = default;
+        [[nodiscard]] virtual size_t getBytes() const = 0;
+        /**
+         * @brief Returns the priority of the record evicted next, called for a not empty participant only
+         */
+        [[nodiscard]] virtual double getLowestPriority() const = 0;
+        virtual void evict(size_t n) = 0;
+    };
+
+    /**
+     * @param limit maximum total size of the records in bytes, must be positive
+     */
+    explicit ByteBudget(size_t limit) : _limit(std::max<size_t>(limit, 1)) {}
+
+    ByteBudget(const ByteBudget&) = delete;
+    ByteBudget& operator=(const ByteBudget&) = delete;
+
+    void attach(Participant* participant) {
+        _participants.push_back(participant);
+    }
+
+    void detach(Participant* participant) {
+        _participants.erase(std::remove(_participants.begin(), _participants.end(), participant),
+                            _participants.end());
+    }
+
+    /**
+     * @brief Evicts the records with the lowest priority among all the participants until a record of the given size
+     * fits the budget
+     * @return false if the record is larger than the whole budget, then nothing is evicted
+     */
+    bool reserve(size_t size) {
+        if (size > _limit) {
+            return false;
+        }
+        while (getBytes() + size > _limit) {
+            Participant* victim = nullptr;
+            double lowestPriority = std::numeric_limits<double>::max();
+            for (auto* participant : _participants) {
+                if (participant->getBytes() != 0 && participant->getLowestPriority() <= lowestPriority) {
+                    lowestPriority = participant->getLowestPriority();
+                    victim = participant;
+                }
+            }
+            if (!victim) {
+                return false;
+            }
+            victim->evict(1);
+        }
+        return true;
+    }
+
+    [[nodiscard]] size_t getBytes() const {
+        size_t bytes = 0;
+        for (const auto* participant : _participants) {
+            bytes += participant->getBytes();
+        }
+        return bytes;
+    }
+
+    [[nodiscard]] size_t getLimit() const noexcept {
+        return _limit;
+    }
+
+    [[nodiscard]] double getInflation() const noexcept {
+        return _inflation;
+    }
+
+    void setInflation(double inflation) noexcept {
+        _inflation = inflation;
+    }
+
+    std::mutex& getMutex() noexcept {
+        return _mutex;
+    }
+
+    /**
+     * @brief Splits the total limit between the independently locked shards, one budget per shard index.
+     * The sum of the budgets is exactly the total limit, so the limit is never smaller than the number of the budgets.
+     * @param limit total maximum size of the records in bytes
+     * @param numShards number of the shards, zero means a single threaded cache with one budget
+     */
+    static std::vector<Ptr> split(size_t limit, size_t numShards) {
+        numShards = std::max<size_t>(std::min(numShards, limit), 1);
+        std::vector<Ptr> budgets;
+        budgets.reserve(numShards);
+        for (size_t i = 0; i < numShards; ++i) {
+            // the remainder goes to the first shards, so the total limit is kept exactly
+            budgets.push_back(std::make_shared<ByteBudget>(limit / numShards + (i < limit % numShards ? 1 : 0)));
+        }
+        return budgets;
+    }
+
+private:
+    size_t _limit;
+    double _inflation = 0.0;
+    std::vector<Participant*> _participants;
+    std::mutex _mutex;
+};
+
+}  // namespace ov::intel_cpu
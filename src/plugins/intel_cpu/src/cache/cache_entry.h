@@ -4,11 +4,13 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <utility>
 
+#include "cache_traits.h"
 #include "lru_cache.h"
 
 namespace ov::intel_cpu {
@@ -18,6 +20,9 @@ public:
     enum class LookUpStatus : int8_t { Hit, Miss };
 
     virtual ~CacheEntryBase() = default;
+
+    [[nodiscard]] virtual size_t getSize() const = 0;
+    [[nodiscard]] virtual size_t getEvictionCount() const = 0;
 };
 
 /**
@@ -25,8 +30,10 @@ public:
  * @tparam KeyType is a key type that must define hash() const method with return type convertible to size_t and define
  * comparison operator.
  * @tparam ValType is a type that must meet all the requirements to the std::unordered_map mapped type
- * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType) and ValueType get(const
- * KeyType&) interface and must have constructor of type ImplType(size_t).
+ * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType) (or
+ * put(KeyType, ValueType, double cost, size_t size) for the cost aware storages) and ValueType get(const KeyType&)
+ * interface, getSize() and getEvictionCount() accessors and must be constructible from the CacheEntry
+ * constructor arguments, e.g. ImplType(size_t).
  *
  * @note In this implementation default constructed value objects are treated as empty objects.
  */
@@ -36,7 +43,8 @@ class CacheEntry : public CacheEntryBase {
 public:
     using ResultType = std::pair<ValType, LookUpStatus>;
 
-    explicit CacheEntry(size_t capacity) : _impl(capacity) {}
+    template <typename... Args>
+    explicit CacheEntry(Args&&... args) : _impl(std::forward<Args>(args)...) {}
 
     /**
      * @brief Searches the key in the underlying storage and returns value if it exists, or creates a value using the
@@ -57,14 +65,32 @@ public:
         auto retEmpty = ValType();
         if (retVal == retEmpty) {
             retStatus = LookUpStatus::Miss;
-            retVal = builder(key);
-            if (retVal != retEmpty) {
-                _impl.put(key, retVal);
+            if constexpr (is_cost_aware_cache<ImplType>::value) {
+                // the build time is the eviction cost, so expensive kernels outlive cheap ones
+                const auto start = std::chrono::steady_clock::now();
+                retVal = builder(key);
+                const std::chrono::duration<double, std::micro> buildTime = std::chrono::steady_clock::now() - start;
+                if (retVal != retEmpty) {
+                    _impl.put(key, retVal, buildTime.count(), getCacheRecordSize(retVal));
+                }
+            } else {
+                retVal = builder(key);
+                if (retVal != retEmpty) {
+                    _impl.put(key, retVal);
+                }
             }
         }
         return {retVal, retStatus};
     }
 
+    [[nodiscard]] size_t getSize() const override {
+        return _impl.getSize();
+    }
+
+    [[nodiscard]] size_t getEvictionCount() const override {
+        return _impl.getEvictionCount();
+    }
+
     ImplType _impl;
 };
 
@@ -0,0 +1,67 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Checks whether the cache storage implementation takes the record build cost into account, i.e.
+ * provides put(Key, Value, double cost) and declares the static cost_aware flag.
+ */
+template <typename ImplType, typename = void>
+struct is_cost_aware_cache : std::false_type {};
+
+template <typename ImplType>
+struct is_cost_aware_cache<ImplType, std::void_t<decltype(ImplType::cost_aware)>>
+    : std::bool_constant<ImplType::cost_aware> {};
+
+/**
+ * @brief Checks whether the records of the key type may be shared by the streams running concurrently, i.e. the cached
+ * values are immutable once built and keep no per-execution state (scratch buffers, stream bound memory etc.).
+ * The key declares it with the static shareable flag, the records of the other keys are kept per stream.
+ */
+template <typename KeyType, typename = void>
+struct is_shareable_cache_key : std::false_type {};
+
+template <typename KeyType>
+struct is_shareable_cache_key<KeyType, std::void_t<decltype(KeyType::shareable)>>
+    : std::bool_constant<KeyType::shareable> {};
+
+/**
+ * @brief Estimated memory footprint of a cached record, which doesn't report its size: an executor with its primitive
+ * descriptors and a small JIT kernel.
+ */
+constexpr size_t defaultCacheRecordSize = 4096;
+
+/**
+ * @brief Checks whether the cached value reports the size of its JIT code, i.e. provides get_code_size() const.
+ */
+template <typename ValueType, typename = void>
+struct has_cache_code_size : std::false_type {};
+
+template <typename ValueType>
+struct has_cache_code_size<ValueType, std::void_t<decltype(std::declval<const ValueType&>()->get_code_size())>>
+    : std::true_type {};
+
+/**
+ * @brief Returns the size in bytes the record of the value takes in the byte budget of a cost aware cache: the real
+ * JIT code size if the value reports it, defaultCacheRecordSize otherwise.
+ */
+template <typename ValueType>
+size_t getCacheRecordSize(const ValueType& value) {
+    if constexpr (has_cache_code_size<ValueType>::value) {
+        if (value) {
+            return std::max<size_t>(value->get_code_size(), 1);
+        }
+    }
+    return defaultCacheRecordSize;
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,190 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+
+#include "byte_budget.h"
+
+/**
+ * @brief Preemptive cache with the GreedyDual-Size eviction policy.
+ * Each record gets the priority H = L + cost / size, where L is the priority of the last evicted record (the cache
+ * "inflation" value). The record with the lowest priority is evicted first, so cheap or large records leave the cache
+ * before expensive small ones, while the inflation value ages the records which are not accessed anymore.
+ * Besides its own capacity the cache may store its records within a ByteBudget shared with other caches, then the
+ * record with the lowest priority among all of them is evicted when the budget is exhausted.
+ * @tparam Key is a key type that must define hash() const method with return type convertible to size_t and define
+ * comparison operator.
+ * @tparam Value is a type that must meet all the requirements to the std::unordered_map mapped type
+ *
+ * @attention This cache implementation IS NOT THREAD SAFE!
+ */
+
+namespace ov::intel_cpu {
+
+template <typename Key, typename Value>
+class GreedyDualSizeCache : public ByteBudget::Participant {
+public:
+    static constexpr bool cost_aware = true;
+
+    /**
+     * @param capacity maximum number of records
+     * @param budget optional limit of the total size of the records shared with other caches
+     */
+    explicit GreedyDualSizeCache(size_t capacity, ByteBudget::Ptr budget = nullptr)
+        : _capacity(capacity),
+          _budget(std::move(budget)) {
+        if (_budget) {
+            _budget->attach(this);
+        }
+    }
+
+    GreedyDualSizeCache(const GreedyDualSizeCache&) = delete;
+    GreedyDualSizeCache& operator=(const GreedyDualSizeCache&) = delete;
+
+    ~GreedyDualSizeCache() override {
+        if (_budget) {
+            _budget->detach(this);
+        }
+    }
+
+    /**
+     * @brief Puts the value associated with the key into the cache.
+     * @param key
+     * @param value
+     * @param cost the cost of the value creation, e.g. the build time
+     * @param size the memory footprint of the value in bytes, the record larger than the whole budget isn't stored
+     */
+
+    void put(const Key& key, const Value& val, double cost = 1.0, size_t size = 1) {
+        if (0 == _capacity) {
+            return;
+        }
+        size = std::max<size_t>(size, 1);
+
+        auto mapItr = _cacheMapper.find(key);
+        if (mapItr != _cacheMapper.end()) {
+            _bytes -= mapItr->second.size;
+            _priorityQueue.erase(mapItr->second.queuePos);
+            _cacheMapper.erase(mapItr);
+        }
+
+        if (_cacheMapper.size() >= _capacity) {
+            evict(_cacheMapper.size() - _capacity + 1);
+        }
+        if (_budget && !_budget->reserve(size)) {
+            return;
+        }
+
+        auto queuePos = _priorityQueue.emplace(getPriority(cost, size), key);
+        _cacheMapper.emplace(key, Record{val, cost, size, queuePos});
+        _bytes += size;
+    }
+
+    /**
+     * @brief Searches a value associated with the key.
+     * @param key
+     * @return Value associated with the key or default constructed instance of the Value type.
+     */
+
+    Value get(const Key& key) {
+        auto itr = _cacheMapper.find(key);
+        if (itr == _cacheMapper.end()) {
+            return Value();
+        }
+
+        auto& record = itr->second;
+        _priorityQueue.erase(record.queuePos);
+        record.queuePos = _priorityQueue.emplace(getPriority(record.cost, record.size), key);
+        return record.value;
+    }
+
+    /**
+     * @brief Evicts n records with the lowest priority
+     * @param n number of records to be evicted, can be greater than capacity
+     */
+
+    void evict(size_t n) override {
+        for (size_t i = 0; i < n && !_priorityQueue.empty(); ++i) {
+            auto victim = _priorityQueue.begin();
+            setInflation(victim->first);
+            auto mapItr = _cacheMapper.find(victim->second);
+            _bytes -= mapItr->second.size;
+            _cacheMapper.erase(mapItr);
+            _priorityQueue.erase(victim);
+            ++_evictionCount;
+        }
+    }
+
+    [[nodiscard]] size_t getCapacity() const noexcept {
+        return _capacity;
+    }
+
+    [[nodiscard]] size_t getSize() const noexcept {
+        return _cacheMapper.size();
+    }
+
+    /**
+     * @brief Returns the total size of the records stored in this cache
+     */
+    [[nodiscard]] size_t getBytes() const noexcept override {
+        return _bytes;
+    }
+
+    [[nodiscard]] size_t getEvictionCount() const noexcept {
+        return _evictionCount;
+    }
+
+    [[nodiscard]] double getLowestPriority() const override {
+        return _priorityQueue.begin()->first;
+    }
+
+private:
+    struct key_hasher {
+        std::size_t operator()(const Key& k) const {
+            return k.hash();
+        }
+    };
+
+    using priority_queue_type = std::multimap<double, Key>;
+
+    struct Record {
+        Value value;
+        double cost;
+        size_t size;
+        typename priority_queue_type::iterator queuePos;
+    };
+
+    [[nodiscard]] double getPriority(double cost, size_t size) const noexcept {
+        return getInflation() + cost / static_cast<double>(size);
+    }
+
+    [[nodiscard]] double getInflation() const noexcept {
+        return _budget ? _budget->getInflation() : _inflation;
+    }
+
+    void setInflation(double inflation) noexcept {
+        if (_budget) {
+            _budget->setInflation(inflation);
+        } else {
+            _inflation = inflation;
+        }
+    }
+
+    priority_queue_type _priorityQueue;
+    std::unordered_map<Key, Record, key_hasher> _cacheMapper;
+    size_t _capacity;
+    ByteBudget::Ptr _budget;
+    size_t _bytes = 0;
+    double _inflation = 0.0;
+    size_t _evictionCount = 0;
+};
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,131 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "input_shapes_recorder.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/core/shape.hpp"
+
+namespace ov::intel_cpu {
+
+void InputShapesRecorder::record(const ShapeSet& shapes) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_known.size() >= m_capacity || m_known.count(shapes) != 0) {
+        return;
+    }
+    m_known.insert(shapes);
+    m_ordered.push_back(shapes);
+}
+
+std::vector<InputShapesRecorder::ShapeSet> InputShapesRecorder::get() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_ordered;
+}
+
+size_t InputShapesRecorder::size() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_ordered.size();
+}
+
+std::string InputShapesRecorder::serialize(const std::vector<ShapeSet>& shapeSets) {
+    std::stringstream ss;
+    for (size_t i = 0; i < shapeSets.size(); ++i) {
+        if (i != 0) {
+            ss << '|';
+        }
+        for (const auto& shape : shapeSets[i]) {
+            ss << '[';
+            for (size_t j = 0; j < shape.size(); ++j) {
+                if (j != 0) {
+                    ss << ',';
+                }
+                ss << shape[j];
+            }
+            ss << ']';
+        }
+    }
+    return ss.str();
+}
+
+std::vector<InputShapesRecorder::ShapeSet> InputShapesRecorder::deserialize(const std::string& str) {
+    std::vector<ShapeSet> shapeSets;
+    std::stringstream ss(str);
+    std::string setStr;
+    while (std::getline(ss, setStr, '|')) {
+        ShapeSet shapes;
+        size_t pos = 0;
+        while (pos < setStr.size()) {
+            OPENVINO_ASSERT(setStr[pos] == '[', "Unexpected symbol in the input shapes record: ", setStr);
+            const auto end = setStr.find(']', pos);
+            OPENVINO_ASSERT(end != std::string::npos, "Unterminated shape in the input shapes record: ", setStr);
+            ov::Shape shape;
+            std::stringstream dims(setStr.substr(pos + 1, end - pos - 1));
+            std::string dim;
+            while (std::getline(dims, dim, ',')) {
+                shape.push_back(std::stoull(dim));
+            }
+            shapes.push_back(std::move(shape));
+            pos = end + 1;
+        }
+        shapeSets.push_back(std::move(shapes));
+    }
+    return shapeSets;
+}
+
+const InputShapesRecorder::ShapeSet* InputShapesRecorder::findBatchBucket(const std::vector<ShapeSet>& buckets,
+                                                                          const ShapeSet& shapes) {
+    // returns the bucket batch or zero if the bucket does not fit
+    auto bucketBatch = [&shapes](const ShapeSet& bucket) -> size_t {
+        if (bucket.size() != shapes.size()) {
+            return 0;
+        }
+        size_t batch = 0;
+        size_t paddedBatch = 0;
+        for (size_t i = 0; i < shapes.size(); ++i) {
+            const auto& shape = shapes[i];
+            const auto& bucketShape = bucket[i];
+            if (bucketShape.size() != shape.size()) {
+                return 0;
+            }
+            if (bucketShape == shape) {
+                continue;
+            }
+            if (shape.empty() || bucketShape[0] < shape[0] ||
+                !std::equal(shape.begin() + 1, shape.end(), bucketShape.begin() + 1)) {
+                return 0;
+            }
+            if (paddedBatch == 0) {
+                batch = shape[0];
+                paddedBatch = bucketShape[0];
+            } else if (batch != shape[0] || paddedBatch != bucketShape[0]) {
+                return 0;
+            }
+        }
+        return paddedBatch;
+    };
+
+    const ShapeSet* result = nullptr;
+    size_t minBatch = std::numeric_limits<size_t>::max();
+    for (const auto& bucket : buckets) {
+        if (bucket == shapes) {
+            return &bucket;
+        }
+        const auto batch = bucketBatch(bucket);
+        if (batch != 0 && batch < minBatch) {
+            minBatch = batch;
+            result = &bucket;
+        }
+    }
+    return result;
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,63 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "openvino/core/shape.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Thread safe registry of the distinct sets of model input shapes seen during inference. The recorded shapes
+ * are persisted with the exported model and replayed on import to prebuild the runtime cache entries.
+ */
+class InputShapesRecorder {
+public:
+    // shapes of all the model inputs in the order of the model parameters
+    using ShapeSet = std::vector<ov::Shape>;
+
+    explicit InputShapesRecorder(size_t capacity) : m_capacity(capacity) {}
+
+    /**
+     * @brief Stores the shape set if it was not seen before and the capacity is not exhausted
+     */
+    void record(const ShapeSet& shapes);
+
+    [[nodiscard]] std::vector<ShapeSet> get() const;
+
+    [[nodiscard]] size_t size() const;
+
+    /**
+     * @brief Serializes the shape sets into a compact string, e.g. "[1,128][1,128]|[2,64][2,64]"
+     */
+    static std::string serialize(const std::vector<ShapeSet>& shapeSets);
+
+    static std::vector<ShapeSet> deserialize(const std::string& str);
+
+    /**
+     * @brief Finds the bucket with the smallest batch the shapes can be padded to. Only the batch (the first
+     * dimension) may differ: the padded inputs must share the same batch and the same bucket batch, all the other
+     * dimensions must be equal to the bucket ones.
+     * @return pointer to the bucket or nullptr if none of the buckets fits
+     */
+    static const ShapeSet* findBatchBucket(const std::vector<ShapeSet>& buckets, const ShapeSet& shapes);
+
+private:
+    mutable std::mutex m_mutex;
+    size_t m_capacity;
+    std::set<ShapeSet> m_known;
+    // keeps the order of recording, so the most frequent first shapes are replayed first
+    std::vector<ShapeSet> m_ordered;
+};
+
+using InputShapesRecorderPtr = std::shared_ptr<InputShapesRecorder>;
+
+}  // namespace ov::intel_cpu
@@ -75,6 +75,7 @@ public:
         for (size_t i = 0; i < n && !_lruList.empty(); ++i) {
             _cacheMapper.erase(_lruList.back().first);
             _lruList.pop_back();
+            ++_evictionCount;
         }
     }
 
@@ -86,6 +87,22 @@ public:
         return _capacity;
     }
 
+    /**
+     * @brief Returns the number of records stored in the cache
+     * @return the number of records
+     */
+    [[nodiscard]] size_t getSize() const noexcept {
+        return _cacheMapper.size();
+    }
+
+    /**
+     * @brief Returns the total number of records evicted from the cache since its creation
+     * @return the number of evicted records
+     */
+    [[nodiscard]] size_t getEvictionCount() const noexcept {
+        return _evictionCount;
+    }
+
 private:
     struct key_hasher {
         std::size_t operator()(const Key& k) const {
@@ -103,6 +120,7 @@ private:
     lru_list_type _lruList;
     std::unordered_map<Key, cache_map_value_type, key_hasher> _cacheMapper;
     size_t _capacity;
+    size_t _evictionCount = 0;
 };
 
 }  // namespace ov::intel_cpu
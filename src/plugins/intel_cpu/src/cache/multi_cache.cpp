@@ -5,9 +5,27 @@
 #include "multi_cache.h"
 
 #include <atomic>
+#include <memory>
+#include <mutex>
 
 namespace ov::intel_cpu {
 
 std::atomic_size_t MultiCache::_typeIdCounter{0};
 
+MultiCache::Statistics MultiCache::getStatistics() const {
+    Statistics stats;
+    stats.hits = _hits.load(std::memory_order_relaxed);
+    stats.misses = _misses.load(std::memory_order_relaxed);
+
+    std::unique_lock<std::mutex> lock(_mutex, std::defer_lock);
+    if (isThreadSafe()) {
+        lock.lock();
+    }
+    for (const auto& item : _storage) {
+        stats.evictions += item.second->getEvictionCount();
+        stats.records += item.second->getSize();
+    }
+    return stats;
+}
+
 }  // namespace ov::intel_cpu
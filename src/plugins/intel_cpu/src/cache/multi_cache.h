@@ -6,33 +6,100 @@
 
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <type_traits>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "cache_entry.h"
+#include "cache_traits.h"
+#include "byte_budget.h"
+#include "gds_cache.h"
+#include "openvino/core/except.hpp"
+#include "sharded_cache.h"
 
 namespace ov::intel_cpu {
 
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
  *
- * @attention This implementation IS NOT THREAD SAFE!
+ * @attention By default (numShards == 0) this implementation IS NOT THREAD SAFE! A cache created with a non-zero
+ * number of shards is thread safe and may be shared between several streams. Such a cache is not used by the streams
+ * directly, but through their single threaded caches, which keep there only the records of the shareable key types
+ * (see is_shareable_cache_key) and store the executors with per-execution state locally.
  */
 
 class MultiCache {
 public:
+    enum class EvictionPolicy : uint8_t {
+        LRU,        // least recently used record is evicted first
+        CostAware,  // GreedyDual-Size: cheap to build or large records are evicted first, the byte budget is applied
+    };
+
     template <typename KeyType, typename ValueType>
     using EntryTypeT = CacheEntry<KeyType, ValueType>;
+    template <typename KeyType, typename ValueType>
+    using SharedEntryTypeT = CacheEntry<KeyType, ValueType, ShardedLruCache<KeyType, ValueType>>;
+    template <typename KeyType, typename ValueType>
+    using CostAwareEntryTypeT = CacheEntry<KeyType, ValueType, GreedyDualSizeCache<KeyType, ValueType>>;
+    template <typename KeyType, typename ValueType>
+    using SharedCostAwareEntryTypeT =
+        CacheEntry<KeyType, ValueType, ShardedCache<KeyType, ValueType, GreedyDualSizeCache<KeyType, ValueType>>>;
     using EntryBasePtr = std::shared_ptr<CacheEntryBase>;
     template <typename KeyType, typename ValueType>
     using EntryPtr = std::shared_ptr<EntryTypeT<KeyType, ValueType>>;
 
+    struct Statistics {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t evictions = 0;
+        size_t records = 0;
+
+        Statistics& operator+=(const Statistics& rhs) {
+            hits += rhs.hits;
+            misses += rhs.misses;
+            evictions += rhs.evictions;
+            records += rhs.records;
+            return *this;
+        }
+    };
+
     /**
      * @param capacity here means maximum records limit FOR EACH entry specified by a pair of Key/Value types.
+     * @param numShards number of independently locked shards of each entry. Zero means the single threaded mode.
+     * @param policy eviction policy of the entries
+     * @param byteBudget maximum total size in bytes of the records of ALL the entries, zero means unlimited.
+     *        Only applied with the CostAware policy. The size of a record is its JIT code size if the value reports
+     *        it (see getCacheRecordSize), an estimate otherwise. In the thread safe mode the budget is split between
+     *        the shards, the sum of the shard budgets never exceeds it.
+     * @param shared thread safe cache shared by the streams, which stores the records of the shareable key types
+     *        instead of this cache
      * @note zero capacity means empty cache so no records are stored and no entries are created
      */
-    explicit MultiCache(size_t capacity) : _capacity(capacity) {}
+    explicit MultiCache(size_t capacity,
+                        size_t numShards = 0,
+                        EvictionPolicy policy = EvictionPolicy::LRU,
+                        size_t byteBudget = 0,
+                        std::shared_ptr<MultiCache> shared = nullptr)
+        : _capacity(capacity),
+          _numShards(numShards),
+          _policy(policy),
+          _byteBudget(byteBudget),
+          _shared(std::move(shared)) {
+        OPENVINO_ASSERT(!_shared || _shared->isThreadSafe(), "The cache shared by the streams must be thread safe");
+        if (_policy == EvictionPolicy::CostAware && byteBudget != 0) {
+            _budgets = ByteBudget::split(byteBudget, _numShards);
+        }
+    }
+
+    // the copy has the same settings, but none of the records, which may keep per-execution state
+    MultiCache(const MultiCache& other)
+        : MultiCache(other._capacity, other._numShards, other._policy, other._byteBudget, other._shared) {}
+
+    MultiCache& operator=(const MultiCache&) = delete;
 
     /**
      * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if
@@ -47,18 +114,74 @@ public:
               typename BuilderType,
               typename ValueType = std::invoke_result_t<BuilderType&, const KeyType&>>
     typename CacheEntry<KeyType, ValueType>::ResultType getOrCreate(const KeyType& key, BuilderType builder) {
-        auto entry = getEntry<KeyType, ValueType>();
-        return entry->getOrCreate(key, std::move(builder));
+        if constexpr (is_shareable_cache_key<KeyType>::value) {
+            if (_shared) {
+                return _shared->getOrCreate(key, std::move(builder));
+            }
+        }
+        typename CacheEntry<KeyType, ValueType>::ResultType result;
+        if (_policy == EvictionPolicy::CostAware) {
+            if (isThreadSafe()) {
+                auto entry = _budgets.empty()
+                                 ? getEntry<SharedCostAwareEntryTypeT<KeyType, ValueType>>(_capacity, _numShards)
+                                 : getEntry<SharedCostAwareEntryTypeT<KeyType, ValueType>>(_capacity, _budgets);
+                result = entry->getOrCreate(key, std::move(builder));
+            } else {
+                auto budget = _budgets.empty() ? nullptr : _budgets.front();
+                auto entry = getEntry<CostAwareEntryTypeT<KeyType, ValueType>>(_capacity, budget);
+                result = entry->getOrCreate(key, std::move(builder));
+            }
+        } else if (isThreadSafe()) {
+            auto entry = getEntry<SharedEntryTypeT<KeyType, ValueType>>(_capacity, _numShards);
+            result = entry->getOrCreate(key, std::move(builder));
+        } else {
+            auto entry = getEntry<EntryTypeT<KeyType, ValueType>>(_capacity);
+            result = entry->getOrCreate(key, std::move(builder));
+        }
+        auto& counter = result.second == CacheEntryBase::LookUpStatus::Hit ? _hits : _misses;
+        counter.fetch_add(1, std::memory_order_relaxed);
+        return result;
+    }
+
+    [[nodiscard]] bool isThreadSafe() const noexcept {
+        return _numShards != 0;
     }
 
+    /**
+     * @brief Returns the thread safe cache storing the shareable records instead of this cache, if any
+     */
+    [[nodiscard]] const std::shared_ptr<MultiCache>& getSharedCache() const noexcept {
+        return _shared;
+    }
+
+    [[nodiscard]] EvictionPolicy getEvictionPolicy() const noexcept {
+        return _policy;
+    }
+
+    /**
+     * @brief Collects the lookup and eviction counters of all the entries.
+     * @note In the single threaded mode the caller must guarantee that the cache is not modified concurrently
+     */
+    [[nodiscard]] Statistics getStatistics() const;
+
 private:
     template <typename T>
     size_t getTypeId();
-    template <typename KeyType, typename ValueType>
-    EntryPtr<KeyType, ValueType> getEntry();
+    template <typename EntryType, typename... Args>
+    std::shared_ptr<EntryType> getEntry(Args&&... args);
 
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
+    size_t _numShards;
+    EvictionPolicy _policy;
+    size_t _byteBudget;
+    std::shared_ptr<MultiCache> _shared;
+    // byte budgets shared by the cost aware entries, one per shard index
+    std::vector<ByteBudget::Ptr> _budgets;
+    std::atomic_size_t _hits{0};
+    std::atomic_size_t _misses{0};
+    // guards the storage in the thread safe mode
+    mutable std::mutex _mutex;
     std::unordered_map<size_t, EntryBasePtr> _storage;
 };
 
@@ -68,13 +191,16 @@ size_t MultiCache::getTypeId() {
     return id;
 }
 
-template <typename KeyType, typename ValueType>
-MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
-    using EntryType = EntryTypeT<KeyType, ValueType>;
+template <typename EntryType, typename... Args>
+std::shared_ptr<EntryType> MultiCache::getEntry(Args&&... args) {
     size_t id = getTypeId<EntryType>();
+    std::unique_lock<std::mutex> lock(_mutex, std::defer_lock);
+    if (isThreadSafe()) {
+        lock.lock();
+    }
     auto itr = _storage.find(id);
     if (itr == _storage.end()) {
-        auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity)});
+        auto result = _storage.insert({id, std::make_shared<EntryType>(std::forward<Args>(args)...)});
         itr = result.first;
     }
     return std::static_pointer_cast<EntryType>(itr->second);
@@ -0,0 +1,170 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "cache_traits.h"
+#include "lru_cache.h"
+#include "byte_budget.h"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Lock-striped cache. The key space is split into a number of shards, each of them is an independent
+ * single threaded cache guarded by its own mutex, so lookups of different keys from different threads rarely contend.
+ * @tparam Key is a key type that must define hash() const method with return type convertible to size_t and define
+ * comparison operator.
+ * @tparam Value is a type that must meet all the requirements to the std::unordered_map mapped type
+ * @tparam ImplType is a type of the shard storage. It is constructed from the shard capacity followed by the rest of
+ * the ShardedCache constructor arguments.
+ *
+ * @note The eviction policy is maintained per shard, so the eviction order is only approximately global.
+ * The shards of the caches sharing the byte budgets are guarded by the budget mutexes instead of their own ones, so
+ * a shard may evict the records of the same index shard of another cache.
+ */
+
+template <typename Key, typename Value, typename ImplType = LruCache<Key, Value>>
+class ShardedCache {
+public:
+    static constexpr bool cost_aware = is_cost_aware_cache<ImplType>::value;
+
+    template <typename... Args>
+    ShardedCache(size_t capacity, size_t numShards, Args&&... args) : _capacity(capacity) {
+        numShards = std::max<size_t>(1, std::min(numShards, std::max<size_t>(1, capacity)));
+        const size_t shardCapacity = (capacity + numShards - 1) / numShards;
+        _shards.reserve(numShards);
+        for (size_t i = 0; i < numShards; ++i) {
+            _shards.emplace_back(std::make_unique<Shard>(shardCapacity, args...));
+        }
+    }
+
+    /**
+     * @param capacity maximum number of records
+     * @param budgets the byte budgets of the shards, one shard is created per budget
+     */
+    ShardedCache(size_t capacity, const std::vector<ByteBudget::Ptr>& budgets) : _capacity(capacity) {
+        const size_t numShards = std::max<size_t>(1, budgets.size());
+        const size_t shardCapacity = (capacity + numShards - 1) / numShards;
+        _shards.reserve(budgets.size());
+        for (const auto& budget : budgets) {
+            std::lock_guard<std::mutex> lock(budget->getMutex());
+            _shards.emplace_back(std::make_unique<Shard>(budget, shardCapacity));
+        }
+    }
+
+    ShardedCache(const ShardedCache&) = delete;
+    ShardedCache& operator=(const ShardedCache&) = delete;
+
+    ~ShardedCache() {
+        for (auto& shard : _shards) {
+            if (auto budget = shard->budget) {
+                // the budget participant must be detached under the budget mutex
+                std::lock_guard<std::mutex> lock(budget->getMutex());
+                shard.reset();
+            }
+        }
+    }
+
+    /**
+     * @brief Puts the value associated with the key into the cache.
+     * @param key
+     * @param value
+     * @param args optional record properties forwarded to the shard storage, e.g. cost and size
+     */
+
+    template <typename... Args>
+    void put(const Key& key, const Value& val, Args&&... args) {
+        auto& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.cache.put(key, val, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Searches a value associated with the key.
+     * @param key
+     * @return Value associated with the key or default constructed instance of the Value type.
+     */
+
+    Value get(const Key& key) {
+        auto& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.cache.get(key);
+    }
+
+    /**
+     * @brief Returns the current capacity value
+     * @return the current capacity value
+     */
+    [[nodiscard]] size_t getCapacity() const noexcept {
+        return _capacity;
+    }
+
+    /**
+     * @brief Returns the number of records stored in all the shards
+     * @return the number of records
+     */
+    [[nodiscard]] size_t getSize() const {
+        size_t size = 0;
+        for (const auto& shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            size += shard->cache.getSize();
+        }
+        return size;
+    }
+
+    /**
+     * @brief Returns the total number of records evicted from all the shards
+     * @return the number of evicted records
+     */
+    [[nodiscard]] size_t getEvictionCount() const {
+        size_t count = 0;
+        for (const auto& shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            count += shard->cache.getEvictionCount();
+        }
+        return count;
+    }
+
+    [[nodiscard]] size_t getNumShards() const noexcept {
+        return _shards.size();
+    }
+
+private:
+    struct Shard {
+        template <typename... Args>
+        explicit Shard(size_t capacity, Args&&... args) : mutex(ownMutex),
+                                                          cache(capacity, std::forward<Args>(args)...) {}
+        Shard(ByteBudget::Ptr byteBudget, size_t capacity)
+            : budget(std::move(byteBudget)),
+              mutex(budget->getMutex()),
+              cache(capacity, budget) {}
+        ByteBudget::Ptr budget;
+        std::mutex ownMutex;
+        std::mutex& mutex;
+        ImplType cache;
+    };
+
+    Shard& getShard(const Key& key) {
+        // the inner hash maps use the same key hash, so the shard index is taken from the mixed high bits
+        // to keep the bucket distribution inside each shard uniform
+        const auto hash = static_cast<uint64_t>(key.hash()) * 0x9E3779B97F4A7C15ULL;
+        return *_shards[(hash >> 32) % _shards.size()];
+    }
+
+    std::vector<std::unique_ptr<Shard>> _shards;
+    size_t _capacity;
+};
+
+template <typename Key, typename Value>
+using ShardedLruCache = ShardedCache<Key, Value, LruCache<Key, Value>>;
+
+}  // namespace ov::intel_cpu
@@ -5,38 +5,53 @@
 #include "compiled_model.h"
 
 #include <algorithm>
+#include <cstdint>
 #include <cstring>
 #include <exception>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <ostream>
+#include <sstream>
+#include <string>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "async_infer_request.h"
+#include "cache/multi_cache.h"
 #include "config.h"
 #include "cpu_parallel.hpp"
 #include "graph.h"
 #include "graph_context.h"
 #include "infer_request.h"
 #include "internal_properties.hpp"
+#include "itt.h"
 #include "low_precision/low_precision.hpp"
 #include "openvino/core/any.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/model.hpp"
+#include "openvino/core/partial_shape.hpp"
+#include "openvino/core/symbol.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/op/constant.hpp"
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/intel_cpu/properties.hpp"
 #include "openvino/runtime/iplugin.hpp"
 #include "openvino/runtime/isync_infer_request.hpp"
+#include "openvino/runtime/make_tensor.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/system_conf.hpp"
 #include "openvino/runtime/threading/cpu_message.hpp"
+#include "openvino/runtime/threading/cpu_streams_executor.hpp"
 #include "openvino/runtime/threading/cpu_streams_info.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
 #include "sub_memory_manager.hpp"
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
+#include "utils/graph_serializer/prepacked_weights.hpp"
 #include "utils/graph_serializer/serializer.hpp"
 #include "utils/memory_stats_dump.hpp"
 
@@ -51,6 +66,9 @@ using namespace ov::threading;
 
 namespace ov::intel_cpu {
 
+// model rt_info entry which keeps the recorded input shapes in the exported model
+static const char* const runtimeCacheShapesKey = "cpu_runtime_cache_input_shapes";
+
 struct ImmediateSerialExecutor : public ov::threading::ITaskExecutor {
     void run(ov::threading::Task task) override {
         std::lock_guard<std::mutex> l{_mutex};
@@ -59,6 +77,93 @@ struct ImmediateSerialExecutor : public ov::threading::ITaskExecutor {
     std::mutex _mutex;
 };
 
+static SocketsWeights createSocketsWeights(const std::shared_ptr<ov::Model>& model, const Config& cfg) {
+    switch (cfg.weightsReplication) {
+    case Config::WeightsReplication::Interleaved:
+        return SocketsWeights(SocketsWeights::ReplicationPolicy::Interleaved);
+    case Config::WeightsReplication::Hot: {
+        // the constants are ranked by size x number of consumers and taken in this order while the replicas fit into
+        // the budget on every socket except the one which owns the single copy
+        struct Candidate {
+            size_t score;
+            size_t size;
+            const void* data;
+        };
+        std::vector<Candidate> candidates;
+        for (const auto& op : model->get_ordered_ops()) {
+            if (const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(op)) {
+                const auto size = constant->get_byte_size();
+                const auto score = size * constant->output(0).get_target_inputs().size();
+                if (score != 0) {
+                    candidates.push_back({score, size, constant->get_data_ptr()});
+                }
+            }
+        }
+        std::stable_sort(candidates.begin(), candidates.end(), [](const Candidate& lhs, const Candidate& rhs) {
+            return lhs.score > rhs.score;
+        });
+        const auto numReplicas = static_cast<size_t>(std::max(1, get_num_sockets() - 1));
+        size_t budget = cfg.weightsReplicationByteBudget;
+        std::unordered_set<const void*> hot;
+        for (const auto& candidate : candidates) {
+            // a constant which doesn't fit doesn't stop the smaller ones with a lower score
+            if (candidate.size * numReplicas <= budget && hot.insert(candidate.data).second) {
+                budget -= candidate.size * numReplicas;
+            }
+        }
+        return SocketsWeights(SocketsWeights::ReplicationPolicy::Hot, cfg.weightsReplicationByteBudget, hot);
+    }
+    default:
+        return SocketsWeights(SocketsWeights::ReplicationPolicy::Full);
+    }
+}
+
+// Finds the batch axis of every model output by the propagation of a symbol set to the dynamic batch of the inputs.
+// Returns an empty vector if the inputs can't be padded to the bucket: an output doesn't keep the batch, or the batch
+// isn't the outermost non unit dimension of the output, so the output can't be cropped in place.
+static std::vector<size_t> findOutputBatchAxes(const std::shared_ptr<const ov::Model>& model,
+                                               const InputShapesRecorder::ShapeSet& bucket) {
+    const auto clone = model->clone();
+    const auto batch = std::make_shared<ov::Symbol>();
+    const auto& parameters = clone->get_parameters();
+    for (size_t i = 0; i < parameters.size(); ++i) {
+        const auto& modelShape = parameters[i]->get_partial_shape();
+        ov::PartialShape shape(bucket[i]);
+        if (modelShape.rank().is_static() && modelShape.size() != 0 && modelShape[0].is_dynamic()) {
+            shape[0] = ov::Dimension::dynamic();
+            shape[0].set_symbol(batch);
+        }
+        parameters[i]->set_partial_shape(shape);
+    }
+    try {
+        clone->validate_nodes_and_infer_types();
+    } catch (const ov::Exception&) {
+        return {};
+    }
+
+    std::vector<size_t> axes;
+    for (const auto& output : clone->outputs()) {
+        const auto& shape = output.get_partial_shape();
+        if (shape.rank().is_dynamic()) {
+            return {};
+        }
+        size_t axis = 0;
+        while (axis < shape.size() && shape[axis].is_static() && shape[axis].get_length() == 1) {
+            ++axis;
+        }
+        if (axis == shape.size() || !ov::symbol::are_equal(shape[axis].get_symbol(), batch)) {
+            return {};
+        }
+        for (size_t inner = axis + 1; inner < shape.size(); ++inner) {
+            if (ov::symbol::are_equal(shape[inner].get_symbol(), batch)) {
+                return {};
+            }
+        }
+        axes.push_back(axis);
+    }
+    return axes;
+}
+
 CompiledModel::~CompiledModel() {
     if (m_has_sub_compiled_models) {
         m_sub_compiled_models.clear();
@@ -75,15 +180,21 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                              const std::shared_ptr<const ov::IPlugin>& plugin,
                              Config cfg,
                              const bool loaded_from_cache,
-                             std::shared_ptr<SubMemoryManager> sub_memory_manager)
+                             std::shared_ptr<SubMemoryManager> sub_memory_manager,
+                             PrepackedWeights::Entries prepacked_weights)
     : ov::ICompiledModel::ICompiledModel(model, plugin),
       m_model(model),
       m_plugin(plugin),
       m_cfg{std::move(cfg)},
       m_name{model->get_name()},
       m_loaded_from_cache(loaded_from_cache),
+      m_socketWeights(createSocketsWeights(model, m_cfg)),
+      m_prepacked_weights(std::move(prepacked_weights)),
       m_sub_memory_manager(std::move(sub_memory_manager)) {
     m_mutex = std::make_shared<std::mutex>();
+    for (const auto& entry : m_prepacked_weights.weights) {
+        m_socketWeights.adopt(entry.key, entry.memory);
+    }
     const auto& core = m_plugin->get_core();
     OPENVINO_ASSERT(core, "Unable to get API version. Core is unavailable");
 
@@ -107,6 +218,11 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
     } else {
         m_callback_executor = m_task_executor;
     }
+    if (model->is_dynamic() && (!m_cfg.shapeBuckets.empty() || (m_cfg.rtCacheWarmup && m_cfg.rtCacheCapacity != 0))) {
+        // the warm up inferences are submitted from this thread, so the compilation doesn't wait for them
+        m_warmup_executor = m_plugin->get_executor_manager()->get_idle_cpu_streams_executor(
+            IStreamsExecutor::Config{"CPUWarmupExecutor", 1, 0});
+    }
 
     if (m_task_executor) {
         set_task_executor(m_task_executor);
@@ -118,6 +234,48 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
     m_optimized_single_stream = all_of(1, executor_config.get_streams(), executor_config.get_threads());
 
     int streams = std::max(1, executor_config.get_streams());
+    if (m_cfg.rtCacheShared) {
+        // a couple of shards per stream keeps the probability of lock contention low
+        const auto numShards = static_cast<size_t>(2 * streams);
+        m_sharedParamsCache = GraphContext::createRuntimeCache(m_cfg, m_cfg.rtCacheCapacity, numShards);
+        m_sharedSnippetsParamsCache = GraphContext::createRuntimeCache(m_cfg, m_cfg.snippetsCacheCapacity, numShards);
+    }
+    if (m_cfg.memoryArenaPool) {
+        // there are no more concurrent inferences than graphs, so the idle arenas over this number are not kept
+        m_arenaPool = std::make_shared<MemoryArenaPool>(static_cast<size_t>(streams));
+    }
+    if (m_cfg.rtCacheWarmup && m_cfg.rtCacheCapacity != 0 && model->is_dynamic()) {
+        m_inputShapesRecorder = std::make_shared<InputShapesRecorder>(m_cfg.rtCacheCapacity);
+        if (model->has_rt_info(runtimeCacheShapesKey)) {
+            const auto shapeSets =
+                InputShapesRecorder::deserialize(model->get_rt_info<std::string>(runtimeCacheShapesKey));
+            for (const auto& shapes : shapeSets) {
+                m_inputShapesRecorder->record(shapes);
+            }
+        }
+    }
+    for (const auto& bucket : m_cfg.shapeBuckets) {
+        OPENVINO_ASSERT(bucket.size() == model->inputs().size(),
+                        "The shape bucket ",
+                        InputShapesRecorder::serialize({bucket}),
+                        " doesn't match the number of the model inputs: ",
+                        model->inputs().size());
+        for (size_t i = 0; i < bucket.size(); ++i) {
+            OPENVINO_ASSERT(model->input(i).get_partial_shape().compatible(bucket[i]),
+                            "The shape bucket ",
+                            InputShapesRecorder::serialize({bucket}),
+                            " is not compatible with the model input ",
+                            model->input(i).get_partial_shape());
+        }
+        if (m_cfg.shapeBucketPadding) {
+            // the outputs of the model are cropped along the axes the batch propagates to
+            auto axes = findOutputBatchAxes(model, bucket);
+            if (!axes.empty()) {
+                m_paddingBuckets.push_back(bucket);
+                m_paddingOutputBatchAxes.push_back(std::move(axes));
+            }
+        }
+    }
     std::vector<Task> tasks;
     tasks.resize(streams);
     m_graphs.resize(streams);
@@ -168,7 +326,12 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                                                                     std::move(sub_streams_table),
                                                                     sub_cfg.streamsRankTable[i]};
             m_sub_compiled_models.push_back(
-                std::make_shared<CompiledModel>(model, plugin, sub_cfg, loaded_from_cache, m_sub_memory_manager));
+                std::make_shared<CompiledModel>(model,
+                                                plugin,
+                                                sub_cfg,
+                                                loaded_from_cache,
+                                                m_sub_memory_manager,
+                                                m_prepacked_weights));
         }
     }
 }
@@ -205,12 +368,21 @@ CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
                                                          isQuantizedFlag,
                                                          streamsExecutor,
                                                          cpuParallel,
-                                                         m_sub_memory_manager);
+                                                         m_sub_memory_manager,
+                                                         m_sharedParamsCache,
+                                                         m_sharedSnippetsParamsCache);
+                    if (m_arenaPool) {
+                        ctx->getAuxiliaryNetworkMemoryControl()->setArenaPool(m_arenaPool);
+                    }
                 }
 
                 const std::shared_ptr<const ov::Model> model = m_model;
                 graphLock._graph.Init(model, ctx);
                 graphLock._graph.Activate();
+                if (m_arenaPool) {
+                    // the memory allocated for the graph initialization is replaced with an arena on inference
+                    ctx->releaseMemory();
+                }
             } catch (...) {
                 exception = std::current_exception();
             }
@@ -233,17 +405,44 @@ std::shared_ptr<ov::ISyncInferRequest> CompiledModel::create_sync_infer_request(
 }
 
 std::shared_ptr<ov::IAsyncInferRequest> CompiledModel::create_infer_request() const {
+    return create_infer_request(m_requestPriority.load());
+}
+
+void CompiledModel::set_property(const ov::AnyMap& properties) {
+    for (const auto& [key, value] : properties) {
+        if (key != ov::intel_cpu::cpu_infer_request_priority.name()) {
+            OPENVINO_THROW_NOT_IMPLEMENTED("It's not possible to set property ",
+                                           key,
+                                           " of an already compiled model. "
+                                           "Set property to Core::compile_model during compilation");
+        }
+    }
+    for (const auto& [key, value] : properties) {
+        try {
+            m_requestPriority = value.as<ov::hint::Priority>();
+        } catch (ov::Exception&) {
+            OPENVINO_THROW("Wrong value ",
+                           value.as<std::string>(),
+                           " for property key ",
+                           key,
+                           ". Expected values: ov::hint::Priority::LOW/MEDIUM/HIGH");
+        }
+    }
+}
+
+std::shared_ptr<ov::IAsyncInferRequest> CompiledModel::create_infer_request(ov::hint::Priority priority) const {
     auto internal_request = create_sync_infer_request();
     auto async_infer_request =
         std::make_shared<AsyncInferRequest>(std::static_pointer_cast<SyncInferRequest>(internal_request),
                                             get_task_executor(),
                                             get_callback_executor(),
-                                            m_optimized_single_stream);
+                                            m_optimized_single_stream,
+                                            priority);
     if (m_has_sub_compiled_models) {
         std::vector<std::shared_ptr<IAsyncInferRequest>> requests;
         requests.reserve(m_sub_compiled_models.size());
         for (const auto& model : m_sub_compiled_models) {
-            requests.push_back(model->create_infer_request());
+            requests.push_back(model->create_infer_request(priority));
         }
         async_infer_request->setSubInferRequest(requests);
         async_infer_request->setSubInfer(true);
@@ -264,6 +463,55 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
         return m_loaded_from_cache;
     }
 
+    if (name == ov::intel_cpu::cpu_runtime_cache_statistics) {
+        return decltype(ov::intel_cpu::cpu_runtime_cache_statistics)::value_type(get_runtime_cache_statistics());
+    }
+
+    if (name == ov::intel_cpu::cpu_memory_footprint) {
+        return decltype(ov::intel_cpu::cpu_memory_footprint)::value_type(get_memory_footprint());
+    }
+
+    if (name == ov::intel_cpu::cpu_memory_solver_report) {
+        auto graphLock = get_graph();
+        const auto& memoryControl = graphLock._graph.getGraphContext()->getAuxiliaryNetworkMemoryControl();
+        const uint64_t arenaBytes = memoryControl->arenaSize();
+        const uint64_t lowerBoundBytes = memoryControl->arenaLowerBound();
+        return decltype(ov::intel_cpu::cpu_memory_solver_report)::value_type{
+            {"arena_bytes", arenaBytes},
+            {"lower_bound_bytes", lowerBoundBytes},
+            {"fragmentation_bytes", arenaBytes - std::min(arenaBytes, lowerBoundBytes)}};
+    }
+
+    if (name == ov::intel_cpu::cpu_infer_request_priority) {
+        return decltype(ov::intel_cpu::cpu_infer_request_priority)::value_type(m_requestPriority.load());
+    }
+
+    if (name == ov::intel_cpu::cpu_task_queue_statistics) {
+        decltype(ov::intel_cpu::cpu_task_queue_statistics)::value_type retVal;
+        if (const auto executor = std::dynamic_pointer_cast<ov::threading::CPUStreamsExecutor>(m_task_executor)) {
+            for (const auto& [priority, stats] : executor->get_queue_statistics()) {
+                std::stringstream lane;
+                lane << priority << "_";
+                retVal[lane.str() + "enqueued"] = stats.enqueued;
+                retVal[lane.str() + "depth"] = stats.depth;
+                retVal[lane.str() + "max_depth"] = stats.max_depth;
+                retVal[lane.str() + "total_wait_ns"] = stats.total_wait_ns;
+                retVal[lane.str() + "max_wait_ns"] = stats.max_wait_ns;
+            }
+        }
+        return retVal;
+    }
+
+    if (name == ov::intel_cpu::cpu_weights_cache_statistics) {
+        const auto stats = m_socketWeights.getContentionStatistics();
+        return decltype(ov::intel_cpu::cpu_weights_cache_statistics)::value_type{
+            {"lookups", stats.lookups},
+            {"creations", stats.creations},
+            {"lock_contentions", stats.lock_contentions},
+            {"lock_wait_ns", stats.lock_wait_ns},
+            {"replica_bytes", m_socketWeights.getReplicaBytes()}};
+    }
+
     Config engConfig = get_graph()._graph.getConfig();
     auto option = engConfig._config.find(name);
     if (option != engConfig._config.end()) {
@@ -412,9 +660,146 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
     OPENVINO_THROW("Unsupported property: ", name);
 }
 
+std::map<std::string, uint64_t> CompiledModel::get_runtime_cache_statistics() const {
+    MultiCache::Statistics stats;
+    if (m_sharedParamsCache) {
+        stats += m_sharedParamsCache->getStatistics();
+        stats += m_sharedSnippetsParamsCache->getStatistics();
+    }
+    for (auto&& graph : m_graphs) {
+        // per stream caches are not thread safe, so wait until the stream finishes the current inference
+        std::lock_guard<std::mutex> lock(graph._mutex);
+        if (!graph.IsReady()) {
+            continue;
+        }
+        auto ctx = graph.getGraphContext();
+        stats += ctx->getParamsCache()->getStatistics();
+        stats += ctx->getSnippetsParamsCache()->getStatistics();
+    }
+    return {{"hits", stats.hits},
+            {"misses", stats.misses},
+            {"evictions", stats.evictions},
+            {"records", stats.records}};
+}
+
+std::map<std::string, uint64_t> CompiledModel::get_memory_footprint() const {
+    uint64_t arenas = 0;
+    uint64_t bytes = 0;
+    if (m_arenaPool) {
+        arenas = m_arenaPool->arenas();
+        bytes = m_arenaPool->footprint();
+    } else {
+        for (auto&& graph : m_graphs) {
+            std::lock_guard<std::mutex> lock(graph._mutex);
+            if (!graph.IsReady()) {
+                continue;
+            }
+            const auto size = graph.getGraphContext()->getAuxiliaryNetworkMemoryControl()->arenaSize();
+            if (size > 0) {
+                arenas++;
+                bytes += size;
+            }
+        }
+    }
+    const auto requests = static_cast<uint64_t>(std::max(1, m_numRequests.load()));
+    return {{"arenas", arenas}, {"arena_bytes", bytes}, {"per_request_bytes", bytes / requests}};
+}
+
 void CompiledModel::export_model(std::ostream& modelStream) const {
-    ModelSerializer serializer(modelStream, m_cfg.cacheEncrypt, m_cfg.m_cache_mode == ov::CacheMode::OPTIMIZE_SIZE);
-    serializer << m_model;
+    auto model = m_model;
+    if (m_inputShapesRecorder) {
+        // the compiled model is shared with the running requests, so the shapes are stored in the rt_info of a copy
+        {
+            std::lock_guard<std::mutex> lock{*m_mutex};
+            model = m_model->clone();
+        }
+        model->set_rt_info(InputShapesRecorder::serialize(m_inputShapesRecorder->get()), runtimeCacheShapesKey);
+    }
+    const bool weightless = m_cfg.m_cache_mode == ov::CacheMode::OPTIMIZE_SIZE;
+    if (m_cfg.cachePrepackedWeights && !m_cfg.cacheEncrypt && !weightless) {
+        // the section precedes the model, as the serialized model extends to the end of the blob
+        PrepackedWeights::write(modelStream, PrepackedWeights::collect(m_socketWeights, m_model));
+    }
+    ModelSerializer serializer(modelStream, m_cfg.cacheEncrypt, weightless);
+    serializer << model;
+}
+
+void CompiledModel::warm_up_runtime_cache() const {
+    if (!m_inputShapesRecorder) {
+        return;
+    }
+    auto shapeSets = m_inputShapesRecorder->get();
+    if (shapeSets.empty()) {
+        return;
+    }
+    // the task doesn't prolong the compiled model lifetime, the warm up is skipped once the model is released
+    std::weak_ptr<const CompiledModel> weakModel = std::static_pointer_cast<const CompiledModel>(shared_from_this());
+    m_warmup_executor->run([weakModel, shapeSets = std::move(shapeSets)] {
+        auto compiledModel = weakModel.lock();
+        if (!compiledModel) {
+            return;
+        }
+        OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::ov_intel_cpu_LT, "warm_up_runtime_cache");
+        compiledModel->infer_input_shapes(shapeSets);
+    });
+}
+
+void CompiledModel::precompile_shape_buckets() const {
+    // the executor is created for the dynamic models with the declared buckets
+    if (m_cfg.shapeBuckets.empty() || !m_warmup_executor) {
+        return;
+    }
+    // the tasks do not prolong the compiled model lifetime, the remaining buckets are skipped once it is released
+    std::weak_ptr<const CompiledModel> weakModel = std::static_pointer_cast<const CompiledModel>(shared_from_this());
+    for (const auto& bucket : m_cfg.shapeBuckets) {
+        m_warmup_executor->run([weakModel, bucket] {
+            auto compiledModel = weakModel.lock();
+            if (!compiledModel) {
+                return;
+            }
+            OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::ov_intel_cpu_LT, "precompile_shape_bucket");
+            compiledModel->infer_input_shapes({bucket});
+        });
+    }
+}
+
+void CompiledModel::infer_input_shapes(const std::vector<InputShapesRecorder::ShapeSet>& shapeSets) const {
+    // every stream has to build its own entries, even with a shared cache the executors with per-execution state are
+    // kept per stream. The concurrent requests are taken by the idle streams, but a request isn't bound to a stream,
+    // so a stream busy with the user inferences may be skipped and builds its entries on the first inference of the
+    // shape.
+    const size_t numRequests = m_graphs.size();
+    std::vector<std::shared_ptr<ov::IAsyncInferRequest>> requests;
+    requests.reserve(numRequests);
+    // the warm up shares the streams with the user inferences, which overtake it in the queue
+    for (size_t i = 0; i < numRequests; ++i) {
+        requests.push_back(create_infer_request(ov::hint::Priority::LOW));
+    }
+
+    const auto& modelInputs = inputs();
+    for (const auto& shapes : shapeSets) {
+        if (shapes.size() != modelInputs.size()) {
+            continue;
+        }
+        for (const auto& request : requests) {
+            for (size_t i = 0; i < modelInputs.size(); ++i) {
+                auto tensor = ov::make_tensor(modelInputs[i].get_element_type(), shapes[i]);
+                if (modelInputs[i].get_element_type() != ov::element::string) {
+                    std::memset(tensor->data(), 0, tensor->get_byte_size());
+                }
+                request->set_tensor(modelInputs[i], tensor);
+            }
+            request->start_async();
+        }
+        for (const auto& request : requests) {
+            try {
+                request->wait();
+            } catch (const std::exception& exp) {
+                // zero filled inputs may be invalid for some models (e.g. shape values), such shapes are skipped
+                DEBUG_LOG("Runtime cache warm up failed for model ", m_name, ": ", exp.what());
+            }
+        }
+    }
 }
 
 void CompiledModel::release_memory() {
@@ -427,6 +812,9 @@ void CompiledModel::release_memory() {
         auto ctx = graph.getGraphContext();
         ctx->releaseMemory();
     }
+    if (m_arenaPool) {
+        m_arenaPool->clear();
+    }
 }
 
 }  // namespace ov::intel_cpu
@@ -5,7 +5,9 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
 #include <deque>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <ostream>
@@ -13,8 +15,11 @@
 #include <utility>
 #include <vector>
 
+#include "cache/input_shapes_recorder.h"
+#include "cache/multi_cache.h"
 #include "config.h"
 #include "graph.h"
+#include "memory_control.hpp"
 #include "openvino/core/any.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/model.hpp"
@@ -24,6 +29,7 @@
 #include "openvino/runtime/isync_infer_request.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
 #include "sub_memory_manager.hpp"
+#include "utils/graph_serializer/prepacked_weights.hpp"
 #include "weights_cache.hpp"
 
 namespace ov::intel_cpu {
@@ -44,25 +50,42 @@ public:
                   const std::shared_ptr<const ov::IPlugin>& plugin,
                   Config cfg,
                   bool loaded_from_cache,
-                  std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr);
+                  std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr,
+                  PrepackedWeights::Entries prepacked_weights = {});
 
     ~CompiledModel() override;
 
     std::shared_ptr<ov::IAsyncInferRequest> create_infer_request() const override;
 
+    // the request tasks are queued in the given priority lane of the CPU streams executor
+    std::shared_ptr<ov::IAsyncInferRequest> create_infer_request(ov::hint::Priority priority) const;
+
     void export_model(std::ostream& model) const override;
 
     std::shared_ptr<const ov::Model> get_runtime_model() const override;
 
     ov::Any get_property(const std::string& name) const override;
 
-    void set_property([[maybe_unused]] const ov::AnyMap& properties) override {
-        OPENVINO_THROW_NOT_IMPLEMENTED("It's not possible to set property of an already compiled model. "
-                                       "Set property to Core::compile_model during compilation");
-    };
+    // only the priority of the infer requests created later (CPU_INFER_REQUEST_PRIORITY) may be changed
+    void set_property(const ov::AnyMap& properties) override;
 
     void release_memory() override;
 
+    /**
+     * @brief Schedules the replay of the input shapes recorded before the model export on a background executor to
+     * prebuild the runtime cache entries. Without a shared runtime cache one request per stream is started, but it
+     * isn't guaranteed that every stream takes one of them.
+     * Does nothing if the CPU_RUNTIME_CACHE_WARMUP mode is disabled or no shapes were recorded.
+     */
+    void warm_up_runtime_cache() const;
+
+    /**
+     * @brief Schedules the inference of the declared shape buckets (see CPU_SHAPE_BUCKETS) on a background executor,
+     * one bucket per task, so the runtime parameters of the buckets are prepared while the model is idle.
+     * Does nothing for static models or if no buckets are declared.
+     */
+    void precompile_shape_buckets() const;
+
     std::string name() const {
         return m_name;
     }
@@ -75,6 +98,7 @@ private:
     const std::shared_ptr<const ov::IPlugin> m_plugin;
     std::shared_ptr<ov::threading::ITaskExecutor> m_task_executor = nullptr;      //!< Holds a task executor
     std::shared_ptr<ov::threading::ITaskExecutor> m_callback_executor = nullptr;  //!< Holds a callback executor
+    std::shared_ptr<ov::threading::ITaskExecutor> m_warmup_executor = nullptr;    //!< Runs the warm up inferences
 
     // Generic synchronization primitive on CompiledModel level.
     // Usage example: helps to avoid data races during CPU Graph initialization in multi-streams scenario
@@ -87,6 +111,21 @@ private:
     // WARNING: Do not use m_graphs directly.
     mutable std::deque<GraphGuard> m_graphs;
     mutable SocketsWeights m_socketWeights;
+    // the weights imported in the final layout, the weights caches keep only weak references
+    PrepackedWeights::Entries m_prepacked_weights;
+    // caches of the immutable runtime records shared by all the streams, created only if Config::rtCacheShared is set
+    MultiCachePtr m_sharedParamsCache;
+    MultiCachePtr m_sharedSnippetsParamsCache;
+    // the priority lane of the infer requests created by create_infer_request()
+    std::atomic<ov::hint::Priority> m_requestPriority{ov::hint::Priority::DEFAULT};
+    // distinct input shapes seen by the model, created only if Config::rtCacheWarmup is set
+    InputShapesRecorderPtr m_inputShapesRecorder;
+    // the shape buckets the inputs are padded to if Config::shapeBucketPadding is set, only the buckets with the batch
+    // axis of every output found by the shape propagation
+    std::vector<InputShapesRecorder::ShapeSet> m_paddingBuckets;
+    std::vector<std::vector<size_t>> m_paddingOutputBatchAxes;
+    // intermediate memory arenas shared by the graphs, created only if Config::memoryArenaPool is set
+    MemoryArenaPool::Ptr m_arenaPool;
 
     /* WARNING: Use get_graph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -94,6 +133,13 @@ private:
      */
     GraphGuard::Lock get_graph() const;
 
+    std::map<std::string, uint64_t> get_runtime_cache_statistics() const;
+
+    std::map<std::string, uint64_t> get_memory_footprint() const;
+
+    // infers zero filled inputs of the given shapes to prepare the runtime parameters
+    void infer_input_shapes(const std::vector<InputShapesRecorder::ShapeSet>& shapeSets) const;
+
     std::vector<std::shared_ptr<CompiledModel>> get_sub_compiled_models() const {
         return m_sub_compiled_models;
     }
@@ -152,6 +198,28 @@ public:
         return m_id;
     }
 
+    [[nodiscard]] bool records_input_shapes() const {
+        return m_compiled_model->m_inputShapesRecorder != nullptr;
+    }
+
+    void record_input_shapes(const InputShapesRecorder::ShapeSet& shapes) const {
+        m_compiled_model->m_inputShapesRecorder->record(shapes);
+    }
+
+    /**
+     * @return the shape buckets the inputs are padded to, empty if the padding mode is disabled
+     */
+    [[nodiscard]] const std::vector<InputShapesRecorder::ShapeSet>& padding_shape_buckets() const {
+        return m_compiled_model->m_paddingBuckets;
+    }
+
+    /**
+     * @return the batch axis of every model output for the padding bucket with the given index
+     */
+    [[nodiscard]] const std::vector<size_t>& padding_output_batch_axes(size_t bucket_index) const {
+        return m_compiled_model->m_paddingOutputBatchAxes[bucket_index];
+    }
+
 private:
     std::shared_ptr<const CompiledModel> m_compiled_model;
     const Graph* m_graph;
@@ -6,12 +6,14 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <exception>
 #include <map>
 #include <memory>
 #include <set>
 #include <string>
 #include <vector>
 
+#include "cache/input_shapes_recorder.h"
 #include "cpu/x64/cpu_isa_traits.hpp"
 #include "internal_properties.hpp"
 #include "openvino/core/any.hpp"
@@ -285,6 +287,137 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
             snippetsCacheCapacity = std::max(val_i, 0);
+        } else if (ov::intel_cpu::cpu_runtime_cache_shared.name() == key) {
+            try {
+                rtCacheShared = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_runtime_cache_shared.name(),
+                               ". Expected only true/false");
+            }
+        } else if (ov::intel_cpu::cpu_runtime_cache_warmup.name() == key) {
+            try {
+                rtCacheWarmup = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_runtime_cache_warmup.name(),
+                               ". Expected only true/false");
+            }
+        } else if (ov::intel_cpu::cpu_runtime_cache_policy.name() == key) {
+            try {
+                const auto policy = val.as<ov::intel_cpu::RuntimeCachePolicy>();
+                rtCachePolicy = policy == ov::intel_cpu::RuntimeCachePolicy::COST_AWARE ? RtCachePolicy::CostAware
+                                                                                       : RtCachePolicy::LRU;
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_runtime_cache_policy.name(),
+                               ". Expected values: ov::intel_cpu::RuntimeCachePolicy::LRU/COST_AWARE");
+            }
+        } else if (ov::intel_cpu::cpu_runtime_cache_byte_budget.name() == key) {
+            try {
+                rtCacheByteBudget = val.as<uint64_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_runtime_cache_byte_budget.name(),
+                               ". Expected only unsigned integer numbers");
+            }
+        } else if (ov::intel_cpu::cpu_weights_replication.name() == key) {
+            try {
+                switch (val.as<ov::intel_cpu::WeightsReplicationPolicy>()) {
+                case ov::intel_cpu::WeightsReplicationPolicy::INTERLEAVED:
+                    weightsReplication = WeightsReplication::Interleaved;
+                    break;
+                case ov::intel_cpu::WeightsReplicationPolicy::HOT:
+                    weightsReplication = WeightsReplication::Hot;
+                    break;
+                default:
+                    weightsReplication = WeightsReplication::Full;
+                }
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_weights_replication.name(),
+                               ". Expected values: ov::intel_cpu::WeightsReplicationPolicy::FULL/INTERLEAVED/HOT");
+            }
+        } else if (ov::intel_cpu::cpu_weights_replication_byte_budget.name() == key) {
+            try {
+                weightsReplicationByteBudget = val.as<uint64_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_weights_replication_byte_budget.name(),
+                               ". Expected only unsigned integer numbers");
+            }
+        } else if (ov::intel_cpu::cpu_cache_prepacked_weights.name() == key) {
+            try {
+                cachePrepackedWeights = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_cache_prepacked_weights.name(),
+                               ". Expected only true/false");
+            }
+        } else if (ov::intel_cpu::cpu_memory_arena_pool.name() == key) {
+            try {
+                memoryArenaPool = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_memory_arena_pool.name(),
+                               ". Expected only true/false");
+            }
+        } else if (ov::intel_cpu::cpu_memory_solver.name() == key) {
+            try {
+                switch (val.as<ov::intel_cpu::MemorySolverPolicy>()) {
+                case ov::intel_cpu::MemorySolverPolicy::BEST_FIT:
+                    memorySolver = MemorySolverType::BestFit;
+                    break;
+                case ov::intel_cpu::MemorySolverPolicy::MULTI_ORDER:
+                    memorySolver = MemorySolverType::MultiOrder;
+                    break;
+                default:
+                    memorySolver = MemorySolverType::Greedy;
+                }
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_memory_solver.name(),
+                               ". Expected values: ov::intel_cpu::MemorySolverPolicy::GREEDY/BEST_FIT/MULTI_ORDER");
+            }
+        } else if (ov::intel_cpu::cpu_shape_buckets.name() == key) {
+            try {
+                shapeBuckets = InputShapesRecorder::deserialize(val.as<std::string>());
+            } catch (const std::exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_shape_buckets.name(),
+                               ". Expected shapes of all the model inputs per bucket, e.g. ",
+                               "[1,128][1,128]|[4,128][4,128]");
+            }
+        } else if (ov::intel_cpu::cpu_shape_bucket_padding.name() == key) {
+            try {
+                shapeBucketPadding = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_shape_bucket_padding.name(),
+                               ". Expected only true/false");
+            }
         } else if (ov::intel_cpu::denormals_optimization.name() == key) {
             try {
                 denormalsOptMode = val.as<bool>() ? DenormalsOptMode::DO_On : DenormalsOptMode::DO_Off;
@@ -475,6 +608,39 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
             } catch (ov::Exception&) {
                 OPENVINO_THROW("Wrong value for property key ", ov::intel_cpu::enable_sage_attn.name());
             }
+        } else if (ov::intel_cpu::cpu_kv_cache_eviction.name() == key) {
+            try {
+                switch (val.as<ov::intel_cpu::KVCacheEvictionPolicy>()) {
+                case ov::intel_cpu::KVCacheEvictionPolicy::H2O:
+                    kvCacheEviction = KVCacheEviction::H2O;
+                    break;
+                case ov::intel_cpu::KVCacheEvictionPolicy::SNAPKV:
+                    kvCacheEviction = KVCacheEviction::SnapKV;
+                    break;
+                case ov::intel_cpu::KVCacheEvictionPolicy::SLIDING_WINDOW:
+                    kvCacheEviction = KVCacheEviction::SlidingWindow;
+                    break;
+                default:
+                    kvCacheEviction = KVCacheEviction::None;
+                }
+            } catch (ov::Exception&) {
+                OPENVINO_THROW(
+                    "Wrong value ",
+                    val.as<std::string>(),
+                    " for property key ",
+                    ov::intel_cpu::cpu_kv_cache_eviction.name(),
+                    ". Expected values: ov::intel_cpu::KVCacheEvictionPolicy::NONE/H2O/SNAPKV/SLIDING_WINDOW");
+            }
+        } else if (ov::intel_cpu::cpu_kv_cache_eviction_budget.name() == key) {
+            try {
+                kvCacheEvictionBudget = val.as<uint64_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_kv_cache_eviction_budget.name(),
+                               ". Expected only unsigned integer numbers");
+            }
         } else if (key == ov::enable_weightless.name()) {
             try {
                 enableWeightless = val.as<bool>();
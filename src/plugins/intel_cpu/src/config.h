@@ -15,6 +15,7 @@
 
 #include "openvino/core/any.hpp"
 #include "openvino/core/attribute_visitor.hpp"
+#include "openvino/core/shape.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/runtime/intel_cpu/properties.hpp"
 #include "openvino/runtime/properties.hpp"
@@ -50,6 +51,14 @@ struct Config {
 
     enum class ModelType : uint8_t { CNN, LLM, Unknown };
 
+    enum class RtCachePolicy : uint8_t { LRU, CostAware };
+
+    enum class WeightsReplication : uint8_t { Full, Interleaved, Hot };
+
+    enum class MemorySolverType : uint8_t { Greedy, BestFit, MultiOrder };
+
+    enum class KVCacheEviction : uint8_t { None, H2O, SnapKV, SlidingWindow };
+
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     SnippetsMode snippetsMode = SnippetsMode::Enable;
@@ -73,6 +82,18 @@ struct Config {
     size_t rtCacheCapacity = 5000UL;
 #endif
     size_t snippetsCacheCapacity = 5000UL;
+    bool rtCacheShared = false;
+    bool rtCacheWarmup = false;
+    RtCachePolicy rtCachePolicy = RtCachePolicy::LRU;
+    uint64_t rtCacheByteBudget = 0;
+    // expected input shapes of a dynamic model, each bucket holds the shapes of all the model inputs
+    std::vector<std::vector<ov::Shape>> shapeBuckets;
+    bool shapeBucketPadding = false;
+    WeightsReplication weightsReplication = WeightsReplication::Full;
+    uint64_t weightsReplicationByteBudget = 0;
+    bool cachePrepackedWeights = false;
+    bool memoryArenaPool = false;
+    MemorySolverType memorySolver = MemorySolverType::Greedy;
 #if defined(OPENVINO_ARCH_X86_64)
     ov::element::Type kvCachePrecision = ov::element::u8;
     ov::element::Type keyCachePrecision = ov::element::u8;
@@ -87,6 +108,8 @@ struct Config {
     CacheQuantMode keyCacheQuantMode = CacheQuantMode::AUTO;
     CacheQuantMode valueCacheQuantMode = CacheQuantMode::AUTO;
     bool enableSageAttn = false;
+    KVCacheEviction kvCacheEviction = KVCacheEviction::None;
+    uint64_t kvCacheEvictionBudget = 0;
     ov::threading::IStreamsExecutor::Config streamExecutorConfig;
     int streams = 1;
     bool streamsChanged = false;
@@ -557,10 +557,11 @@ void StaticMemory::StaticMemoryBlock::unregisterMemory(Memory* memPtr) {
 }
 
 #if defined(__linux__)
-#    define MPOL_DEFAULT   0
-#    define MPOL_BIND      2
-#    define MPOL_MF_STRICT (1 << 0)
-#    define MPOL_MF_MOVE   (1 << 1)
+#    define MPOL_DEFAULT    0
+#    define MPOL_BIND       2
+#    define MPOL_INTERLEAVE 3
+#    define MPOL_MF_STRICT  (1 << 0)
+#    define MPOL_MF_MOVE    (1 << 1)
 #    if !defined(__NR_mbind)
 #        define NR_mbind 237
 #    else
@@ -602,10 +603,46 @@ bool mbind_move(void* data, size_t size, int targetNode) {
     }
     return true;
 }
+
+bool mbind_interleave(const MemoryCPtr& mem) {
+    const int numNodes = get_num_numa_nodes();
+    if (numNodes < 2 || !mem || mem->getSize() == 0) {
+        return false;
+    }
+    auto pagesize = getpagesize();
+    auto* data = static_cast<char*>(mem->getData());
+    auto size = mem->getSize();
+    // only the pages which are entirely owned by the memory object are moved
+    auto* begin = reinterpret_cast<char*>(  // NOLINT(performance-no-int-to-ptr)
+        ((reinterpret_cast<uintptr_t>(data) + pagesize - 1) & ~(static_cast<uintptr_t>(pagesize - 1))));
+    auto* end = reinterpret_cast<char*>(  // NOLINT(performance-no-int-to-ptr)
+        ((reinterpret_cast<uintptr_t>(data + size)) & ~(static_cast<uintptr_t>(pagesize - 1))));
+    if (end <= begin) {
+        return false;
+    }
+    uint64_t mask = 0;
+    for (int node = 0; node < numNodes; node++) {
+        const int realNode = ov::get_org_numa_id(node);
+        if (realNode >= 0 && realNode < static_cast<int>(sizeof(mask) * 8)) {
+            mask |= 1UL << realNode;
+        }
+    }
+
+    auto rc = mbind(begin, end - begin, MPOL_INTERLEAVE, &mask, sizeof(mask) * 8, MPOL_MF_MOVE);
+    if (rc < 0) {
+        DEBUG_LOG("mbind interleave failed: ", strerror(errno));
+        return false;
+    }
+    return true;
+}
 #else
 bool mbind_move(void* data, size_t size, int targetNode) {
     return false;
 }
+
+bool mbind_interleave(const MemoryCPtr& mem) {
+    return false;
+}
 #endif
 
 bool mbind_move(const MemoryCPtr& mem, int numaNodeID) {
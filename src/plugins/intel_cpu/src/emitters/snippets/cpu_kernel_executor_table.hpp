@@ -31,6 +31,9 @@ public:
 
 protected:
     struct Key {
+        // the compiled kernels are immutable, so they are shared by the streams
+        static constexpr bool shareable = true;
+
         explicit Key(Conf c) : config{std::move(c)} {}
         const Conf config;
         [[nodiscard]] size_t hash() const {
@@ -102,6 +102,9 @@ BrgemmAMXKernelExecutor::BrgemmAMXKernelExecutor(ov::intel_cpu::MultiCacheWeakPt
 
 namespace {
 struct BrgemmCopyAKey {
+    // the JIT kernels are immutable, so they are shared by the streams
+    static constexpr bool shareable = true;
+
     BrgemmCopyAKey(cpu_isa_t isa,
                    dnnl_data_type_t dt,
                    dnnl_dim_t K,
@@ -50,6 +50,7 @@
 #include "nodes/convert.h"
 #include "nodes/input.h"
 #include "nodes/memory.hpp"
+#include "nodes/paged_attn.h"
 #include "nodes/reorder.h"
 #include "nodes/tensoriterator.h"
 #include "openvino/core/except.hpp"
@@ -2160,4 +2161,19 @@ void Graph::assignStates(const std::vector<MemStatePtr>& states) {
     }
 }
 
+std::shared_ptr<ov::Extensions::Cpu::KVCacheEvictionState> Graph::kvCacheEvictionState() const {
+    const bool hasPagedAttention = std::any_of(graphNodes.begin(), graphNodes.end(), [](const NodePtr& node) {
+        return node->getType() == Type::PagedAttention;
+    });
+    return hasPagedAttention ? node::PagedAttention::makeKVCacheEvictionState(getConfig()) : nullptr;
+}
+
+void Graph::assignKVCacheEvictionState(const std::shared_ptr<ov::Extensions::Cpu::KVCacheEvictionState>& state) {
+    for (const auto& node : graphNodes) {
+        if (node->getType() == Type::PagedAttention) {
+            std::static_pointer_cast<node::PagedAttention>(node)->assignKVCacheEvictionState(state);
+        }
+    }
+}
+
 }  // namespace ov::intel_cpu
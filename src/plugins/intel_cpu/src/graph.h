@@ -21,6 +21,7 @@
 #include "memory_state.h"
 #include "node.h"
 #include "nodes/input.h"
+#include "nodes/kernels/scaled_attn/kv_cache_eviction.hpp"
 #include "openvino/core/model.hpp"
 #include "openvino/runtime/profiling_info.hpp"
 #include "openvino/runtime/so_ptr.hpp"
@@ -155,6 +156,10 @@ public:
     std::vector<MemStatePtr> memoryStates() const;
     void assignStates(const std::vector<MemStatePtr>& state);
 
+    // the built-in KV cache eviction state shared by the PagedAttention nodes, nullptr if there is nothing to evict
+    std::shared_ptr<ov::Extensions::Cpu::KVCacheEvictionState> kvCacheEvictionState() const;
+    void assignKVCacheEvictionState(const std::shared_ptr<ov::Extensions::Cpu::KVCacheEvictionState>& state);
+
     void GetPerfData(std::vector<ov::ProfilingInfo>& perfMap) const;
 
     void CreateEdge(const NodePtr& parent, const NodePtr& child, int parentPort = 0, int childPort = 0);
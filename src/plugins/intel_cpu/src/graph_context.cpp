@@ -4,6 +4,7 @@
 #include "graph_context.h"
 
 #include <algorithm>
+#include <cstddef>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <utility>
@@ -27,18 +28,21 @@ GraphContext::GraphContext(Config config,
                            bool isGraphQuantized,
                            ov::threading::IStreamsExecutor::Ptr streamExecutor,
                            std::shared_ptr<CpuParallel> cpuParallel,
-                           std::shared_ptr<SubMemoryManager> sub_memory_manager)
+                           std::shared_ptr<SubMemoryManager> sub_memory_manager,
+                           MultiCachePtr rtParamsCache,
+                           MultiCachePtr snippetsParamsCache)
     : m_config(std::move(config)),
       m_weightsCache(std::move(w_cache)),
-      m_rtParamsCache(std::make_shared<MultiCache>(m_config.rtCacheCapacity)),
-      m_snippetsParamsCache(std::make_shared<MultiCache>(m_config.snippetsCacheCapacity)),
+      m_rtParamsCache(createRuntimeCache(m_config, m_config.rtCacheCapacity, 0, std::move(rtParamsCache))),
+      m_snippetsParamsCache(
+          createRuntimeCache(m_config, m_config.snippetsCacheCapacity, 0, std::move(snippetsParamsCache))),
       m_isGraphQuantizedFlag(isGraphQuantized),
       m_streamExecutor(std::move(streamExecutor)),
       m_cpuParallel(std::move(cpuParallel)),
       m_subMemoryManager(std::move(sub_memory_manager)),
 
       m_memoryStatesRegister(std::make_shared<node::MemoryStatesRegister>()),
-      m_auxiliaryNetworkMemoryControl(std::make_shared<NetworkMemoryControl>()),
+      m_auxiliaryNetworkMemoryControl(std::make_shared<NetworkMemoryControl>(m_config.memorySolver)),
       m_memoryControl(m_auxiliaryNetworkMemoryControl->createMemoryControlUnit("main")) {
     if (m_streamExecutor) {
         m_cpuStreamExecutor = std::dynamic_pointer_cast<ov::threading::CPUStreamsExecutor>(m_streamExecutor);
@@ -65,4 +69,13 @@ const dnnl::engine& GraphContext::getEngine() {
     return eng;
 }
 
+MultiCachePtr GraphContext::createRuntimeCache(const Config& config,
+                                               size_t capacity,
+                                               size_t numShards,
+                                               MultiCachePtr shared) {
+    const auto policy = config.rtCachePolicy == Config::RtCachePolicy::CostAware ? MultiCache::EvictionPolicy::CostAware
+                                                                                 : MultiCache::EvictionPolicy::LRU;
+    return std::make_shared<MultiCache>(capacity, numShards, policy, config.rtCacheByteBudget, std::move(shared));
+}
+
 }  // namespace ov::intel_cpu
@@ -37,7 +37,9 @@ public:
                  bool isGraphQuantized,
                  ov::threading::IStreamsExecutor::Ptr streamExecutor = nullptr,
                  std::shared_ptr<CpuParallel> cpuParallel = nullptr,
-                 std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr);
+                 std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr,
+                 MultiCachePtr rtParamsCache = nullptr,
+                 MultiCachePtr snippetsParamsCache = nullptr);
 
     [[nodiscard]] const Config& getConfig() const {
         return m_config;
@@ -65,6 +67,16 @@ public:
 
     static const dnnl::engine& getEngine();
 
+    /**
+     * @brief Creates a runtime cache with the capacity and eviction policy defined by the config
+     * @param numShards number of shards of a thread safe cache, zero means a single threaded cache
+     * @param shared thread safe cache shared by the streams, which stores the shareable records of the created one
+     */
+    static MultiCachePtr createRuntimeCache(const Config& config,
+                                            size_t capacity,
+                                            size_t numShards = 0,
+                                            MultiCachePtr shared = nullptr);
+
     [[nodiscard]] bool isGraphQuantized() const {
         return m_isGraphQuantizedFlag;
     }
@@ -101,7 +113,16 @@ public:
         m_auxiliaryNetworkMemoryControl->releaseMemory();
     }
 
+    void releaseArena() const {
+        m_auxiliaryNetworkMemoryControl->releaseArena();
+    }
+
     void allocateMemory() const {
+        if (m_auxiliaryNetworkMemoryControl->pooled()) {
+            // all the units are placed into a single arena borrowed from the pool
+            m_auxiliaryNetworkMemoryControl->allocateMemory();
+            return;
+        }
         for (const auto& controlUnit : m_auxiliaryNetworkMemoryControl->controlUnits()) {
             if (!controlUnit->allocated()) {
                 controlUnit->allocateMemory();
@@ -114,7 +135,7 @@ private:
     Config m_config;
     // per NUMA node caches for sharing weights data
     WeightsSharing::Ptr m_weightsCache;
-    // primitive cache
+    // primitive cache of the stream, may store the immutable records in the cache shared by the streams
     MultiCachePtr m_rtParamsCache;
     MultiCachePtr m_snippetsParamsCache;
     // global scratch pad
@@ -5,6 +5,8 @@
 #include "infer_request.h"
 
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <exception>
 #include <functional>
 #include <map>
@@ -79,6 +81,7 @@ void SyncInferRequest::create_infer_request() {
 
     // create states according to the list of the MemoryStateNodes
     m_memory_states = m_compiled_model.graph().memoryStates();
+    m_kv_cache_eviction_state = m_compiled_model.graph().kvCacheEvictionState();
 }
 
 void SyncInferRequest::redefine_memory_for_input_nodes(Graph& graph) {
@@ -92,6 +95,109 @@ void SyncInferRequest::redefine_memory_for_input_nodes(Graph& graph) {
     }
 }
 
+InputShapesRecorder::ShapeSet SyncInferRequest::get_input_shapes() const {
+    InputShapesRecorder::ShapeSet shapes;
+    shapes.reserve(m_input_ports_map.size());
+    // the ports map is unordered, so the shapes are collected in the order of the model inputs
+    for (size_t input_index = 0; input_index < m_input_ports_map.size(); ++input_index) {
+        shapes.push_back(get_tensor_ptr(m_input_ports_map.at(input_index))->get_shape());
+    }
+    return shapes;
+}
+
+void SyncInferRequest::record_input_shapes() {
+    m_compiled_model.record_input_shapes(get_input_shapes());
+}
+
+void SyncInferRequest::pad_inputs_to_shape_bucket(const std::vector<InputShapesRecorder::ShapeSet>& buckets) {
+    const auto shapes = get_input_shapes();
+    const auto* bucket = InputShapesRecorder::findBatchBucket(buckets, shapes);
+    if (!bucket || *bucket == shapes) {
+        return;
+    }
+    // the batch axes of the outputs are found for all the inputs with the dynamic batch sharing the same batch
+    for (size_t input_index = 0; input_index < shapes.size(); ++input_index) {
+        const auto& port_shape = m_input_ports_map.at(input_index).get_partial_shape();
+        if (shapes[input_index] == (*bucket)[input_index] && port_shape.rank().is_static() && port_shape.size() != 0 &&
+            port_shape[0].is_dynamic()) {
+            return;
+        }
+    }
+    for (const auto& input_port : m_input_ports_map) {
+        const auto& tensor = get_tensor_ptr(input_port.second);
+        const auto& precision = tensor->get_element_type();
+        if (precision == element::string || precision.bitwidth() < 8 || !tensor->is_continuous()) {
+            return;
+        }
+    }
+    // the padded outputs are cropped in place, so the outputs set by the application, which may not fit the bucket
+    // batch, and the outputs converted to the model precision are not supported
+    for (const auto& output_port : m_output_ports_map) {
+        if (m_outputControlBlocks.count(output_port.first) == 0) {
+            return;
+        }
+    }
+
+    for (size_t input_index = 0; input_index < shapes.size(); ++input_index) {
+        const auto& bucketShape = (*bucket)[input_index];
+        if (shapes[input_index] == bucketShape) {
+            continue;
+        }
+        auto& tensor = get_tensor_ptr(m_input_ports_map.at(input_index));
+        auto& padded = m_padded_inputs[input_index];
+        if (!padded || padded->get_shape() != bucketShape || padded->get_element_type() != tensor->get_element_type()) {
+            padded = ov::make_tensor(tensor->get_element_type(), bucketShape);
+        }
+        // only the batch is padded, so the user items form the dense prefix of the padded tensor
+        auto* dst = static_cast<uint8_t*>(padded->data());
+        const size_t size = tensor->get_byte_size();
+        if (size != 0) {
+            std::memcpy(dst, tensor->data(), size);
+        }
+        std::memset(dst + size, 0, padded->get_byte_size() - size);
+
+        m_unpadded_batch = shapes[input_index][0];
+        m_padded_batch = bucketShape[0];
+        m_output_batch_axes = &m_compiled_model.padding_output_batch_axes(static_cast<size_t>(bucket - buckets.data()));
+        m_unpadded_inputs.emplace_back(input_index, tensor);
+        tensor = padded;
+        auto external = m_input_external_ptr.find(input_index);
+        if (external != m_input_external_ptr.end()) {
+            external->second = tensor;
+        }
+    }
+}
+
+void SyncInferRequest::crop_outputs_to_batch() {
+    if (m_padded_batch == 0) {
+        return;
+    }
+    for (auto& [output_index, tensor] : m_outputs) {
+        const auto axis = m_output_batch_axes->at(output_index);
+        auto shape = tensor->get_shape();
+        if (shape.size() <= axis || shape[axis] != m_padded_batch) {
+            continue;
+        }
+        // the dimensions before the batch axis are units, so the user items form the dense prefix of the output
+        shape[axis] = m_unpadded_batch;
+        tensor->set_shape(shape);
+    }
+}
+
+void SyncInferRequest::restore_unpadded_inputs() {
+    for (const auto& [input_index, tensor] : m_unpadded_inputs) {
+        get_tensor_ptr(m_input_ports_map.at(input_index)) = tensor;
+        auto external = m_input_external_ptr.find(input_index);
+        if (external != m_input_external_ptr.end()) {
+            external->second = tensor;
+        }
+    }
+    m_unpadded_inputs.clear();
+    m_unpadded_batch = 0;
+    m_padded_batch = 0;
+    m_output_batch_axes = nullptr;
+}
+
 void SyncInferRequest::update_external_tensor_ptrs() {
     // Update it due to batched_tensors case will update input tensor
     for (const auto& input : m_input_ports_map) {
@@ -122,8 +228,34 @@ void SyncInferRequest::infer() {
         update_external_tensor_ptrs();
     }
 
+    // the pooled intermediate memory is returned once the outputs are pulled, even if the inference fails
+    struct PooledMemoryGuard {
+        const Graph& graph;
+        ~PooledMemoryGuard() {
+            const auto& context = graph.getGraphContext();
+            if (context) {
+                context->releaseArena();
+            }
+        }
+    } pooledMemoryGuard{graph};
+
+    // the user tensors are put back even if the inference fails
+    struct UnpaddedInputsGuard {
+        SyncInferRequest& request;
+        ~UnpaddedInputsGuard() {
+            request.restore_unpadded_inputs();
+        }
+    } unpaddedInputsGuard{*this};
+
     if (graph.hasDynamicInput()) {
+        const auto& buckets = m_compiled_model.padding_shape_buckets();
+        if (!buckets.empty()) {
+            pad_inputs_to_shape_bucket(buckets);
+        }
         redefine_memory_for_input_nodes(graph);
+        if (m_compiled_model.records_input_shapes()) {
+            record_input_shapes();
+        }
     }
 
     change_default_ptr(graph);
@@ -134,11 +266,20 @@ void SyncInferRequest::infer() {
     if (!m_memory_states.empty()) {
         graph.assignStates(m_memory_states);
     }
+    if (m_kv_cache_eviction_state) {
+        m_kv_cache_eviction_state->start();
+        graph.assignKVCacheEvictionState(m_kv_cache_eviction_state);
+    }
 
     push_input_data(graph);
 
     graph.Infer(this);
 
+    // all the PagedAttention nodes have accumulated their scores, so the blocks are selected once for all of them
+    if (m_kv_cache_eviction_state) {
+        m_kv_cache_eviction_state->evict();
+    }
+
     throw_if_canceled();
 
     // update output control blocks, if any, in order to refresh internal buffers
@@ -149,6 +290,7 @@ void SyncInferRequest::infer() {
     }
 
     graph.PullOutputData(m_outputs);
+    crop_outputs_to_batch();
 }
 
 std::vector<ov::ProfilingInfo> SyncInferRequest::get_profiling_info() const {
@@ -327,7 +469,11 @@ std::vector<ov::SoPtr<ov::IVariableState>> SyncInferRequest::query_state() const
         }
         return states;
     }
-    return {m_memory_states.begin(), m_memory_states.end()};
+    std::vector<ov::SoPtr<ov::IVariableState>> states{m_memory_states.begin(), m_memory_states.end()};
+    if (m_kv_cache_eviction_state) {
+        states.emplace_back(m_kv_cache_eviction_state);
+    }
+    return states;
 }
 
 void SyncInferRequest::set_async_request(AsyncInferRequest* asyncRequest) {
@@ -8,6 +8,7 @@
 #include <cstddef>
 #include <memory>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "compiled_model.h"
@@ -16,6 +17,7 @@
 #include "cpu_tensor.h"
 #include "graph.h"
 #include "memory_state.h"
+#include "nodes/kernels/scaled_attn/kv_cache_eviction.hpp"
 #include "openvino/core/node.hpp"
 #include "openvino/core/node_output.hpp"
 #include "openvino/core/type/element_type.hpp"
@@ -112,6 +114,11 @@ private:
 
     void push_input_data(Graph& graph);
     void redefine_memory_for_input_nodes(Graph& graph);
+    InputShapesRecorder::ShapeSet get_input_shapes() const;
+    void record_input_shapes();
+    void pad_inputs_to_shape_bucket(const std::vector<InputShapesRecorder::ShapeSet>& buckets);
+    void restore_unpadded_inputs();
+    void crop_outputs_to_batch();
     void update_external_tensor_ptrs();
     void change_default_ptr(Graph& graph);
 
@@ -126,12 +133,22 @@ private:
 
     openvino::itt::handle_t m_profiling_task = nullptr;
     std::vector<MemStatePtr> m_memory_states;
+    std::shared_ptr<ov::Extensions::Cpu::KVCacheEvictionState> m_kv_cache_eviction_state;
     AsyncInferRequest* m_asyncRequest = nullptr;
     CompiledModelHolder m_compiled_model;
 
     std::unordered_map<std::size_t, ov::Output<const ov::Node>> m_input_ports_map;
     std::unordered_map<std::size_t, ov::Output<const ov::Node>> m_output_ports_map;
     std::unordered_map<std::size_t, ov::SoPtr<ov::ITensor>> m_outputs;
+    // user input tensors replaced by the padded ones for the current inference
+    std::vector<std::pair<std::size_t, ov::SoPtr<ov::ITensor>>> m_unpadded_inputs;
+    // padded input tensors reused by the following inferences of the same bucket
+    std::unordered_map<std::size_t, ov::SoPtr<ov::ITensor>> m_padded_inputs;
+    // the user and the bucket batch of the current inference, zero if the inputs are not padded
+    std::size_t m_unpadded_batch = 0;
+    std::size_t m_padded_batch = 0;
+    // the batch axis of every output for the bucket of the current inference
+    const std::vector<std::size_t>* m_output_batch_axes = nullptr;
 };
 
 }  // namespace ov::intel_cpu
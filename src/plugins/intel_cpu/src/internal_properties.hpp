@@ -6,6 +6,7 @@
 
 #include <cstdint>
 #include <istream>
+#include <map>
 #include <ostream>
 #include <string>
 
@@ -20,6 +21,320 @@ namespace ov::intel_cpu {
  */
 static constexpr Property<int32_t, PropertyMutability::RW> cpu_runtime_cache_capacity{"CPU_RUNTIME_CACHE_CAPACITY"};
 
+/**
+ * @brief Defines whether a single thread safe CPU runtime parameters cache is shared by all the streams of a compiled
+ * model. Only the immutable records, e.g. the reorder primitives and the JIT kernels, are shared and their total
+ * number is limited by the capacity, the executors with per-execution state are still kept in a cache per stream.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_runtime_cache_shared{"CPU_RUNTIME_CACHE_SHARED"};
+
+/**
+ * @brief Enum to define the eviction policy of the CPU runtime caches.
+ */
+enum class RuntimeCachePolicy : uint8_t {
+    LRU = 0,         //!<  The least recently used record is evicted first
+    COST_AWARE = 1,  //!<  GreedyDual-Size: the records which are cheap to build and large are evicted first
+};
+
+/** @cond INTERNAL */
+inline std::ostream& operator<<(std::ostream& os, const RuntimeCachePolicy& policy) {
+    switch (policy) {
+    case RuntimeCachePolicy::LRU:
+        return os << "LRU";
+    case RuntimeCachePolicy::COST_AWARE:
+        return os << "COST_AWARE";
+    default:
+        OPENVINO_THROW("Unsupported runtime cache policy value");
+    }
+}
+
+inline std::istream& operator>>(std::istream& is, RuntimeCachePolicy& policy) {
+    std::string str;
+    is >> str;
+    if (str == "LRU") {
+        policy = RuntimeCachePolicy::LRU;
+    } else if (str == "COST_AWARE") {
+        policy = RuntimeCachePolicy::COST_AWARE;
+    } else {
+        OPENVINO_THROW("Unsupported runtime cache policy: ", str);
+    }
+    return is;
+}
+/** @endcond */
+
+/**
+ * @brief Defines the eviction policy of the CPU runtime parameters and snippets caches.
+ * @param LRU - default, records are limited by count only
+ * @param COST_AWARE - the build time per byte of a record defines its priority, the byte budget is applied
+ */
+static constexpr Property<RuntimeCachePolicy, PropertyMutability::RW> cpu_runtime_cache_policy{
+    "CPU_RUNTIME_CACHE_POLICY"};
+
+/**
+ * @brief Defines the maximum total size in bytes of the records of all the key/value types stored in each of the CPU
+ * runtime caches (runtime parameters and snippets) in the COST_AWARE mode, unlike the capacity which limits each type
+ * separately. The snippets kernels are accounted with their real JIT code size, the other records with a fixed
+ * estimate, so the budget bounds the JIT code memory of the cache approximately. When the budget is exhausted, the
+ * record with the lowest rebuild cost per byte of any type is evicted. Zero means that only the per type capacity is
+ * applied.
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> cpu_runtime_cache_byte_budget{
+    "CPU_RUNTIME_CACHE_BYTE_BUDGET"};
+
+/**
+ * @brief Enum to define how the weights of a compiled model are placed on a multi-socket host.
+ */
+enum class WeightsReplicationPolicy : uint8_t {
+    FULL = 0,         //!<  Every socket has its own copy of all the weights
+    INTERLEAVED = 1,  //!<  A single copy of the weights with the memory pages interleaved over the numa nodes
+    HOT = 2,          //!<  An interleaved single copy plus the per-socket replicas of the hottest weights
+};
+
+/** @cond INTERNAL */
+inline std::ostream& operator<<(std::ostream& os, const WeightsReplicationPolicy& policy) {
+    switch (policy) {
+    case WeightsReplicationPolicy::FULL:
+        return os << "FULL";
+    case WeightsReplicationPolicy::INTERLEAVED:
+        return os << "INTERLEAVED";
+    case WeightsReplicationPolicy::HOT:
+        return os << "HOT";
+    default:
+        OPENVINO_THROW("Unsupported weights replication policy value");
+    }
+}
+
+inline std::istream& operator>>(std::istream& is, WeightsReplicationPolicy& policy) {
+    std::string str;
+    is >> str;
+    if (str == "FULL") {
+        policy = WeightsReplicationPolicy::FULL;
+    } else if (str == "INTERLEAVED") {
+        policy = WeightsReplicationPolicy::INTERLEAVED;
+    } else if (str == "HOT") {
+        policy = WeightsReplicationPolicy::HOT;
+    } else {
+        OPENVINO_THROW("Unsupported weights replication policy: ", str);
+    }
+    return is;
+}
+/** @endcond */
+
+/**
+ * @brief Enum to define the strategy of the static partitioning of the intermediate memory.
+ */
+enum class MemorySolverPolicy : uint8_t {
+    GREEDY = 0,       //!<  The largest tensors first, each one is placed above the tensors alive at the same time
+    BEST_FIT = 1,     //!<  Tensors ordered by the size-time area, each one takes the smallest sufficient gap
+    MULTI_ORDER = 2,  //!<  The best of the greedy and several best fit orders, stops at the lower bound
+};
+
+/** @cond INTERNAL */
+inline std::ostream& operator<<(std::ostream& os, const MemorySolverPolicy& policy) {
+    switch (policy) {
+    case MemorySolverPolicy::GREEDY:
+        return os << "GREEDY";
+    case MemorySolverPolicy::BEST_FIT:
+        return os << "BEST_FIT";
+    case MemorySolverPolicy::MULTI_ORDER:
+        return os << "MULTI_ORDER";
+    default:
+        OPENVINO_THROW("Unsupported memory solver policy value");
+    }
+}
+
+inline std::istream& operator>>(std::istream& is, MemorySolverPolicy& policy) {
+    std::string str;
+    is >> str;
+    if (str == "GREEDY") {
+        policy = MemorySolverPolicy::GREEDY;
+    } else if (str == "BEST_FIT") {
+        policy = MemorySolverPolicy::BEST_FIT;
+    } else if (str == "MULTI_ORDER") {
+        policy = MemorySolverPolicy::MULTI_ORDER;
+    } else {
+        OPENVINO_THROW("Unsupported memory solver policy: ", str);
+    }
+    return is;
+}
+/** @endcond */
+
+/**
+ * @brief Defines the strategy of the static partitioning of the intermediate memory of the CPU graphs.
+ * @param GREEDY - default
+ * @param BEST_FIT - best fit by the size-time area
+ * @param MULTI_ORDER - the smallest of several solutions, takes longer to compile
+ */
+static constexpr Property<MemorySolverPolicy, PropertyMutability::RW> cpu_memory_solver{"CPU_MEMORY_SOLVER"};
+
+/**
+ * @brief Defines the weights placement policy on multi-socket hosts. Has no effect on single socket hosts.
+ * @param FULL - default, the weights are replicated to every socket
+ * @param INTERLEAVED - a single copy of the weights is shared by all the sockets
+ * @param HOT - a single copy of the weights plus the replicas of the weights ranked by size x number of consumers
+ * within the cpu_weights_replication_byte_budget
+ */
+static constexpr Property<WeightsReplicationPolicy, PropertyMutability::RW> cpu_weights_replication{
+    "CPU_WEIGHTS_REPLICATION"};
+
+/**
+ * @brief Defines the maximum total size in bytes of the per-socket replicas of the constants in the HOT replication
+ * mode. The weights prepared from a replica for the kernels are placed on its socket on top of the budget.
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> cpu_weights_replication_byte_budget{
+    "CPU_WEIGHTS_REPLICATION_BYTE_BUDGET"};
+
+/**
+ * @brief Defines whether the exported model keeps the weights in the layout prepared for the CPU kernels. A model
+ * imported from a memory mapped blob uses these weights in place instead of repacking the original constants.
+ * Not applied to the encrypted and weightless (OPTIMIZE_SIZE) blobs.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_cache_prepacked_weights{"CPU_CACHE_PREPACKED_WEIGHTS"};
+
+/**
+ * @brief Defines whether the distinct input shapes seen by a dynamic model are recorded, stored in the exported model
+ * and replayed on import, so that the runtime parameters cache is warm before the first user inference.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_runtime_cache_warmup{"CPU_RUNTIME_CACHE_WARMUP"};
+
+/**
+ * @brief Expected input shapes of a dynamic model, one set of shapes of all the model inputs per bucket, e.g.
+ * "[1,128][1,128]|[4,128][4,128]|[8,256][8,256]". The runtime parameters of the buckets are compiled in background
+ * after the model compilation, so the first inferences of these shapes do not pay for the executors creation.
+ */
+static constexpr Property<std::string, PropertyMutability::RW> cpu_shape_buckets{"CPU_SHAPE_BUCKETS"};
+
+/**
+ * @brief Defines whether the batch of the inputs of a dynamic model is zero padded up to the smallest shape bucket (see
+ * cpu_shape_buckets) with the same other dimensions, so the inference reuses the prepared executors of the bucket
+ * instead of creating new ones. The outputs with a dynamic batch are cropped back to the batch of the inputs.
+ * Disabled by default, only the models with independent batch items (no reductions or normalizations across the
+ * batch) produce the same results with the padding. The padding is skipped if an output tensor is set by the
+ * application.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_shape_bucket_padding{"CPU_SHAPE_BUCKET_PADDING"};
+
+/**
+ * @brief Read-only statistics of the CPU runtime parameters caches of a compiled model accumulated over all the
+ * streams: number of "hits", "misses", "evictions" and stored "records".
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> cpu_runtime_cache_statistics{
+    "CPU_RUNTIME_CACHE_STATISTICS"};
+
+/**
+ * @brief Read-only statistics of the shared weights cache of a compiled model accumulated over all the sockets: number
+ * of "lookups", weights "creations" (e.g. repacking), "lock_contentions" and the total "lock_wait_ns" spent waiting
+ * for the contended locks, as well as the size of the per-socket weights replicas in "replica_bytes".
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> cpu_weights_cache_statistics{
+    "CPU_WEIGHTS_CACHE_STATISTICS"};
+
+/**
+ * @brief Priority lane of the CPU streams executor the tasks of an infer request are queued in. Set on a compiled
+ * model, it applies to the infer requests created after it, so the requests of the same compiled model may have
+ * different priorities. The queued tasks of a higher priority overtake the lower priority ones. MEDIUM by default.
+ */
+static constexpr Property<ov::hint::Priority, PropertyMutability::RW> cpu_infer_request_priority{
+    "CPU_INFER_REQUEST_PRIORITY"};
+
+/**
+ * @brief Read-only statistics of the task queue of the CPU streams executor of a compiled model per priority lane,
+ * prefixed with the lane name ("LOW_", "MEDIUM_", "HIGH_"): number of the "enqueued" tasks, the current and the maximum
+ * number of the waiting tasks ("depth", "max_depth"), the total and the maximum waiting time of the started tasks
+ * ("total_wait_ns", "max_wait_ns"). Empty if the compiled model doesn't run on a CPU streams executor.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> cpu_task_queue_statistics{
+    "CPU_TASK_QUEUE_STATISTICS"};
+
+/**
+ * @brief Defines whether the graphs of all the streams share a pool of the intermediate memory arenas. A graph borrows
+ * an arena only while an inference is running, so the idle streams don't keep their arenas allocated.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_memory_arena_pool{"CPU_MEMORY_ARENA_POOL"};
+
+/**
+ * @brief Read-only intermediate memory footprint of a compiled model: the number of allocated "arenas", their total
+ * size in "arena_bytes" and the size per alive infer request in "per_request_bytes".
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> cpu_memory_footprint{
+    "CPU_MEMORY_FOOTPRINT"};
+
+/**
+ * @brief Read-only report of the static partitioning of the intermediate memory of a graph: the size of the partitioned
+ * memory in "arena_bytes", the maximum size of the simultaneously alive tensors in "lower_bound_bytes" and the memory
+ * lost to the fragmentation in "fragmentation_bytes".
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> cpu_memory_solver_report{
+    "CPU_MEMORY_SOLVER_REPORT"};
+
+/**
+ * @brief Enum to define the policy of the KV cache eviction of the PagedAttention operation.
+ */
+enum class KVCacheEvictionPolicy : uint8_t {
+    NONE = 0,            //!<  The cache grows with the sequence
+    H2O = 1,             //!<  The blocks with the highest attention scores accumulated over all the queries are kept
+    SNAPKV = 2,          //!<  The blocks with the highest attention scores of the last queries of the prompt are kept
+    SLIDING_WINDOW = 3,  //!<  The first block and the most recent blocks are kept
+};
+
+/** @cond INTERNAL */
+inline std::ostream& operator<<(std::ostream& os, const KVCacheEvictionPolicy& policy) {
+    switch (policy) {
+    case KVCacheEvictionPolicy::NONE:
+        return os << "NONE";
+    case KVCacheEvictionPolicy::H2O:
+        return os << "H2O";
+    case KVCacheEvictionPolicy::SNAPKV:
+        return os << "SNAPKV";
+    case KVCacheEvictionPolicy::SLIDING_WINDOW:
+        return os << "SLIDING_WINDOW";
+    default:
+        OPENVINO_THROW("Unsupported KV cache eviction policy value");
+    }
+}
+
+inline std::istream& operator>>(std::istream& is, KVCacheEvictionPolicy& policy) {
+    std::string str;
+    is >> str;
+    if (str == "NONE") {
+        policy = KVCacheEvictionPolicy::NONE;
+    } else if (str == "H2O") {
+        policy = KVCacheEvictionPolicy::H2O;
+    } else if (str == "SNAPKV") {
+        policy = KVCacheEvictionPolicy::SNAPKV;
+    } else if (str == "SLIDING_WINDOW") {
+        policy = KVCacheEvictionPolicy::SLIDING_WINDOW;
+    } else {
+        OPENVINO_THROW("Unsupported KV cache eviction policy: ", str);
+    }
+    return is;
+}
+/** @endcond */
+
+/**
+ * @brief Defines the built-in KV cache eviction policy of the PagedAttention operation. The whole blocks are selected
+ * for eviction once a sequence exceeds cpu_kv_cache_eviction_budget, the cache itself is never written. The
+ * application exchanges the data through the "kv_cache_eviction" variable state of the infer request: before every
+ * inference it sets an i64 tensor [B_seq] with the ids of the scheduled sequences (a sequence missing from it is
+ * finished), after the inference the state holds an i64 tensor [N, 2] of the (sequence id, block index) pairs of the
+ * evicted blocks, which the application removes from the block tables and the past lengths and frees.
+ * @note Not applied to the operations which scores output is consumed, to the models with ALiBi or sliding window
+ * attention and when the cache rotation inputs are set.
+ * @param NONE - default
+ * @param H2O - heavy hitters by the accumulated attention scores
+ * @param SNAPKV - heavy hitters by the attention scores of the prompt observation window
+ * @param SLIDING_WINDOW - the first block and the most recent blocks
+ */
+static constexpr Property<KVCacheEvictionPolicy, PropertyMutability::RW> cpu_kv_cache_eviction{
+    "CPU_KV_CACHE_EVICTION"};
+
+/**
+ * @brief Defines the maximum number of the cached tokens of a sequence for cpu_kv_cache_eviction, rounded up to the
+ * cache blocks. 0 - default, no eviction.
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> cpu_kv_cache_eviction_budget{
+    "CPU_KV_CACHE_EVICTION_BUDGET"};
+
 /**
  * @brief Enum to define possible snippets mode hints.
  */
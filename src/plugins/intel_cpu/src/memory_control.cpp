@@ -9,6 +9,7 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <numeric>
 #include <queue>
 #include <string>
@@ -18,7 +19,9 @@
 #include <utility>
 #include <vector>
 
+#include "config.h"
 #include "cpu_memory.h"
+#include "memory_solvers.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/runtime/memory_solver.hpp"
 #include "utils/debug_capabilities.h"
@@ -147,6 +150,9 @@ private:
 };
 #endif  // CPU_DEBUG_CAPS
 
+// the alignment of the units placed into a shared arena
+constexpr size_t arenaAlignment = 64;
+
 class IMemoryManager {
 public:
     virtual ~IMemoryManager() = default;
@@ -154,6 +160,20 @@ public:
     virtual const MemoryControl::MemorySolution& lastSolution() = 0;
     virtual void allocate() = 0;
     virtual void release() = 0;
+    // the size of the memory which may be placed into an external arena
+    [[nodiscard]] virtual size_t arenaSize() const {
+        return 0;
+    }
+    // the lower bound of the arena size
+    [[nodiscard]] virtual size_t lowerBound() const {
+        return 0;
+    }
+    virtual void allocateInArena([[maybe_unused]] void* arena) {
+        allocate();
+    }
+    virtual void releaseArena() {
+        // nothing to do
+    }
 };
 
 using MemoryManagerPtr = std::shared_ptr<IMemoryManager>;
@@ -201,6 +221,8 @@ private:
 
 class MemoryManagerStatic : public IMemoryManager {
 public:
+    explicit MemoryManagerStatic(Config::MemorySolverType solverType) : m_solverType(solverType) {}
+
     void insert(const MemoryRegion& reg, [[maybe_unused]] const std::vector<size_t>& syncInds) override {
         OPENVINO_ASSERT(reg.size >= 0, getClassName(), ": got undefined block size");
         m_boxes.emplace_back(MemorySolver::Box{reg.start, reg.finish, reg.size, reg.id});
@@ -223,13 +245,15 @@ private:
             box.size = div_up(box.size, alignment);
         });
 
-        ov::MemorySolver staticMemSolver(boxes_to_process);
-        m_totalSize = static_cast<size_t>(staticMemSolver.solve()) * alignment;
+        IMemorySolver::Offsets offsets;
+        const auto solver = createMemorySolver(m_solverType);
+        m_totalSize = static_cast<size_t>(solver->solve(boxes_to_process, offsets)) * alignment;
+        m_lowerBound = static_cast<size_t>(memoryLowerBound(boxes_to_process)) * alignment;
 
         m_workspace = std::make_shared<MemoryBlockWithRelease>();
 
         for (const auto& box : boxes_to_process) {
-            int64_t offset = staticMemSolver.get_offset(static_cast<int>(box.id));
+            int64_t offset = offsets.at(box.id);
             auto memoryBlock = std::make_shared<StaticPartitionMemoryBlock>(m_workspace, offset * alignment);
             m_blocks[box.id] = std::move(memoryBlock);
         }
@@ -245,15 +269,32 @@ private:
             m_workspace->free();
         }
     }
+    [[nodiscard]] size_t arenaSize() const override {
+        return m_workspace ? m_totalSize : 0;
+    }
+    [[nodiscard]] size_t lowerBound() const override {
+        return m_workspace ? m_lowerBound : 0;
+    }
+    void allocateInArena(void* arena) override {
+        if (m_workspace) {
+            m_workspace->setExtBuff(arena, m_totalSize);
+        }
+    }
+    void releaseArena() override {
+        release();
+    }
 
     static const char* getClassName() {
         return "MemoryManagerStatic";
     }
 
+    Config::MemorySolverType m_solverType;
     MemoryControl::MemorySolution m_blocks;
     std::vector<MemorySolver::Box> m_boxes;
     std::shared_ptr<MemoryBlockWithRelease> m_workspace;
     size_t m_totalSize = 0;
+    // the maximum size of the simultaneously alive boxes
+    size_t m_lowerBound = 0;
     bool reset_flag = true;
     CPU_DEBUG_CAP_ENABLE(friend MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerStatic& obj);)
 };
@@ -479,6 +520,22 @@ public:
         m_memManager->release();
     }
 
+    [[nodiscard]] size_t arenaSize() const {
+        return m_memManager->arenaSize();
+    }
+
+    [[nodiscard]] size_t lowerBound() const {
+        return m_memManager->lowerBound();
+    }
+
+    void allocateInArena(void* arena) {
+        m_memManager->allocateInArena(arena);
+    }
+
+    void releaseArena() {
+        m_memManager->releaseArena();
+    }
+
 #ifdef CPU_DEBUG_CAPS
     [[nodiscard]] MemoryStatisticsRecord dumpStatistics() const {
         return m_statDumper(m_memManager);
@@ -517,12 +574,14 @@ MemoryControl::RegionHandlerPtr buildHandler(F&& f, Args&&... args) {
 
 }  // namespace
 
-MemoryControl::MemoryControl(std::string id) : m_id(std::move(id)) {
+MemoryControl::MemoryControl(std::string id, Config::MemorySolverType solverType) : m_id(std::move(id)) {
     // init handlers
-    m_handlers.emplace_back(buildHandler<MemoryManagerStatic>([](const MemoryRegion& reg) {
-        return reg.size >= 0 && MemoryRegion::RegionType::VARIABLE == reg.type &&
-               MemoryRegion::AllocType::POD == reg.alloc_type;
-    }));
+    m_handlers.emplace_back(buildHandler<MemoryManagerStatic>(
+        [](const MemoryRegion& reg) {
+            return reg.size >= 0 && MemoryRegion::RegionType::VARIABLE == reg.type &&
+                   MemoryRegion::AllocType::POD == reg.alloc_type;
+        },
+        solverType));
 
     // handler for static tensors
     m_handlers.emplace_back(buildHandler<MemoryManagerNonOverlappingSets>([](const MemoryRegion& reg) {
@@ -579,6 +638,37 @@ void MemoryControl::releaseMemory() {
     m_allocated = false;
 }
 
+size_t MemoryControl::arenaSize() const {
+    size_t size = 0;
+    for (auto&& handler : m_handlers) {
+        size += rnd_up(handler->arenaSize(), arenaAlignment);
+    }
+    return size;
+}
+
+size_t MemoryControl::arenaLowerBound() const {
+    size_t size = 0;
+    for (auto&& handler : m_handlers) {
+        size += handler->lowerBound();
+    }
+    return size;
+}
+
+void MemoryControl::allocateMemory(uint8_t* arena) {
+    for (auto&& handler : m_handlers) {
+        handler->allocateInArena(arena);
+        arena += rnd_up(handler->arenaSize(), arenaAlignment);
+    }
+    m_allocated = true;
+}
+
+void MemoryControl::releaseArena() {
+    for (auto&& handler : m_handlers) {
+        handler->releaseArena();
+    }
+    m_allocated = false;
+}
+
 #ifdef CPU_DEBUG_CAPS
 MemoryStatistics MemoryControl::dumpStatistics() const {
     MemoryStatistics profileData;
@@ -590,20 +680,135 @@ MemoryStatistics MemoryControl::dumpStatistics() const {
 #endif  // CPU_DEBUG_CAPS
 
 MemoryControl::Ptr NetworkMemoryControl::createMemoryControlUnit(std::string id) {
-    m_controlUnits.emplace_back(std::shared_ptr<MemoryControl>(new MemoryControl(std::move(id))));
+    m_controlUnits.emplace_back(std::shared_ptr<MemoryControl>(new MemoryControl(std::move(id), m_solverType)));
     return m_controlUnits.back();
 }
 
 void NetworkMemoryControl::allocateMemory() {
+    if (!m_arenaPool) {
+        for (auto&& item : m_controlUnits) {
+            item->allocateMemory();
+        }
+        return;
+    }
+    if (m_borrowed) {
+        return;
+    }
+    m_arena = m_arenaPool->acquire(arenaSize());
+    auto* arena = static_cast<uint8_t*>(m_arena->getRawPtr());
     for (auto&& item : m_controlUnits) {
-        item->allocateMemory();
+        const auto size = item->arenaSize();
+        item->allocateMemory(arena);
+        arena += size;
     }
+    m_borrowed = true;
 }
 
 void NetworkMemoryControl::releaseMemory() {
     for (auto&& item : m_controlUnits) {
         item->releaseMemory();
     }
+    if (m_borrowed) {
+        m_arenaPool->release(std::move(m_arena));
+        m_borrowed = false;
+    }
+}
+
+void NetworkMemoryControl::releaseArena() {
+    if (!m_borrowed) {
+        return;
+    }
+    for (auto&& item : m_controlUnits) {
+        item->releaseArena();
+    }
+    m_arenaPool->release(std::move(m_arena));
+    m_borrowed = false;
+}
+
+size_t NetworkMemoryControl::arenaSize() const {
+    size_t size = 0;
+    for (auto&& item : m_controlUnits) {
+        size += item->arenaSize();
+    }
+    return size;
+}
+
+size_t NetworkMemoryControl::arenaLowerBound() const {
+    size_t size = 0;
+    for (auto&& item : m_controlUnits) {
+        size += item->arenaLowerBound();
+    }
+    return size;
+}
+
+MemoryArenaPool::ArenaPtr MemoryArenaPool::acquire(size_t size) {
+    ArenaPtr arena;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_idle.empty()) {
+            // the smallest sufficient arena, otherwise the largest one is grown
+            auto best = m_idle.begin();
+            for (auto it = m_idle.begin(); it != m_idle.end(); ++it) {
+                const bool fits = (*it)->size() >= size;
+                const bool bestFits = (*best)->size() >= size;
+                if ((fits && (!bestFits || (*it)->size() < (*best)->size())) ||
+                    (!fits && !bestFits && (*it)->size() > (*best)->size())) {
+                    best = it;
+                }
+            }
+            arena = std::move(*best);
+            m_idle.erase(best);
+        } else {
+            arena = std::make_unique<MemoryBlockWithReuse>();
+            m_arenas++;
+        }
+    }
+    const auto oldSize = arena->size();
+    if (size > oldSize) {
+        try {
+            arena->resize(size);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_footprint -= oldSize;
+            m_arenas--;
+            throw;
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_footprint += arena->size() - oldSize;
+    }
+    return arena;
+}
+
+void MemoryArenaPool::release(ArenaPtr arena) {
+    if (!arena) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_idle.size() < m_capacity) {
+        m_idle.push_back(std::move(arena));
+        return;
+    }
+    m_footprint -= arena->size();
+    m_arenas--;
+}
+
+void MemoryArenaPool::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto&& arena : m_idle) {
+        m_footprint -= arena->size();
+    }
+    m_arenas -= m_idle.size();
+    m_idle.clear();
+}
+
+size_t MemoryArenaPool::footprint() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_footprint;
+}
+
+size_t MemoryArenaPool::arenas() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_arenas;
 }
 
 std::vector<std::pair<std::string, MemoryStatistics>> NetworkMemoryControl::dumpStatistics() const {
@@ -7,11 +7,13 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "config.h"
 #include "cpu_memory.h"
 #include "edge.h"
 
@@ -62,12 +64,29 @@ public:
     void allocateMemory();
     void releaseMemory();
 
+    /**
+     * @return the size of the memory the unit is able to place into an external arena
+     */
+    [[nodiscard]] size_t arenaSize() const;
+    /**
+     * @return the maximum size of the simultaneously alive static partitions, the lower bound of arenaSize()
+     */
+    [[nodiscard]] size_t arenaLowerBound() const;
+    /**
+     * @brief Allocates the memory placing the static partitions into the arena of at least arenaSize() bytes
+     */
+    void allocateMemory(uint8_t* arena);
+    /**
+     * @brief Releases only the memory placed into the external arena
+     */
+    void releaseArena();
+
     [[nodiscard]] const std::string& getId() const {
         return m_id;
     }
 
 private:
-    explicit MemoryControl(std::string id);
+    MemoryControl(std::string id, Config::MemorySolverType solverType);
     void insert(const MemoryRegion& region, const std::vector<size_t>& syncInds);
     [[nodiscard]] MemoryStatistics dumpStatistics() const;
 
@@ -78,13 +97,82 @@ private:
     bool m_allocated = false;
 };
 
+/**
+ * Pool of the intermediate memory arenas shared by the graphs of a compiled model. A graph borrows an arena only
+ * for the inference time, so the number of allocated arenas follows the number of concurrent inferences rather than
+ * the number of graphs.
+ *
+ * Is a thread safe
+ */
+class MemoryArenaPool {
+public:
+    using Ptr = std::shared_ptr<MemoryArenaPool>;
+    using ArenaPtr = std::unique_ptr<MemoryBlockWithReuse>;
+
+    /**
+     * @param capacity maximum number of idle arenas kept by the pool, the extra returned arenas are freed
+     */
+    explicit MemoryArenaPool(size_t capacity) : m_capacity(capacity) {}
+
+    /**
+     * @brief Borrows an idle arena (allocates a new one if there are no idle arenas) of at least size bytes
+     */
+    ArenaPtr acquire(size_t size);
+    void release(ArenaPtr arena);
+    /**
+     * @brief Frees the idle arenas
+     */
+    void clear();
+
+    /**
+     * @return the total size of the borrowed and idle arenas
+     */
+    [[nodiscard]] size_t footprint() const;
+    [[nodiscard]] size_t arenas() const;
+
+private:
+    size_t m_capacity;
+    mutable std::mutex m_mutex;
+    std::vector<ArenaPtr> m_idle;
+    size_t m_footprint = 0;
+    size_t m_arenas = 0;
+};
+
 class NetworkMemoryControl {
 public:
-    NetworkMemoryControl() = default;
+    /**
+     * @param solverType the strategy of the static memory partitioning of the units
+     */
+    explicit NetworkMemoryControl(Config::MemorySolverType solverType = Config::MemorySolverType::Greedy)
+        : m_solverType(solverType) {}
     MemoryControl::Ptr createMemoryControlUnit(std::string id);
 
+    /**
+     * @brief In the pooled mode all the units are placed into a single arena borrowed from the pool by
+     * allocateMemory() and returned to the pool by releaseMemory()
+     */
+    void setArenaPool(MemoryArenaPool::Ptr pool) {
+        m_arenaPool = std::move(pool);
+    }
+    [[nodiscard]] bool pooled() const {
+        return m_arenaPool != nullptr;
+    }
+
     void allocateMemory();
     void releaseMemory();
+    /**
+     * @brief Returns the borrowed arena to the pool keeping the rest of the memory allocated
+     */
+    void releaseArena();
+
+    /**
+     * @return the total size of the static partitions of all the units
+     */
+    [[nodiscard]] size_t arenaSize() const;
+    /**
+     * @return the sum of the lower bounds of the static partitions of all the units
+     */
+    [[nodiscard]] size_t arenaLowerBound() const;
 
     [[nodiscard]] std::vector<std::pair<std::string, MemoryStatistics>> dumpStatistics() const;
 
@@ -93,7 +181,12 @@ public:
     }
 
 private:
+    Config::MemorySolverType m_solverType;
     std::vector<MemoryControl::Ptr> m_controlUnits;
+    MemoryArenaPool::Ptr m_arenaPool;
+    // the arena borrowed from the pool
+    MemoryArenaPool::ArenaPtr m_arena;
+    bool m_borrowed = false;
 };
 
 }  // namespace ov::intel_cpu
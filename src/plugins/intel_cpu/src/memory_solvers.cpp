@@ -0,0 +1,230 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "memory_solvers.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include "config.h"
+#include "openvino/core/except.hpp"
+#include "openvino/runtime/memory_solver.hpp"
+
+namespace ov::intel_cpu {
+
+namespace {
+
+using Box = ov::MemorySolver::Box;
+using BoxOrder = std::function<bool(const Box&, const Box&)>;
+
+int64_t lifetime(const Box& box) {
+    return static_cast<int64_t>(box.finish) - box.start + 1;
+}
+
+// the extra best fit orders of the multi order solver are tried for the graphs up to this number of boxes
+constexpr size_t maxMultiOrderBoxes = 4096;
+
+using Overlaps = std::vector<std::vector<size_t>>;
+
+/**
+ * Sweeps over the lifetimes of the boxes and collects the indices of the boxes overlapping in time with every box.
+ * The cost is proportional to the number of the overlapping pairs instead of the square of the number of boxes.
+ */
+Overlaps findOverlaps(const std::vector<Box>& boxes) {
+    std::vector<size_t> byStart(boxes.size());
+    std::iota(byStart.begin(), byStart.end(), 0);
+    std::stable_sort(byStart.begin(), byStart.end(), [&boxes](size_t l, size_t r) {
+        return boxes[l].start < boxes[r].start;
+    });
+
+    Overlaps overlaps(boxes.size());
+    std::vector<size_t> alive;
+    for (const auto index : byStart) {
+        const auto& box = boxes[index];
+        alive.erase(std::remove_if(alive.begin(),
+                                   alive.end(),
+                                   [&](size_t other) {
+                                       return boxes[other].finish < box.start;
+                                   }),
+                    alive.end());
+        for (const auto other : alive) {
+            overlaps[other].push_back(index);
+            overlaps[index].push_back(other);
+        }
+        alive.push_back(index);
+    }
+    return overlaps;
+}
+
+/**
+ * Places the boxes in the given order. Every box takes the smallest gap it fits in between the already placed boxes
+ * overlapping with it in time, or is put on top of them.
+ */
+int64_t placeBestFit(const std::vector<Box>& boxes,
+                     const Overlaps& overlaps,
+                     const BoxOrder& order,
+                     IMemorySolver::Offsets& offsets) {
+    std::vector<size_t> sorted(boxes.size());
+    std::iota(sorted.begin(), sorted.end(), 0);
+    std::stable_sort(sorted.begin(), sorted.end(), [&](size_t l, size_t r) {
+        return order(boxes[l], boxes[r]);
+    });
+
+    constexpr int64_t notPlaced = -1;
+    std::vector<int64_t> begins(boxes.size(), notPlaced);
+    std::vector<std::pair<int64_t, int64_t>> busy;
+    int64_t total = 0;
+
+    for (const auto index : sorted) {
+        const auto& box = boxes[index];
+        busy.clear();
+        for (const auto other : overlaps[index]) {
+            if (begins[other] != notPlaced) {
+                busy.emplace_back(begins[other], begins[other] + boxes[other].size);
+            }
+        }
+        std::sort(busy.begin(), busy.end());
+
+        int64_t offset = -1;
+        int64_t bestGap = std::numeric_limits<int64_t>::max();
+        int64_t top = 0;
+        for (const auto& [begin, end] : busy) {
+            const auto gap = begin - top;
+            if (gap >= box.size && gap > 0 && gap < bestGap) {
+                bestGap = gap;
+                offset = top;
+            }
+            top = std::max(top, end);
+        }
+        if (offset < 0) {
+            offset = top;
+        }
+
+        offsets[box.id] = offset;
+        begins[index] = offset;
+        total = std::max(total, offset + box.size);
+    }
+    return total;
+}
+
+bool bySize(const Box& l, const Box& r) {
+    return l.size > r.size;
+}
+
+bool byArea(const Box& l, const Box& r) {
+    const auto lArea = l.size * lifetime(l);
+    const auto rArea = r.size * lifetime(r);
+    return lArea > rArea || (lArea == rArea && l.size > r.size);
+}
+
+bool byLifetime(const Box& l, const Box& r) {
+    return lifetime(l) > lifetime(r) || (lifetime(l) == lifetime(r) && l.size > r.size);
+}
+
+bool byStart(const Box& l, const Box& r) {
+    return l.start < r.start || (l.start == r.start && l.size > r.size);
+}
+
+// the original greedy heuristic: the largest boxes first, each one is lifted above the intersecting ones
+class GreedyMemorySolver : public IMemorySolver {
+public:
+    int64_t solve(const std::vector<Box>& boxes, Offsets& offsets) const override {
+        ov::MemorySolver solver(boxes);
+        const auto total = solver.solve();
+        for (const auto& box : boxes) {
+            offsets[box.id] = solver.get_offset(static_cast<int>(box.id));
+        }
+        return total;
+    }
+};
+
+// best fit of the boxes ordered by the size-time area
+class BestFitMemorySolver : public IMemorySolver {
+public:
+    int64_t solve(const std::vector<Box>& boxes, Offsets& offsets) const override {
+        auto normalized = boxes;
+        ov::MemorySolver::normalize_boxes(normalized);
+        return placeBestFit(normalized, findOverlaps(normalized), byArea, offsets);
+    }
+};
+
+// the best of the greedy solution and the best fit solutions of several box orders, stops at the lower bound.
+// The large graphs only try the size-time area order
+class MultiOrderMemorySolver : public IMemorySolver {
+public:
+    int64_t solve(const std::vector<Box>& boxes, Offsets& offsets) const override {
+        auto total = GreedyMemorySolver().solve(boxes, offsets);
+        auto normalized = boxes;
+        ov::MemorySolver::normalize_boxes(normalized);
+        const auto lowerBound = memoryLowerBound(normalized);
+        if (total <= lowerBound) {
+            return total;
+        }
+
+        // the overlaps do not depend on the order, so they are shared by all the attempts
+        const auto overlaps = findOverlaps(normalized);
+        std::vector<BoxOrder> orders{byArea};
+        if (normalized.size() <= maxMultiOrderBoxes) {
+            orders.insert(orders.end(), {bySize, byLifetime, byStart});
+        }
+        for (const auto& order : orders) {
+            if (total <= lowerBound) {
+                break;
+            }
+            Offsets candidate;
+            const auto candidateTotal = placeBestFit(normalized, overlaps, order, candidate);
+            if (candidateTotal < total) {
+                total = candidateTotal;
+                offsets = std::move(candidate);
+            }
+        }
+        return total;
+    }
+};
+
+}  // namespace
+
+IMemorySolver::Ptr createMemorySolver(Config::MemorySolverType type) {
+    switch (type) {
+    case Config::MemorySolverType::Greedy:
+        return std::make_unique<GreedyMemorySolver>();
+    case Config::MemorySolverType::BestFit:
+        return std::make_unique<BestFitMemorySolver>();
+    case Config::MemorySolverType::MultiOrder:
+        return std::make_unique<MultiOrderMemorySolver>();
+    default:
+        OPENVINO_THROW("Unsupported memory solver type");
+    }
+}
+
+int64_t memoryLowerBound(std::vector<Box> boxes) {
+    ov::MemorySolver::normalize_boxes(boxes);
+
+    auto finishCmp = [](const Box& l, const Box& r) {
+        return l.finish > r.finish;
+    };
+    std::priority_queue<Box, std::vector<Box>, decltype(finishCmp)> alive(finishCmp);
+
+    int64_t current = 0;
+    int64_t maxCurrent = 0;
+    for (const auto& box : boxes) {
+        while (!alive.empty() && alive.top().finish < box.start) {
+            current -= alive.top().size;
+            alive.pop();
+        }
+        current += box.size;
+        alive.push(box);
+        maxCurrent = std::max(maxCurrent, current);
+    }
+    return maxCurrent;
+}
+
+}  // namespace ov::intel_cpu
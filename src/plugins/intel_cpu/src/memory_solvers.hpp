@@ -0,0 +1,46 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "config.h"
+#include "openvino/runtime/memory_solver.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * Strategy of the static memory partitioning: assigns the offsets to the boxes, so the boxes overlapping in time do
+ * not overlap in memory.
+ */
+class IMemorySolver {
+public:
+    using Ptr = std::unique_ptr<IMemorySolver>;
+    using Offsets = std::unordered_map<int64_t, int64_t>;
+
+    virtual ~IMemorySolver() = default;
+
+    /**
+     * @param boxes the boxes to place, the ids must be unique
+     * @param offsets the calculated offset of every box by its id
+     * @return the size of the memory required to store all the boxes
+     */
+    virtual int64_t solve(const std::vector<ov::MemorySolver::Box>& boxes, Offsets& offsets) const = 0;
+};
+
+/**
+ * @brief Creates the solver of the given type
+ */
+IMemorySolver::Ptr createMemorySolver(Config::MemorySolverType type);
+
+/**
+ * @return the maximum total size of the boxes alive at the same time, the lower bound of the solution size
+ */
+int64_t memoryLowerBound(std::vector<ov::MemorySolver::Box> boxes);
+
+}  // namespace ov::intel_cpu
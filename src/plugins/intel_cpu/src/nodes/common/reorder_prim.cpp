@@ -16,6 +16,8 @@
 namespace ov::intel_cpu {
 
 struct ReorderKey {
+    // the reorder primitives are immutable, so they are shared by the streams
+    static constexpr bool shareable = true;
     dnnl::memory::desc src;
     dnnl::memory::desc dest;
     [[nodiscard]] size_t hash() const;
@@ -45,6 +45,12 @@ public:
         return schedule;
     }
 
+    // the size of the generated JIT code, the runtime cache accounts it in its byte budget
+    [[nodiscard]] size_t get_code_size() const {
+        const auto& compiled_snippet = schedule->lowering_result.compiled_snippet;
+        return compiled_snippet ? compiled_snippet->get_code_size() : 0;
+    }
+
 private:
     std::shared_ptr<snippets::Schedule> schedule;
 };
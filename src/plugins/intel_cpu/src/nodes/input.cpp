@@ -583,10 +583,12 @@ void Input::cloneBlobIfRequired() {
         // original weights are stored.
         (!weightCache || context->getNumNumaNodes() == 1 || context->getCPUStreamExecutor()->get_streams_num() == 1);
 
+    const auto* constData = m_constOp->get_data_ptr();
     memoryPtr = clone_is_not_needed
-                    ? std::make_shared<Memory>(getEngine(), memDesc, m_constOp->get_data_ptr())
+                    ? std::make_shared<Memory>(getEngine(), memDesc, constData)
                     : std::const_pointer_cast<const IMemory>(
-                          weightCache ? MemoryPtr(*weightCache->findOrCreate(blobKey(), cloneBlob)) : cloneBlob());
+                          weightCache ? MemoryPtr(*weightCache->findOrCreate(blobKey(), cloneBlob, true, constData))
+                                      : cloneBlob());
 }
 
 static std::vector<Shape> createInputShapes(const Shape& shape, const Type type) {
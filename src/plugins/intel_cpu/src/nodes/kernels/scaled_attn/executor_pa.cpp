@@ -27,6 +27,7 @@
 #include "cache_rotation.hpp"
 #include "executor_pa.hpp"
 #include "executor_pa_common.hpp"
+#include "kv_cache_eviction.hpp"
 #include "nodes/kernels/scaled_attn/common.hpp"
 #include "openvino/core/parallel.hpp"
 #include "openvino/core/type/bfloat16.hpp"
@@ -1847,6 +1848,9 @@ struct AttentionExecutor : public PagedAttentionExecutor {
     MHAHelper<DATA_TYPE, KEY_PREC, VALUE_PREC> _helper;
     MHA<DATA_TYPE, KEY_PREC, VALUE_PREC> _kernel;
     PlainTensor _slot_mapping;
+    // the scores and their aggregation windows used to rank the tokens for the built-in eviction
+    PlainTensor _eviction_scores;
+    PlainTensor _eviction_score_window;
 
     AttentionExecutor() : _kernel(_helper) {}
 
@@ -2138,7 +2142,9 @@ struct AttentionExecutor : public PagedAttentionExecutor {
         }
     }
 
-    void execute(const std::vector<MemoryPtr>& inputs, const std::vector<MemoryPtr> outputs) override {
+    void execute(const std::vector<MemoryPtr>& inputs,
+                 const std::vector<MemoryPtr> outputs,
+                 const std::shared_ptr<KVCacheEvictionState>& eviction) override {
         PlainTensor q;
         PlainTensor k;
         PlainTensor v;
@@ -2204,6 +2210,20 @@ struct AttentionExecutor : public PagedAttentionExecutor {
                                       _helper._block_rotation_coefficient_scratch);
         }
 
+        // the built-in eviction is not combined with the eviction driven by the caller, which consumes the scores and
+        // rotates the cache, and with the masks depending on the token positions
+        const bool evict = eviction && eviction->enabled() && !output_score && !rotated_block_indices &&
+                           !alibi_slopes && sliding_window == 0;
+        if (evict) {
+            prepare_eviction(*eviction,
+                             past_lens,
+                             subsequence_begins,
+                             block_indices,
+                             block_indices_begins,
+                             output_score,
+                             score_aggregation_window);
+        }
+
         concat_pastkv(k, v, k_cache, v_cache, past_lens, subsequence_begins, block_indices, block_indices_begins);
 
         _kernel(q,
@@ -2218,6 +2238,58 @@ struct AttentionExecutor : public PagedAttentionExecutor {
                 block_indices_begins,
                 alibi_slopes,
                 score_aggregation_window);
+
+        if (evict && output_score) {
+            accumulate_eviction_scores(*eviction, past_lens, subsequence_begins, output_score);
+        }
+    }
+
+    // binds the subsequences to the sequences of the eviction state, requests the scores to rank the tokens
+    void prepare_eviction(KVCacheEvictionState& eviction,
+                          const PlainTensor& past_lens,
+                          const PlainTensor& subsequence_begins,
+                          const PlainTensor& block_indices,
+                          const PlainTensor& block_indices_begins,
+                          PlainTensor& output_score,
+                          PlainTensor& score_aggregation_window) {
+        auto B_seq = past_lens.size(0);
+        const auto& windows = eviction.bind(past_lens.ptr<int32_t>(),
+                                            subsequence_begins.ptr<int32_t>(),
+                                            block_indices.ptr<int32_t>(),
+                                            block_indices_begins.ptr<int32_t>(),
+                                            B_seq,
+                                            _helper._block_size);
+        if (std::all_of(windows.begin(), windows.end(), [](int32_t window) {
+                return window == 0;
+            })) {
+            return;
+        }
+        _eviction_score_window.resize<int32_t>({B_seq});
+        std::copy(windows.begin(), windows.end(), _eviction_score_window.ptr<int32_t>());
+        size_t total_kv_len = 0;
+        for (size_t i = 0; i < B_seq; i++) {
+            total_kv_len += past_lens.ptr<int32_t>()[i] + subsequence_begins.ptr<int32_t>()[i + 1] -
+                            subsequence_begins.ptr<int32_t>()[i];
+        }
+        _eviction_scores.resize<float>({total_kv_len});
+        output_score = _eviction_scores;
+        score_aggregation_window = _eviction_score_window;
+    }
+
+    // adds the scores of this operation to the scores of the sequences, the blocks are selected after the inference
+    static void accumulate_eviction_scores(KVCacheEvictionState& eviction,
+                                           const PlainTensor& past_lens,
+                                           const PlainTensor& subsequence_begins,
+                                           const PlainTensor& output_score) {
+        auto B_seq = past_lens.size(0);
+        std::vector<size_t> score_offsets(B_seq + 1, 0);
+        for (size_t i = 0; i < B_seq; i++) {
+            auto q_len = subsequence_begins.ptr<int32_t>()[i + 1] - subsequence_begins.ptr<int32_t>()[i];
+            score_offsets[i + 1] = score_offsets[i] + past_lens.ptr<int32_t>()[i] + q_len;
+        }
+        parallel_for(B_seq, [&](size_t i) {
+            eviction.accumulate(i, output_score.ptr<float>() + score_offsets[i]);
+        });
     }
 };
 #endif
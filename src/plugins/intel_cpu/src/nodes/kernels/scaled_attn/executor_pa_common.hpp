@@ -7,6 +7,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <openvino/core/type/element_type.hpp>
 #include <utility>
 #include <vector>
@@ -19,6 +20,8 @@ namespace ov::Extensions::Cpu {
 
 // this file will contain features that do not require multiple instantiation
 
+class KVCacheEvictionState;
+
 struct PagedAttentionExecutor {
     // PagedAttention input index
     static const size_t ID_Q = 0;                          // [B_token, H * S], float
@@ -42,8 +45,10 @@ struct PagedAttentionExecutor {
     static const size_t ID_XATTENTION_BLOCK_SIZE = 18;     // [], int32
     static const size_t ID_XATTENTION_STRIDE = 19;         // [], int32
     static const size_t ID_SINKS = 20;                     // [1, H, 1, 1], float
+    // eviction is the built-in KV cache eviction state of the infer request, nullptr if the eviction is disabled
     virtual void execute(const std::vector<ov::intel_cpu::MemoryPtr>& inputs,
-                         std::vector<ov::intel_cpu::MemoryPtr> outputs) = 0;
+                         std::vector<ov::intel_cpu::MemoryPtr> outputs,
+                         const std::shared_ptr<KVCacheEvictionState>& eviction) = 0;
     virtual ~PagedAttentionExecutor() = default;
 };
 
@@ -0,0 +1,199 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include "kv_cache_eviction.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/core/shape.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/runtime/itensor.hpp"
+#include "openvino/runtime/make_tensor.hpp"
+#include "openvino/runtime/so_ptr.hpp"
+
+namespace ov::Extensions::Cpu {
+
+KVCacheEvictor::KVCacheEvictor(const KVCacheEvictionParams& params, size_t block_size)
+    : m_params(params),
+      m_block_size(block_size) {
+    if (m_params.mode == KVCacheEvictionMode::NONE || m_params.budget == 0) {
+        return;
+    }
+    // at least the first block and one recent block
+    m_budget_blocks = std::max<size_t>((m_params.budget + block_size - 1) / block_size, 2);
+    m_recent_blocks = std::max<size_t>(m_budget_blocks / 4, 1);
+}
+
+int32_t KVCacheEvictor::score_window(int32_t q_len) const {
+    switch (m_params.mode) {
+    case KVCacheEvictionMode::H2O:
+        return q_len;
+    case KVCacheEvictionMode::SNAPKV:
+        // the generated tokens do not change the ranking of the prompt tokens
+        return q_len > 1 ? std::min(q_len, snapkv_window) : 0;
+    default:
+        return 0;
+    }
+}
+
+void KVCacheEvictor::accumulate(Sequence& sequence, const float* scores, size_t kv_len, size_t q_len) const {
+    sequence.scores.resize(kv_len, 0.0F);
+    if (scores == nullptr || score_window(static_cast<int32_t>(q_len)) == 0) {
+        return;
+    }
+    for (size_t i = 0; i < kv_len; i++) {
+        sequence.scores[i] += scores[i];
+    }
+}
+
+std::vector<size_t> KVCacheEvictor::select(const Sequence& sequence, size_t kv_len) const {
+    const auto full_blocks = kv_len / m_block_size;
+    if (!enabled() || full_blocks <= m_budget_blocks) {
+        return {};
+    }
+    const auto count = full_blocks - m_budget_blocks;
+    // the first block and the recent blocks are kept
+    std::vector<size_t> candidates(full_blocks - m_recent_blocks - 1);
+    std::iota(candidates.begin(), candidates.end(), 1);
+
+    if (m_params.mode != KVCacheEvictionMode::SLIDING_WINDOW) {
+        std::vector<float> block_scores(full_blocks, 0.0F);
+        for (size_t i = 0; i < std::min(sequence.scores.size(), full_blocks * m_block_size); i++) {
+            block_scores[i / m_block_size] += sequence.scores[i];
+        }
+        // the lowest scores first, the older blocks first on ties
+        std::stable_sort(candidates.begin(), candidates.end(), [&](size_t l, size_t r) {
+            return block_scores[l] < block_scores[r];
+        });
+    }
+    candidates.resize(count);
+    std::sort(candidates.begin(), candidates.end());
+    return candidates;
+}
+
+void KVCacheEvictor::evict(Sequence& sequence, const std::vector<size_t>& blocks) const {
+    for (auto it = blocks.rbegin(); it != blocks.rend(); ++it) {
+        const auto begin = std::min(*it * m_block_size, sequence.scores.size());
+        const auto end = std::min(begin + m_block_size, sequence.scores.size());
+        sequence.scores.erase(sequence.scores.begin() + begin, sequence.scores.begin() + end);
+    }
+}
+
+KVCacheEvictionState::KVCacheEvictionState(const std::string& name, const KVCacheEvictionParams& params)
+    : ov::IVariableState(name),
+      m_params(params) {}
+
+void KVCacheEvictionState::reset() {
+    m_sequences.clear();
+    m_ids.clear();
+    m_subsequences.clear();
+    m_bound = false;
+    m_evicted.clear();
+}
+
+void KVCacheEvictionState::set_state(const ov::SoPtr<ov::ITensor>& state) {
+    OPENVINO_ASSERT(state->get_element_type() == ov::element::i64 && state->get_shape().size() == 1,
+                    "KV cache eviction state expects an i64 tensor [B_seq] with the sequence ids, got ",
+                    state->get_element_type(),
+                    " ",
+                    state->get_shape());
+    const auto* ids = state->data<const int64_t>();
+    std::vector<int64_t> new_ids(ids, ids + state->get_size());
+    const std::unordered_set<int64_t> live(new_ids.begin(), new_ids.end());
+    OPENVINO_ASSERT(live.size() == new_ids.size(), "KV cache eviction state expects unique sequence ids");
+
+    // the sequences which are not scheduled any more are finished
+    for (auto it = m_sequences.begin(); it != m_sequences.end();) {
+        it = live.count(it->first) != 0U ? std::next(it) : m_sequences.erase(it);
+    }
+    m_ids = std::move(new_ids);
+}
+
+ov::SoPtr<ov::ITensor> KVCacheEvictionState::get_state() const {
+    auto tensor = ov::make_tensor(ov::element::i64, ov::Shape{m_evicted.size() / 2, 2});
+    if (!m_evicted.empty()) {
+        std::memcpy(tensor->data(), m_evicted.data(), m_evicted.size() * sizeof(int64_t));
+    }
+    return tensor;
+}
+
+void KVCacheEvictionState::start() {
+    m_bound = false;
+    m_evicted.clear();
+}
+
+const std::vector<int32_t>& KVCacheEvictionState::bind(const int32_t* past_lens,
+                                                       const int32_t* subsequence_begins,
+                                                       const int32_t* block_indices,
+                                                       const int32_t* block_indices_begins,
+                                                       size_t B_seq,
+                                                       size_t block_size) {
+    if (m_bound) {
+        return m_score_windows;
+    }
+    OPENVINO_ASSERT(m_ids.size() == B_seq,
+                    "KV cache eviction expects the ids of ",
+                    B_seq,
+                    " sequences set to the '",
+                    get_name(),
+                    "' state, got ",
+                    m_ids.size());
+    if (!m_evictor.enabled()) {
+        m_evictor = KVCacheEvictor(m_params, block_size);
+    }
+
+    m_subsequences.resize(B_seq);
+    m_score_windows.clear();
+    for (size_t i = 0; i < B_seq; i++) {
+        auto& subsequence = m_subsequences[i];
+        auto past_len = static_cast<size_t>(past_lens[i]);
+        subsequence.id = m_ids[i];
+        subsequence.q_len = static_cast<size_t>(subsequence_begins[i + 1] - subsequence_begins[i]);
+        subsequence.kv_len = past_len + subsequence.q_len;
+        subsequence.blocks.assign(block_indices + block_indices_begins[i], block_indices + block_indices_begins[i + 1]);
+        subsequence.sequence = &m_sequences[subsequence.id];
+
+        auto& scores = subsequence.sequence->scores;
+        // a new sequence, or the application changed the cache of the sequence in a way the scores don't follow
+        if (scores.size() != past_len) {
+            scores.assign(past_len, 0.0F);
+        }
+        scores.resize(subsequence.kv_len, 0.0F);
+        if (m_evictor.needs_scores()) {
+            m_score_windows.push_back(m_evictor.score_window(static_cast<int32_t>(subsequence.q_len)));
+        }
+    }
+    m_bound = true;
+    return m_score_windows;
+}
+
+void KVCacheEvictionState::accumulate(size_t subsequence, const float* scores) {
+    const auto& item = m_subsequences[subsequence];
+    m_evictor.accumulate(*item.sequence, scores, item.kv_len, item.q_len);
+}
+
+void KVCacheEvictionState::evict() {
+    if (!m_bound) {
+        return;
+    }
+    for (const auto& subsequence : m_subsequences) {
+        const auto blocks = m_evictor.select(*subsequence.sequence, subsequence.kv_len);
+        for (const auto block : blocks) {
+            m_evicted.push_back(subsequence.id);
+            m_evicted.push_back(subsequence.blocks[block]);
+        }
+        m_evictor.evict(*subsequence.sequence, blocks);
+    }
+    m_bound = false;
+}
+
+}  // namespace ov::Extensions::Cpu
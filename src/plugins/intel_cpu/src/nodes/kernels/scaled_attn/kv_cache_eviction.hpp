@@ -0,0 +1,159 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "openvino/runtime/itensor.hpp"
+#include "openvino/runtime/ivariable_state.hpp"
+#include "openvino/runtime/so_ptr.hpp"
+
+namespace ov::Extensions::Cpu {
+
+enum class KVCacheEvictionMode : uint8_t {
+    NONE,            // the cache grows with the sequence
+    H2O,             // keeps the blocks with the highest attention scores accumulated over all the queries
+    SNAPKV,          // keeps the blocks with the highest attention scores of the last queries of the prompt
+    SLIDING_WINDOW,  // keeps the first block and the most recent blocks
+};
+
+struct KVCacheEvictionParams {
+    KVCacheEvictionMode mode = KVCacheEvictionMode::NONE;
+    // maximum number of the cached tokens of a sequence, rounded up to the blocks, 0 - no limit
+    size_t budget = 0UL;
+};
+
+/**
+ * Ranks the blocks of a sequence to keep the number of its cached tokens within the budget by evicting whole blocks.
+ * The first block (attention sink) and the most recent blocks are never evicted, the rest are ranked by the policy.
+ */
+class KVCacheEvictor {
+public:
+    struct Sequence {
+        std::vector<float> scores;  // accumulated attention score of every cached token
+    };
+
+    // number of the queries at the end of a prompt which attention scores rank the tokens in SNAPKV mode
+    static constexpr int32_t snapkv_window = 32;
+
+    KVCacheEvictor() = default;
+    KVCacheEvictor(const KVCacheEvictionParams& params, size_t block_size);
+
+    [[nodiscard]] bool enabled() const {
+        return m_params.mode != KVCacheEvictionMode::NONE && m_budget_blocks != 0;
+    }
+
+    [[nodiscard]] bool needs_scores() const {
+        return enabled() && m_params.mode != KVCacheEvictionMode::SLIDING_WINDOW;
+    }
+
+    /**
+     * @brief Number of the last queries of a subsequence which scores have to be accumulated
+     */
+    [[nodiscard]] int32_t score_window(int32_t q_len) const;
+
+    /**
+     * @brief Accumulates the attention scores of the cached tokens after the new tokens are appended
+     * @param scores the scores of all the kv_len tokens of the sequence
+     */
+    void accumulate(Sequence& sequence, const float* scores, size_t kv_len, size_t q_len) const;
+
+    /**
+     * @brief Selects the blocks to evict to fit the budget
+     * @return the sorted indices of the blocks in the block table of the sequence
+     */
+    [[nodiscard]] std::vector<size_t> select(const Sequence& sequence, size_t kv_len) const;
+
+    /**
+     * @brief Drops the scores of the evicted blocks, the following blocks take their places in the block table
+     */
+    void evict(Sequence& sequence, const std::vector<size_t>& blocks) const;
+
+private:
+    KVCacheEvictionParams m_params;
+    size_t m_block_size = 0UL;
+    size_t m_budget_blocks = 0UL;
+    size_t m_recent_blocks = 0UL;
+};
+
+/**
+ * The built-in KV cache eviction state of an infer request, shared by all the PagedAttention operations of the model,
+ * so one decision is made per sequence and inference from the scores summed over the operations.
+ * set_state() takes an i64 tensor [B_seq] with the ids of the sequences of the next inference in the order of the
+ * past_lens input; the state of the sequences missing from it is erased, so a finished sequence is dropped by the next
+ * set_state() call. After the inference get_state() returns an i64 tensor [N, 2] of the (sequence id, block index)
+ * pairs of the evicted blocks. The application removes these blocks from the block tables of the sequences, shortens
+ * their past lengths by the block size per block and frees the blocks no other sequence refers to. The cache is never
+ * written, so the blocks shared by several sequences stay valid for the others.
+ */
+class KVCacheEvictionState : public ov::IVariableState {
+public:
+    KVCacheEvictionState(const std::string& name, const KVCacheEvictionParams& params);
+
+    // ov::IVariableState
+    void reset() override;
+    void set_state(const ov::SoPtr<ov::ITensor>& state) override;
+    [[nodiscard]] ov::SoPtr<ov::ITensor> get_state() const override;
+
+    [[nodiscard]] bool enabled() const {
+        return m_params.mode != KVCacheEvictionMode::NONE && m_params.budget != 0;
+    }
+
+    [[nodiscard]] size_t num_sequences() const {
+        return m_sequences.size();
+    }
+
+    /**
+     * @brief Starts a new inference, the blocks evicted by the previous one are forgotten
+     */
+    void start();
+
+    /**
+     * @brief Binds the subsequences of the inference to the sequences, only the first call of an inference has effect
+     * @return the number of the last queries of every subsequence which scores have to be accumulated, empty if the
+     * policy does not use the scores
+     */
+    const std::vector<int32_t>& bind(const int32_t* past_lens,
+                                     const int32_t* subsequence_begins,
+                                     const int32_t* block_indices,
+                                     const int32_t* block_indices_begins,
+                                     size_t B_seq,
+                                     size_t block_size);
+
+    /**
+     * @brief Adds the scores of the cached tokens of a subsequence computed by one operation. Different subsequences
+     * may be accumulated concurrently.
+     */
+    void accumulate(size_t subsequence, const float* scores);
+
+    /**
+     * @brief Selects the blocks to evict once all the operations of the inference are executed
+     */
+    void evict();
+
+private:
+    struct Subsequence {
+        int64_t id;
+        KVCacheEvictor::Sequence* sequence;
+        size_t kv_len;
+        size_t q_len;
+        std::vector<int32_t> blocks;
+    };
+
+    KVCacheEvictionParams m_params;
+    KVCacheEvictor m_evictor;
+    std::unordered_map<int64_t, KVCacheEvictor::Sequence> m_sequences;
+    std::vector<int64_t> m_ids;
+    std::vector<Subsequence> m_subsequences;
+    std::vector<int32_t> m_score_windows;
+    bool m_bound = false;
+    // (sequence id, block index) pairs
+    std::vector<int64_t> m_evicted;
+};
+
+}  // namespace ov::Extensions::Cpu
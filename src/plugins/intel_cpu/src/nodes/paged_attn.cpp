@@ -20,6 +20,7 @@
 #include "node.h"
 #include "nodes/common/blocked_desc_creator.h"
 #include "nodes/kernels/scaled_attn/executor_pa_common.hpp"
+#include "nodes/kernels/scaled_attn/kv_cache_eviction.hpp"
 #include "nodes/node_config.h"
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
@@ -42,6 +43,7 @@ using namespace dnnl::impl::cpu::x64;
 
 namespace ov::intel_cpu::node {
 
+// the executor keeps the scratch buffers of the execution, so it isn't shareable and stays in the stream cache
 struct PagedAttentionKey {
     ov::element::Type rtPrecision;
 
@@ -275,7 +277,29 @@ void PagedAttention::execute([[maybe_unused]] const dnnl::stream& strm) {
         outputs[1] = getDstMemoryAtPort(1);
     }
 
-    m_executor->execute(inputs, outputs);
+    m_executor->execute(inputs, outputs, m_evictionState);
+}
+
+std::shared_ptr<KVCacheEvictionState> PagedAttention::makeKVCacheEvictionState(const Config& config) {
+    KVCacheEvictionParams eviction;
+    switch (config.kvCacheEviction) {
+    case Config::KVCacheEviction::H2O:
+        eviction.mode = KVCacheEvictionMode::H2O;
+        break;
+    case Config::KVCacheEviction::SnapKV:
+        eviction.mode = KVCacheEvictionMode::SNAPKV;
+        break;
+    case Config::KVCacheEviction::SlidingWindow:
+        eviction.mode = KVCacheEvictionMode::SLIDING_WINDOW;
+        break;
+    default:
+        eviction.mode = KVCacheEvictionMode::NONE;
+    }
+    eviction.budget = static_cast<size_t>(config.kvCacheEvictionBudget);
+    if (eviction.mode == KVCacheEvictionMode::NONE || eviction.budget == 0) {
+        return nullptr;
+    }
+    return std::make_shared<KVCacheEvictionState>(kvCacheEvictionStateName, eviction);
 }
 
 bool PagedAttention::isSupportedOperation(const std::shared_ptr<const ov::Node>& op,
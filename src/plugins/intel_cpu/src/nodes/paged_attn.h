@@ -7,12 +7,14 @@
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
+#include <utility>
 
 #include "config.h"
 #include "cpu_types.h"
 #include "graph_context.h"
 #include "node.h"
 #include "nodes/kernels/scaled_attn/executor_pa_common.hpp"
+#include "nodes/kernels/scaled_attn/kv_cache_eviction.hpp"
 #include "openvino/core/node.hpp"
 #include "openvino/core/type/element_type.hpp"
 
@@ -52,6 +54,14 @@ public:
 
     static bool isQuantByChannel(Config::CacheQuantMode mode, ov::element::Type precision, bool isKey);
 
+    // name of the variable state the application exchanges the sequence ids and the evicted blocks through
+    static constexpr const char* kvCacheEvictionStateName = "kv_cache_eviction";
+    // the built-in KV cache eviction state of an infer request, nullptr if the eviction is disabled by the config
+    static std::shared_ptr<ov::Extensions::Cpu::KVCacheEvictionState> makeKVCacheEvictionState(const Config& config);
+    void assignKVCacheEvictionState(std::shared_ptr<ov::Extensions::Cpu::KVCacheEvictionState> state) {
+        m_evictionState = std::move(state);
+    }
+
 private:
     ov::element::Type getRuntimePrecision() const override;
 
@@ -61,6 +71,7 @@ private:
     friend struct PagedAttentionKey;
 
     bool m_hasScore = false;
+    std::shared_ptr<ov::Extensions::Cpu::KVCacheEvictionState> m_evictionState;
 };
 
 }  // namespace ov::intel_cpu::node
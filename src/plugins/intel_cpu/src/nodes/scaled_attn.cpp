@@ -75,6 +75,7 @@ using namespace dnnl::impl::cpu::x64;
 
 namespace ov::intel_cpu::node {
 
+// the executor keeps the scratch buffers of the execution, so it isn't shareable and stays in the stream cache
 struct ScaledDotProductAttentionKey {
     ov::element::Type rtPrecision;
 
@@ -270,6 +271,9 @@ struct MHAKernel<ScaledDotProductAttention::KT_ONEDNN, T> {
     using dt = dnnl::memory::data_type;
     size_t m_threads_num = 0LU;
     struct brgemmKey {
+        // the brgemm kernels keep no execution state, so they are shared by the streams
+        static constexpr bool shareable = true;
+
         size_t M = 0UL;
         size_t N = 0UL;
         size_t K = 0UL;
@@ -156,6 +156,9 @@ struct SubgraphCodeGeneratorKey {
 #endif
 
 struct SubgraphShapeInferResultKey {
+    // the shape inference results are immutable, so they are shared by the streams
+    static constexpr bool shareable = true;
+
     SubgraphShapeInferResultKey(std::vector<VectorDims> in_shapes_, uint64_t body_hash_)
         : in_shapes(std::move(in_shapes_)),
           body_hash(body_hash_) {}
@@ -5,6 +5,7 @@
 #include "plugin.h"
 
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <fstream>
 #include <istream>
@@ -58,6 +59,7 @@
 #include "utils/debug_capabilities.h"
 #include "utils/denormals.hpp"
 #include "utils/graph_serializer/deserializer.hpp"
+#include "utils/graph_serializer/prepacked_weights.hpp"
 #include "utils/graph_serializer/serializer.hpp"
 #include "utils/precision_support.h"
 #include "weights_cache.hpp"
@@ -246,6 +248,7 @@ Plugin::~Plugin() {
     executor_manager()->clear("CPUStreamsExecutor");
     executor_manager()->clear("CPUMainStreamExecutor");
     executor_manager()->clear("CPUCallbackExecutor");
+    executor_manager()->clear("CPUWarmupExecutor");
 }
 
 static bool streamsSet(const ov::AnyMap& config) {
@@ -407,7 +410,9 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
             denormals_as_zero(false);
         }
     }
-    return std::make_shared<CompiledModel>(cloned_model, shared_from_this(), conf, false);
+    auto compiled_model = std::make_shared<CompiledModel>(cloned_model, shared_from_this(), conf, false);
+    compiled_model->precompile_shape_buckets();
+    return compiled_model;
 }
 
 void Plugin::set_property(const ov::AnyMap& config) {
@@ -754,9 +759,20 @@ std::shared_ptr<ov::ICompiledModel> Plugin::import_model(std::istream& model_str
     auto decrypt_from_string = get_cache_decrypt_fn(config, decrypt);
     const auto origin_weights_path = get_origin_weights_path(config);
 
+    PrepackedWeights::Entries prepacked_weights;
+    char magic[sizeof(uint64_t)] = {};
+    const auto pos = model_stream.tellg();
+    model_stream.read(magic, sizeof(magic));
+    const bool has_prepacked_weights = model_stream.good() && PrepackedWeights::has_section(magic, sizeof(magic));
+    model_stream.clear();
+    model_stream.seekg(pos);
+    if (has_prepacked_weights) {
+        prepacked_weights = PrepackedWeights::read(model_stream);
+    }
+
     ModelDeserializer deserializer(model_stream, get_core(), decrypt, decrypt_from_string, origin_weights_path);
 
-    return deserialize_model(deserializer, config);
+    return deserialize_model(deserializer, config, std::move(prepacked_weights));
 }
 
 std::shared_ptr<ov::ICompiledModel> Plugin::import_model(const ov::Tensor& model_tensor,
@@ -773,15 +789,28 @@ std::shared_ptr<ov::ICompiledModel> Plugin::import_model(const ov::Tensor& model
     std::shared_ptr<ov::AlignedBuffer> model_buffer =
         std::make_shared<ov::SharedBuffer<ov::Tensor>>(model_data_ptr, model_tensor.get_byte_size(), model_tensor);
 
+    PrepackedWeights::Entries prepacked_weights;
+    if (PrepackedWeights::has_section(model_data_ptr, model_tensor.get_byte_size())) {
+        // the weights are used in place, the serialized model follows the section
+        size_t model_offset = 0;
+        std::tie(prepacked_weights, model_offset) = PrepackedWeights::read(model_buffer);
+        model_buffer = std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(
+            model_data_ptr + model_offset,
+            model_tensor.get_byte_size() - model_offset,
+            model_buffer);
+    }
+
     ModelDeserializer deserializer(model_buffer, get_core(), decrypt, decrypt_from_string, origin_weights_path);
 
-    return deserialize_model(deserializer, config);
+    return deserialize_model(deserializer, config, std::move(prepacked_weights));
 }
 
 std::shared_ptr<ov::ICompiledModel> Plugin::deserialize_model(ModelDeserializer& deserializer,
-                                                              const ov::AnyMap& config) const {
+                                                              const ov::AnyMap& config,
+                                                              PrepackedWeights::Entries prepacked_weights) const {
     std::shared_ptr<ov::Model> model;
     deserializer >> model;
+    PrepackedWeights::resolve_keys(prepacked_weights, model);
 
     auto _config = config;
     Config conf = engConfig;
@@ -798,7 +827,14 @@ std::shared_ptr<ov::ICompiledModel> Plugin::deserialize_model(ModelDeserializer&
 
     // import config props from caching model
     calculate_streams(conf, model, true);
-    auto compiled_model = std::make_shared<CompiledModel>(model, shared_from_this(), conf, loaded_from_cache);
+    auto compiled_model = std::make_shared<CompiledModel>(model,
+                                                          shared_from_this(),
+                                                          conf,
+                                                          loaded_from_cache,
+                                                          nullptr,
+                                                          std::move(prepacked_weights));
+    compiled_model->warm_up_runtime_cache();
+    compiled_model->precompile_shape_buckets();
     return compiled_model;
 }
 }  // namespace ov::intel_cpu
@@ -19,6 +19,7 @@
 #include "openvino/runtime/so_ptr.hpp"
 #include "openvino/runtime/threading/cpu_message.hpp"
 #include "utils/graph_serializer/deserializer.hpp"
+#include "utils/graph_serializer/prepacked_weights.hpp"
 
 namespace ov::intel_cpu {
 
@@ -66,7 +67,8 @@ public:
 
 private:
     std::shared_ptr<ov::ICompiledModel> deserialize_model(ModelDeserializer& deserializer,
-                                                          const ov::AnyMap& config) const;
+                                                          const ov::AnyMap& config,
+                                                          PrepackedWeights::Entries prepacked_weights = {}) const;
 
     ov::Any get_ro_property(const std::string& name, const ov::AnyMap& options) const;
 
@@ -0,0 +1,362 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "prepacked_weights.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <ios>
+#include <istream>
+#include <memory>
+#include <oneapi/dnnl/dnnl.hpp>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "dnnl_extension_utils.h"
+#include "graph_context.h"
+#include "memory_desc/cpu_memory_desc_utils.h"
+#include "memory_desc/dnnl_memory_desc.h"
+#include "openvino/core/except.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/runtime/aligned_buffer.hpp"
+#include "utils/debug_capabilities.h"
+#include "weights_cache.hpp"
+
+namespace ov::intel_cpu {
+
+namespace {
+
+constexpr char section_magic[8] = {'C', 'P', 'U', 'P', 'A', 'C', 'K', '1'};
+constexpr size_t page_size = 4096;
+// oneDNN kernels require the weights to be aligned at least to the cache line
+constexpr size_t min_alignment = 64;
+// separates the key prefix from the constant name in the portable keys
+constexpr char name_marker = '\x01';
+
+struct SectionHeader {
+    char magic[8];
+    uint64_t section_size;  // including the table and the weights regions, the serialized model follows
+    uint64_t count;
+};
+
+// the format of the constant address in the key, see Input::blobKey and computeWeightsStringHash
+enum AddressFormat : char { Hex = 'x', Decimal = 'd' };
+
+std::string format_address(uintptr_t address, char format) {
+    if (format == Hex) {
+        char str[32];
+        snprintf(str, sizeof str, "%p", reinterpret_cast<void*>(address));  // NOLINT(performance-no-int-to-ptr)
+        return str;
+    }
+    return std::to_string(static_cast<uint64_t>(address));
+}
+
+// the constants with non unique names are skipped, they can not be matched on import
+std::unordered_map<std::string, uintptr_t> get_constant_addresses(const std::shared_ptr<const ov::Model>& model) {
+    std::unordered_map<std::string, uintptr_t> addresses;
+    std::unordered_map<std::string, size_t> counts;
+    for (const auto& op : model->get_ordered_ops()) {
+        if (const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(op)) {
+            const auto& name = constant->get_friendly_name();
+            if (++counts[name] == 1) {
+                addresses[name] = reinterpret_cast<uintptr_t>(constant->get_data_ptr());
+            } else {
+                addresses.erase(name);
+            }
+        }
+    }
+    return addresses;
+}
+
+bool to_portable_key(const std::string& key,
+                     const std::unordered_map<uintptr_t, std::string>& names,
+                     std::string& portable) {
+    const auto pos = key.rfind('_');
+    if (pos == std::string::npos || pos + 1 == key.size()) {
+        return false;
+    }
+    const auto token = key.substr(pos + 1);
+    char format = Decimal;
+    uintptr_t address = 0;
+    try {
+        if (token.rfind("0x", 0) == 0) {
+            format = Hex;
+            address = static_cast<uintptr_t>(std::stoull(token.substr(2), nullptr, 16));
+        } else if (token.find_first_not_of("0123456789") == std::string::npos) {
+            address = static_cast<uintptr_t>(std::stoull(token));
+        } else {
+            return false;
+        }
+    } catch (const std::exception&) {
+        return false;
+    }
+    const auto name = names.find(address);
+    if (name == names.end() || format_address(address, format) != token) {
+        return false;
+    }
+    portable = key.substr(0, pos + 1) + name_marker + format + name->second;
+    return true;
+}
+
+template <typename T>
+void write_value(std::ostream& stream, const T& value) {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void write_string(std::ostream& stream, const std::string& str) {
+    write_value(stream, static_cast<uint64_t>(str.size()));
+    stream.write(str.data(), str.size());
+}
+
+class SectionReader {
+public:
+    SectionReader(const char* data, size_t size) : m_data(data), m_size(size) {}
+
+    template <typename T>
+    T value() {
+        T result;
+        std::memcpy(&result, take(sizeof(T)), sizeof(T));
+        return result;
+    }
+
+    std::string string() {
+        const auto size = value<uint64_t>();
+        return {take(size), size};
+    }
+
+private:
+    const char* take(size_t size) {
+        OPENVINO_ASSERT(m_pos + size <= m_size, "[CPU] The prepacked weights section is corrupted");
+        const auto* result = m_data + m_pos;
+        m_pos += size;
+        return result;
+    }
+
+    const char* m_data;
+    size_t m_size;
+    size_t m_pos = 0;
+};
+
+// reads the section from a stream without buffering it, so the weights regions are read straight into their memory
+class StreamSectionReader {
+public:
+    StreamSectionReader(std::istream& stream, size_t pos, size_t size) : m_stream(stream), m_size(size), m_pos(pos) {}
+
+    template <typename T>
+    T value() {
+        T result;
+        read(reinterpret_cast<char*>(&result), sizeof(T));
+        return result;
+    }
+
+    std::string string() {
+        const auto size = value<uint64_t>();
+        check(size);
+        std::string result(size, '\0');
+        read(result.data(), size);
+        return result;
+    }
+
+    void read(char* data, size_t size) {
+        check(size);
+        m_stream.read(data, static_cast<std::streamsize>(size));
+        OPENVINO_ASSERT(m_stream.good(), "[CPU] The prepacked weights section is corrupted");
+        m_pos += size;
+    }
+
+    // moves to the section offset, which must not precede the current position
+    void seek(size_t offset) {
+        OPENVINO_ASSERT(offset >= m_pos, "[CPU] The prepacked weights section is corrupted");
+        check(offset - m_pos);
+        m_stream.ignore(static_cast<std::streamsize>(offset - m_pos));
+        OPENVINO_ASSERT(m_stream.good(), "[CPU] The prepacked weights section is corrupted");
+        m_pos = offset;
+    }
+
+private:
+    void check(size_t size) const {
+        OPENVINO_ASSERT(size <= m_size - m_pos, "[CPU] The prepacked weights section is corrupted");
+    }
+
+    std::istream& m_stream;
+    size_t m_size;
+    size_t m_pos;
+};
+
+struct TableEntry {
+    std::string key;
+    std::vector<uint8_t> desc;
+    uint64_t offset;
+    uint64_t size;
+};
+
+template <typename Reader>
+std::vector<TableEntry> read_table(Reader& reader, uint64_t count) {
+    std::vector<TableEntry> table(count);
+    for (auto& entry : table) {
+        entry.key = reader.string();
+        const auto desc = reader.string();
+        entry.desc.assign(desc.begin(), desc.end());
+        entry.offset = reader.value<uint64_t>();
+        entry.size = reader.value<uint64_t>();
+    }
+    return table;
+}
+
+MemoryDescPtr make_desc(const std::vector<uint8_t>& blob) {
+    return DnnlExtensionUtils::makeDescriptor(dnnl::memory::desc(blob));
+}
+
+}  // namespace
+
+std::vector<PrepackedWeights::Entry> PrepackedWeights::collect(const SocketsWeights& cache,
+                                                               const std::shared_ptr<const ov::Model>& model) {
+    std::unordered_map<uintptr_t, std::string> names;
+    for (const auto& [name, address] : get_constant_addresses(model)) {
+        names[address] = name;
+    }
+
+    std::vector<Entry> weights;
+    for (const auto& [key, memory] : cache.getValidEntries()) {
+        if (memory->getDesc().getPrecision() == ov::element::string || memory->getSize() == 0) {
+            continue;
+        }
+        std::string portable;
+        if (to_portable_key(key, names, portable)) {
+            weights.push_back({std::move(portable), memory});
+        }
+    }
+    return weights;
+}
+
+void PrepackedWeights::write(std::ostream& stream, const std::vector<Entry>& weights) {
+    std::vector<std::vector<uint8_t>> descs;
+    descs.reserve(weights.size());
+    size_t table_size = sizeof(SectionHeader);
+    for (const auto& entry : weights) {
+        descs.push_back(MemoryDescUtils::convertToDnnlMemoryDesc(entry.memory->getDescPtr())->getDnnlDesc().get_blob());
+        table_size += 4 * sizeof(uint64_t) + entry.key.size() + descs.back().size();
+    }
+
+    // the regions are aligned relative to the beginning of the stream, which is the beginning of the mapped file
+    const auto stream_pos = static_cast<std::streamoff>(stream.tellp());
+    const size_t base = stream_pos < 0 ? 0 : static_cast<size_t>(stream_pos);
+    auto align = [base](size_t offset) {
+        return ((base + offset + page_size - 1) / page_size) * page_size - base;
+    };
+    std::vector<uint64_t> offsets;
+    offsets.reserve(weights.size());
+    size_t section_size = table_size;
+    for (const auto& entry : weights) {
+        offsets.push_back(align(section_size));
+        section_size = offsets.back() + entry.memory->getSize();
+    }
+
+    SectionHeader header = {};
+    std::memcpy(header.magic, section_magic, sizeof(section_magic));
+    header.section_size = section_size;
+    header.count = weights.size();
+    write_value(stream, header);
+    for (size_t i = 0; i < weights.size(); ++i) {
+        write_string(stream, weights[i].key);
+        write_string(stream, std::string(descs[i].begin(), descs[i].end()));
+        write_value(stream, offsets[i]);
+        write_value(stream, static_cast<uint64_t>(weights[i].memory->getSize()));
+    }
+    size_t pos = table_size;
+    const std::vector<char> padding(page_size, 0);
+    for (size_t i = 0; i < weights.size(); ++i) {
+        stream.write(padding.data(), offsets[i] - pos);
+        stream.write(static_cast<const char*>(weights[i].memory->getData()), weights[i].memory->getSize());
+        pos = offsets[i] + weights[i].memory->getSize();
+    }
+}
+
+bool PrepackedWeights::has_section(const char* data, size_t size) {
+    return size >= sizeof(section_magic) && std::memcmp(data, section_magic, sizeof(section_magic)) == 0;
+}
+
+PrepackedWeights::Entries PrepackedWeights::read(std::istream& stream) {
+    const auto start = stream.tellg();
+    SectionHeader header = {};
+    stream.read(reinterpret_cast<char*>(&header), sizeof(header));
+    OPENVINO_ASSERT(stream.good() && has_section(header.magic, sizeof(header)) && header.section_size >= sizeof(header),
+                    "[CPU] The prepacked weights section is corrupted");
+    StreamSectionReader reader(stream, sizeof(header), header.section_size);
+
+    // the regions follow the table in the order of the entries
+    Entries entries;
+    const auto& engine = GraphContext::getEngine();
+    for (const auto& entry : read_table(reader, header.count)) {
+        auto memory = std::make_shared<Memory>(engine, make_desc(entry.desc));
+        OPENVINO_ASSERT(memory->getSize() == entry.size, "[CPU] The prepacked weights section is corrupted");
+        reader.seek(entry.offset);
+        reader.read(static_cast<char*>(memory->getData()), entry.size);
+        entries.weights.push_back({entry.key, memory});
+    }
+    stream.seekg(start + static_cast<std::streamoff>(header.section_size));
+    return entries;
+}
+
+std::pair<PrepackedWeights::Entries, size_t> PrepackedWeights::read(const std::shared_ptr<ov::AlignedBuffer>& buffer) {
+    auto* data = buffer->get_ptr<char>();
+    const auto size = buffer->size();
+    OPENVINO_ASSERT(has_section(data, size), "[CPU] The prepacked weights section is corrupted");
+    SectionReader reader(data, size);
+    const auto header = reader.value<SectionHeader>();
+    OPENVINO_ASSERT(header.section_size <= size, "[CPU] The prepacked weights section is corrupted");
+
+    Entries entries;
+    entries.buffer = buffer;
+    const auto& engine = GraphContext::getEngine();
+    for (const auto& entry : read_table(reader, header.count)) {
+        OPENVINO_ASSERT(entry.offset + entry.size <= header.section_size,
+                        "[CPU] The prepacked weights section is corrupted");
+        auto desc = make_desc(entry.desc);
+        auto* region = data + entry.offset;
+        MemoryPtr memory;
+        if (reinterpret_cast<uintptr_t>(region) % min_alignment == 0) {
+            // the mapped pages are used in place, so the padding is not touched
+            memory = std::make_shared<Memory>(engine, desc, region, false);
+        } else {
+            memory = std::make_shared<Memory>(engine, desc);
+            std::memcpy(memory->getData(), region, entry.size);
+        }
+        OPENVINO_ASSERT(memory->getSize() == entry.size, "[CPU] The prepacked weights section is corrupted");
+        entries.weights.push_back({entry.key, memory});
+    }
+    return {entries, header.section_size};
+}
+
+void PrepackedWeights::resolve_keys(Entries& entries, const std::shared_ptr<const ov::Model>& model) {
+    const auto addresses = get_constant_addresses(model);
+    std::vector<Entry> resolved;
+    resolved.reserve(entries.weights.size());
+    for (auto& entry : entries.weights) {
+        const auto pos = entry.key.rfind(name_marker);
+        if (pos == std::string::npos || pos + 1 >= entry.key.size()) {
+            continue;
+        }
+        const auto address = addresses.find(entry.key.substr(pos + 2));
+        if (address == addresses.end()) {
+            DEBUG_LOG("Prepacked weights are skipped, unknown constant: ", entry.key.substr(pos + 2));
+            continue;
+        }
+        entry.key = entry.key.substr(0, pos) + format_address(address->second, entry.key[pos + 1]);
+        resolved.push_back(std::move(entry));
+    }
+    entries.weights = std::move(resolved);
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,77 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "openvino/core/model.hpp"
+#include "openvino/runtime/aligned_buffer.hpp"
+
+namespace ov::intel_cpu {
+
+class SocketsWeights;
+
+/**
+ * Optional section of the exported model which keeps the weights in their final (repacked) layout, so the imported
+ * model adopts them instead of repacking the original constants.
+ *
+ * The section precedes the serialized model. The weights regions are aligned to the page size relative to the
+ * beginning of the output stream, so a memory mapped blob exposes every region as whole pages which are used in place.
+ *
+ * The weights cache keys embed the addresses of the original constants. The addresses are replaced with the
+ * constant names on export and restored from the constants of the imported model on import.
+ */
+class PrepackedWeights {
+public:
+    struct Entry {
+        std::string key;
+        MemoryPtr memory;
+    };
+
+    struct Entries {
+        std::vector<Entry> weights;
+        // keeps the memory mapped regions alive
+        std::shared_ptr<ov::AlignedBuffer> buffer;
+    };
+
+    /**
+     * @brief Collects the repacked weights of the cache which have portable keys
+     */
+    static std::vector<Entry> collect(const SocketsWeights& cache, const std::shared_ptr<const ov::Model>& model);
+
+    static void write(std::ostream& stream, const std::vector<Entry>& weights);
+
+    /**
+     * @brief Checks whether the data starts with the prepacked weights section
+     */
+    static bool has_section(const char* data, size_t size);
+
+    /**
+     * @brief Reads the section from the stream and positions the stream at the serialized model
+     */
+    static Entries read(std::istream& stream);
+
+    /**
+     * @brief Maps the section of the buffer without copying the weights
+     * @return the entries and the offset of the serialized model in the buffer
+     */
+    static std::pair<Entries, size_t> read(const std::shared_ptr<ov::AlignedBuffer>& buffer);
+
+    /**
+     * @brief Restores the cache keys of the entries for the imported model. The entries which keys refer to unknown
+     * constants are dropped.
+     */
+    static void resolve_keys(Entries& entries, const std::shared_ptr<const ov::Model>& model);
+};
+
+}  // namespace ov::intel_cpu
@@ -5,10 +5,16 @@
 #include "weights_cache.hpp"
 
 #include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <functional>
+#include <iterator>
 #include <memory>
 #include <mutex>
+#include <set>
+#include <shared_mutex>
 #include <string>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -18,6 +24,24 @@
 
 namespace ov::intel_cpu {
 
+namespace {
+template <typename Lock>
+Lock lockCounted(typename Lock::mutex_type& mutex,
+                 std::atomic<uint64_t>& lockContentions,
+                 std::atomic<uint64_t>& lockWaitNs) {
+    Lock lock(mutex, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        const auto start = std::chrono::steady_clock::now();
+        lock.lock();
+        const auto waitTime =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        lockContentions.fetch_add(1, std::memory_order_relaxed);
+        lockWaitNs.fetch_add(static_cast<uint64_t>(waitTime.count()), std::memory_order_relaxed);
+    }
+    return lock;
+}
+}  // namespace
+
 WeightsSharing::SharedMemory::SharedMemory(std::unique_lock<std::mutex>&& lock,
                                            MemoryInfo::Ptr memory,
                                            MemoryPtr newPtr)
@@ -37,64 +61,338 @@ void WeightsSharing::SharedMemory::valid(bool b) {
     memory->valid.store(b, std::memory_order_release);
 }
 
+bool WeightsSharing::Replication::reserve(size_t size) {
+    auto used = usedBytes.load(std::memory_order_relaxed);
+    do {
+        if (used + size > byteBudget) {
+            return false;
+        }
+    } while (!usedBytes.compare_exchange_weak(used, used + size, std::memory_order_relaxed));
+    return true;
+}
+
+void WeightsSharing::Replication::release(size_t size) {
+    usedBytes.fetch_sub(size, std::memory_order_relaxed);
+}
+
+void WeightsSharing::Replication::charge(size_t size) {
+    usedBytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+WeightsSharing::Replication::Source WeightsSharing::Replication::classify(const void* data) const {
+    {
+        std::lock_guard<std::mutex> lock(sourcesGuard);
+        auto found = sources.find(data);
+        if (found != sources.end()) {
+            if (!found->second.memory.expired()) {
+                return found->second.source;
+            }
+            sources.erase(found);
+        }
+    }
+    return hotConstants.count(data) ? Source::Hot : Source::Cold;
+}
+
+void WeightsSharing::Replication::mark(const MemoryPtr& memory, Source source) {
+    std::lock_guard<std::mutex> lock(sourcesGuard);
+    sources[memory->getData()] = MarkedSource{memory, source};
+    if (sources.size() >= 2 * prunedSize) {
+        prune();
+    }
+}
+
+void WeightsSharing::Replication::prune() const {
+    for (auto it = sources.begin(); it != sources.end();) {
+        it = it->second.memory.expired() ? sources.erase(it) : std::next(it);
+    }
+    prunedSize = sources.size();
+}
+
 WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(const std::string& key,
                                                                const std::function<MemoryPtr(void)>& create,
-                                                               bool valid) {
-    MemoryInfo::Ptr ptr;
-    MemoryPtr newPtr;
-    {
-        std::unique_lock<std::mutex> lock(guard);
-        auto found = sharedWeights.find(key);
+                                                               bool valid,
+                                                               const void* source) {
+    lookups.fetch_add(1, std::memory_order_relaxed);
+    if (!replication) {
+        return findOrCreateImpl(key, create, valid);
+    }
+    // the memory objects which are filled later (constant subgraphs) are never replicated
+    if (!valid) {
+        return replication->singleCopy->findOrCreate(key, create, valid);
+    }
+    if (auto replica = find(key)) {
+        return replica;
+    }
 
-        auto isCached = [&]() -> bool {
-            if (found == sharedWeights.end()) {
-                return false;
+    using Source = Replication::Source;
+    const auto kind = source ? replication->classify(source) : Source::Cold;
+    if (kind == Source::Cold) {
+        return replication->singleCopy->findOrCreate(key, create, valid);
+    }
+    if (kind == Source::Replica) {
+        // the weights derived from a replica are requested by its socket only, so they are created locally and
+        // accounted on top of the replicas of the hot constants
+        auto derived = findOrCreateImpl(
+            key,
+            [&]() {
+                auto memory = create();
+                replication->charge(memory->getSize());
+                return memory;
+            },
+            valid);
+        replication->mark(static_cast<MemoryPtr>(*derived), Source::Replica);
+        return derived;
+    }
+
+    // the first request creates the single copy, the replicas are created for the next sockets
+    auto shared = replication->singleCopy->find(key);
+    if (!shared) {
+        shared = replication->singleCopy->findOrCreate(key, create, valid);
+        replication->mark(static_cast<MemoryPtr>(*shared), Source::Hot);
+        return shared;
+    }
+    const auto size = static_cast<MemoryPtr>(*shared)->getSize();
+    if (!replication->reserve(size)) {
+        return shared;
+    }
+    // the reserved budget is returned if the creation throws or the replica is created by a concurrent request
+    struct Reservation {
+        Replication& replication;
+        size_t size;
+        bool used = false;
+        ~Reservation() {
+            if (!used) {
+                replication.release(size);
             }
-            ptr = found->second;
-            if (!ptr) {
+        }
+    } reservation{*replication, size};
+    bool created = false;
+    auto replica = findOrCreateImpl(key, create, valid, &created);
+    if (created) {
+        reservation.used = true;
+        replication->mark(static_cast<MemoryPtr>(*replica), Source::Replica);
+    }
+    return replica;
+}
+
+WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreateImpl(const std::string& key,
+                                                                   const std::function<MemoryPtr(void)>& create,
+                                                                   bool valid,
+                                                                   bool* created) {
+    auto& shard = getShard(key);
+    while (true) {
+        MemoryInfo::Ptr ptr;
+        MemoryPtr newPtr;
+        std::unique_lock<std::mutex> entryLock;
+        // returns true if the key refers to an alive memory object or to the one being created
+        auto lookup = [&]() {
+            auto found = shard.sharedWeights.find(key);
+            if (found == shard.sharedWeights.end() || !found->second) {
                 return false;
             }
+            ptr = found->second;
             newPtr = ptr->sharedMemory.lock();
-            return static_cast<bool>(newPtr);
+            return newPtr || ptr->pending;
         };
+        bool hit = false;
+        {
+            auto lock = lockSharedAndCount(shard.guard);
+            hit = lookup();
+        }
+        if (!hit) {
+            auto lock = lockAndCount(shard.guard);
+            // the entry may have been created between the shared and the exclusive locks
+            if (!lookup()) {
+                // the entry lock is taken before the entry is published, so the concurrent lookups wait for creation
+                ptr = std::make_shared<MemoryInfo>(nullptr, valid);
+                ptr->pending = true;
+                entryLock = std::unique_lock<std::mutex>(ptr->guard);
+                shard.sharedWeights[key] = ptr;
+            }
+        }
+
+        if (entryLock.owns_lock()) {
+            creations.fetch_add(1, std::memory_order_relaxed);
+            try {
+                newPtr = create();
+            } catch (...) {
+                auto lock = lockAndCount(shard.guard);
+                ptr->pending = false;
+                auto found = shard.sharedWeights.find(key);
+                if (found != shard.sharedWeights.end() && found->second == ptr) {
+                    shard.sharedWeights.erase(found);
+                }
+                throw;
+            }
+            if (interleave) {
+                mbind_interleave(newPtr);
+            }
+            {
+                auto lock = lockAndCount(shard.guard);
+                ptr->sharedMemory = newPtr;
+                ptr->pending = false;
+            }
+            if (created) {
+                *created = true;
+            }
+            if (ptr->valid.load(std::memory_order_relaxed)) {
+                entryLock.unlock();
+            }
+            return std::make_shared<SharedMemory>(std::move(entryLock), ptr, newPtr);
+        }
 
-        if (!isCached()) {
-            newPtr = create();
-            ptr = std::make_shared<MemoryInfo>(newPtr, valid);
-            sharedWeights[key] = ptr;
+        if (newPtr) {
+            return std::make_shared<SharedMemory>(ptr->valid.load(std::memory_order_relaxed)
+                                                      ? std::unique_lock<std::mutex>(ptr->guard, std::defer_lock)
+                                                      : lockAndCount(ptr->guard),
+                                                  ptr,
+                                                  newPtr);
+        }
+
+        // the memory object is being created by another thread, the entry lock is released once it is done
+        auto lock = lockAndCount(ptr->guard);
+        newPtr = ptr->sharedMemory.lock();
+        if (!newPtr) {
+            // the creation failed or the memory object has already been released, try again
+            continue;
+        }
+        if (ptr->valid.load(std::memory_order_relaxed)) {
+            lock.unlock();
         }
+        return std::make_shared<SharedMemory>(std::move(lock), ptr, newPtr);
     }
-    return std::make_shared<SharedMemory>(ptr->valid.load(std::memory_order_relaxed)
-                                              ? std::unique_lock<std::mutex>(ptr->guard, std::defer_lock)
-                                              : std::unique_lock<std::mutex>(ptr->guard),
-                                          ptr,
-                                          newPtr);
 }
 
 WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) const {
+    lookups.fetch_add(1, std::memory_order_relaxed);
+    auto result = find(key);
+    if (!result && replication) {
+        return replication->singleCopy->get(key);
+    }
+    OPENVINO_ASSERT(result, "Unknown shared memory with key ", key);
+    return result;
+}
+
+WeightsSharing::SharedMemory::Ptr WeightsSharing::find(const std::string& key) const {
+    const auto& shard = getShard(key);
     MemoryInfo::Ptr ptr;
     MemoryPtr newPtr;
     {
-        std::unique_lock<std::mutex> lock(guard);
-        auto found = sharedWeights.find(key);
-
-        OPENVINO_ASSERT(found != sharedWeights.end(), "Unknown shared memory with key ", key);
+        auto lock = lockSharedAndCount(shard.guard);
+        auto found = shard.sharedWeights.find(key);
+        if (found == shard.sharedWeights.end() || !found->second) {
+            return nullptr;
+        }
         ptr = found->second;
-        OPENVINO_ASSERT(ptr, "Unknown shared memory with key ", key);
         newPtr = ptr->sharedMemory.lock();
-        OPENVINO_ASSERT(newPtr, "Unknown shared memory with key ", key);
+        if (!newPtr && !ptr->pending) {
+            return nullptr;
+        }
+    }
+    if (!newPtr) {
+        // wait for the creation in another thread
+        auto lock = lockAndCount(ptr->guard);
+        newPtr = ptr->sharedMemory.lock();
+        if (!newPtr) {
+            return nullptr;
+        }
+        if (ptr->valid.load(std::memory_order_relaxed)) {
+            lock.unlock();
+        }
+        return std::make_shared<SharedMemory>(std::move(lock), ptr, newPtr);
     }
     return std::make_shared<SharedMemory>(ptr->valid.load(std::memory_order_relaxed)
                                               ? std::unique_lock<std::mutex>(ptr->guard, std::defer_lock)
-                                              : std::unique_lock<std::mutex>(ptr->guard),
+                                              : lockAndCount(ptr->guard),
                                           ptr,
                                           newPtr);
 }
 
-SocketsWeights::SocketsWeights() {
+void WeightsSharing::adopt(const std::string& key, const MemoryPtr& memory) {
+    findOrCreateImpl(
+        key,
+        [&memory]() {
+            return memory;
+        },
+        true);
+}
+
+std::vector<std::pair<std::string, MemoryPtr>> WeightsSharing::getValidEntries() const {
+    std::vector<std::pair<std::string, MemoryPtr>> retVal;
+    for (const auto& shard : shards) {
+        std::shared_lock<std::shared_mutex> lock(shard.guard);
+        for (const auto& item : shard.sharedWeights) {
+            if (!item.second || item.second->pending || !item.second->valid.load(std::memory_order_acquire)) {
+                continue;
+            }
+            if (auto memory = item.second->sharedMemory.lock()) {
+                retVal.emplace_back(item.first, memory);
+            }
+        }
+    }
+    return retVal;
+}
+
+size_t WeightsSharing::getReplicaBytes() const {
+    return replication ? replication->usedBytes.load(std::memory_order_relaxed) : 0;
+}
+
+WeightsSharing::ContentionStatistics WeightsSharing::getContentionStatistics() const {
+    ContentionStatistics retVal;
+    retVal.lookups = lookups.load(std::memory_order_relaxed);
+    retVal.creations = creations.load(std::memory_order_relaxed);
+    retVal.lock_contentions = lockContentions.load(std::memory_order_relaxed);
+    retVal.lock_wait_ns = lockWaitNs.load(std::memory_order_relaxed);
+    return retVal;
+}
+
+const WeightsSharing::Shard& WeightsSharing::getShard(const std::string& key) const {
+    return shards[std::hash<std::string>{}(key) % numShards];
+}
+
+WeightsSharing::Shard& WeightsSharing::getShard(const std::string& key) {
+    return shards[std::hash<std::string>{}(key) % numShards];
+}
+
+std::unique_lock<std::mutex> WeightsSharing::lockAndCount(std::mutex& mutex) const {
+    return lockCounted<std::unique_lock<std::mutex>>(mutex, lockContentions, lockWaitNs);
+}
+
+std::unique_lock<std::shared_mutex> WeightsSharing::lockAndCount(std::shared_mutex& mutex) const {
+    return lockCounted<std::unique_lock<std::shared_mutex>>(mutex, lockContentions, lockWaitNs);
+}
+
+std::shared_lock<std::shared_mutex> WeightsSharing::lockSharedAndCount(std::shared_mutex& mutex) const {
+    return lockCounted<std::shared_lock<std::shared_mutex>>(mutex, lockContentions, lockWaitNs);
+}
+
+SocketsWeights::SocketsWeights(ReplicationPolicy policy,
+                               size_t byteBudget,
+                               const std::unordered_set<const void*>& hot) {
     int num_sockets = get_num_sockets();
-    for (int socket_id = 0; socket_id < num_sockets; socket_id++) {
-        _cache_map[socket_id] = std::make_shared<WeightsSharing>();
+    if (num_sockets < 2) {
+        policy = ReplicationPolicy::Full;
+    }
+    switch (policy) {
+    case ReplicationPolicy::Interleaved: {
+        auto singleCopy = std::make_shared<WeightsSharing>(true);
+        for (int socket_id = 0; socket_id < num_sockets; socket_id++) {
+            _cache_map[socket_id] = singleCopy;
+        }
+        break;
+    }
+    case ReplicationPolicy::Hot: {
+        _single_copy = std::make_shared<WeightsSharing>(true);
+        auto replication = std::make_shared<WeightsSharing::Replication>(_single_copy, byteBudget, hot);
+        for (int socket_id = 0; socket_id < num_sockets; socket_id++) {
+            _cache_map[socket_id] = std::make_shared<WeightsSharing>(replication);
+        }
+        break;
+    }
+    default:
+        for (int socket_id = 0; socket_id < num_sockets; socket_id++) {
+            _cache_map[socket_id] = std::make_shared<WeightsSharing>();
+        }
     }
 }
 
@@ -110,17 +408,73 @@ const WeightsSharing::Ptr& SocketsWeights::operator[](int socket_id) const {
     return found->second;
 }
 
+void SocketsWeights::adopt(const std::string& key, const MemoryPtr& memory) {
+    if (_single_copy) {
+        _single_copy->adopt(key, memory);
+        return;
+    }
+    std::set<const WeightsSharing*> visited;
+    for (auto& item : _cache_map) {
+        if (item.second && visited.insert(item.second.get()).second) {
+            item.second->adopt(key, memory);
+        }
+    }
+}
+
+std::vector<std::pair<std::string, MemoryPtr>> SocketsWeights::getValidEntries() const {
+    std::vector<std::pair<std::string, MemoryPtr>> retVal;
+    std::set<std::string> keys;
+    auto collect = [&](const WeightsSharing::Ptr& cache) {
+        for (auto& entry : cache->getValidEntries()) {
+            if (keys.insert(entry.first).second) {
+                retVal.push_back(std::move(entry));
+            }
+        }
+    };
+    if (_single_copy) {
+        collect(_single_copy);
+    }
+    std::set<const WeightsSharing*> visited;
+    for (const auto& item : _cache_map) {
+        if (item.second && visited.insert(item.second.get()).second) {
+            collect(item.second);
+        }
+    }
+    return retVal;
+}
+
+WeightsSharing::ContentionStatistics SocketsWeights::getContentionStatistics() const {
+    WeightsSharing::ContentionStatistics retVal;
+    std::set<const WeightsSharing*> visited;
+    for (const auto& item : _cache_map) {
+        // the single copy cache may be shared by several sockets
+        if (item.second && visited.insert(item.second.get()).second) {
+            retVal += item.second->getContentionStatistics();
+        }
+    }
+    if (_single_copy) {
+        retVal += _single_copy->getContentionStatistics();
+    }
+    return retVal;
+}
+
+size_t SocketsWeights::getReplicaBytes() const {
+    return _cache_map.empty() || !_cache_map.begin()->second ? 0 : _cache_map.begin()->second->getReplicaBytes();
+}
+
 #ifdef CPU_DEBUG_CAPS
 WeightsSharing::Statistics WeightsSharing::dumpStatistics() const {
     Statistics retVal = {0, 0};
 
-    std::lock_guard<std::mutex> lock(guard);
+    for (const auto& shard : shards) {
+        std::shared_lock<std::shared_mutex> lock(shard.guard);
 
-    for (const auto& item : sharedWeights) {
-        auto memory = item.second->sharedMemory.lock();
-        if (memory) {
-            retVal.total_size += memory->getDesc().getCurrentMemSize();
-            retVal.total_memory_objects++;
+        for (const auto& item : shard.sharedWeights) {
+            auto memory = item.second->sharedMemory.lock();
+            if (memory) {
+                retVal.total_size += memory->getDesc().getCurrentMemSize();
+                retVal.total_memory_objects++;
+            }
         }
     }
 
@@ -4,14 +4,18 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -28,7 +32,10 @@ namespace ov::intel_cpu {
  * Caching store of Memory objects
  * Will return a cached object or create new one
  *
- * Is a thread safe
+ * Is a thread safe. The keys are spread over independently locked shards and the shard lock is held only for
+ * the hash map lookup, so the memory objects of different keys are created (e.g. repacked) in parallel.
+ * The lookups of the existing entries take the shard lock in the shared mode, the exclusive lock is taken only to
+ * insert or replace an entry. Concurrent requests of the same key wait for the single creation on the entry lock.
  */
 class WeightsSharing {
     struct MemoryInfo {
@@ -37,8 +44,11 @@ class WeightsSharing {
         MemoryInfo(const MemoryPtr& memoryPtr, bool valid) : sharedMemory(memoryPtr), valid(valid) {}
 
         std::mutex guard;
+        // sharedMemory and pending are modified under the exclusive shard lock only
         std::weak_ptr<IMemory> sharedMemory;
         std::atomic<bool> valid;
+        // the memory object is being created by another thread, which holds the guard
+        bool pending = false;
     };
 
 public:
@@ -49,8 +59,86 @@ public:
     };
 #endif  // CPU_DEBUG_CAPS
 
+    struct ContentionStatistics {
+        uint64_t lookups = 0;
+        uint64_t creations = 0;
+        uint64_t lock_contentions = 0;  // number of the shard or entry locks which were not acquired immediately
+        uint64_t lock_wait_ns = 0;      // total time spent waiting for the contended locks
+
+        ContentionStatistics& operator+=(const ContentionStatistics& rhs) {
+            lookups += rhs.lookups;
+            creations += rhs.creations;
+            lock_contentions += rhs.lock_contentions;
+            lock_wait_ns += rhs.lock_wait_ns;
+            return *this;
+        }
+    };
+
     using Ptr = std::shared_ptr<WeightsSharing>;
 
+    /**
+     * Control block of the weights replication between the sockets. The weights are created in a single copy by the
+     * first requesting socket. The weights created from the data of the hot constants are replicated to the other
+     * requesting sockets while the replicas fit into the byte budget, as well as the weights derived from them
+     * (e.g. the repacked copies of the replicated constants).
+     */
+    struct Replication {
+        using Ptr = std::shared_ptr<Replication>;
+
+        enum class Source : uint8_t {
+            Cold,     // the weights are kept in the single copy
+            Hot,      // the weights are replicated to every requesting socket
+            Replica,  // the data of a socket local replica, the derived weights are local as well
+        };
+
+        Replication(WeightsSharing::Ptr singleCopy, size_t byteBudget, std::unordered_set<const void*> hot)
+            : singleCopy(std::move(singleCopy)),
+              byteBudget(byteBudget),
+              hotConstants(std::move(hot)) {}
+
+        bool reserve(size_t size);
+        void release(size_t size);
+        // accounts the size without the budget check
+        void charge(size_t size);
+
+        [[nodiscard]] Source classify(const void* data) const;
+        /**
+         * @brief Marks the data of the memory object as the source of the derived weights. The mark is dropped once
+         * the memory object is released, so a new allocation at the same address is not misclassified.
+         */
+        void mark(const MemoryPtr& memory, Source source);
+
+        WeightsSharing::Ptr singleCopy;
+        size_t byteBudget;
+        std::atomic<size_t> usedBytes{0};
+
+    private:
+        struct MarkedSource {
+            std::weak_ptr<IMemory> memory;
+            Source source;
+        };
+
+        // erases the marks of the released memory objects, called under sourcesGuard
+        void prune() const;
+
+        // the data of the hot model constants, fixed once the compiled model is created
+        const std::unordered_set<const void*> hotConstants;
+        mutable std::mutex sourcesGuard;
+        mutable std::unordered_map<const void*, MarkedSource> sources;
+        // the number of the marks left by the last pruning, the next one is done once it doubles
+        mutable size_t prunedSize = 0;
+    };
+
+    WeightsSharing() = default;
+    /**
+     * @param interleave spread the pages of the created memory objects over all the numa nodes
+     */
+    explicit WeightsSharing(bool interleave) : interleave(interleave) {}
+    /**
+     * @param replication the replication control block shared by the caches of all the sockets
+     */
+    explicit WeightsSharing(Replication::Ptr replication) : replication(std::move(replication)) {}
+
     class SharedMemory {
     public:
         using Ptr = std::shared_ptr<SharedMemory>;
@@ -67,19 +155,68 @@ public:
         MemoryPtr newPtr;
     };
 
+    /**
+     * @param source the data the weights are created from, decides whether the weights are replicated between the
+     * sockets in the Hot replication mode. The weights with an unknown source are kept in the single copy.
+     */
     SharedMemory::Ptr findOrCreate(const std::string& key,
                                    const std::function<MemoryPtr(void)>& create,
-                                   bool valid = true);
+                                   bool valid = true,
+                                   const void* source = nullptr);
 
     SharedMemory::Ptr get(const std::string& key) const;
 
+    /**
+     * @brief Stores the ready memory object with the key, unless the key already refers to an alive memory object.
+     * The caller keeps the memory object alive.
+     */
+    void adopt(const std::string& key, const MemoryPtr& memory);
+
+    /**
+     * @return the alive memory objects with valid content
+     */
+    [[nodiscard]] std::vector<std::pair<std::string, MemoryPtr>> getValidEntries() const;
+
+    /**
+     * @return the total size of the weights replicated to the sockets, zero if the replication is not used
+     */
+    [[nodiscard]] size_t getReplicaBytes() const;
+
+    [[nodiscard]] ContentionStatistics getContentionStatistics() const;
+
 #ifdef CPU_DEBUG_CAPS
     Statistics dumpStatistics() const;
 #endif  // CPU_DEBUG_CAPS
 
 protected:
-    mutable std::mutex guard;
-    std::unordered_map<std::string, MemoryInfo::Ptr> sharedWeights;
+    static constexpr size_t numShards = 64;
+
+    struct Shard {
+        mutable std::shared_mutex guard;
+        std::unordered_map<std::string, MemoryInfo::Ptr> sharedWeights;
+    };
+
+    [[nodiscard]] const Shard& getShard(const std::string& key) const;
+    Shard& getShard(const std::string& key);
+    // locks the mutex and accounts the waiting time if the mutex is owned by another thread
+    std::unique_lock<std::mutex> lockAndCount(std::mutex& mutex) const;
+    std::unique_lock<std::shared_mutex> lockAndCount(std::shared_mutex& mutex) const;
+    std::shared_lock<std::shared_mutex> lockSharedAndCount(std::shared_mutex& mutex) const;
+    SharedMemory::Ptr findOrCreateImpl(const std::string& key,
+                                       const std::function<MemoryPtr(void)>& create,
+                                       bool valid,
+                                       bool* created = nullptr);
+    // returns nullptr if there is no alive memory object with the key
+    SharedMemory::Ptr find(const std::string& key) const;
+
+    std::array<Shard, numShards> shards;
+    bool interleave = false;
+    Replication::Ptr replication;
+
+    mutable std::atomic<uint64_t> lookups{0};
+    mutable std::atomic<uint64_t> creations{0};
+    mutable std::atomic<uint64_t> lockContentions{0};
+    mutable std::atomic<uint64_t> lockWaitNs{0};
 };
 
 /**
@@ -89,17 +226,46 @@ protected:
  */
 class SocketsWeights {
 public:
-    SocketsWeights();
+    enum class ReplicationPolicy : uint8_t {
+        Full,         // every socket has its own copy of all the weights
+        Interleaved,  // a single copy of the weights with the pages interleaved over the numa nodes
+        Hot,          // an interleaved single copy plus the replicas of the large weights within a byte budget
+    };
+
+    /**
+     * @param policy weights replication policy
+     * @param byteBudget maximum total size of the per socket replicas in the Hot mode
+     * @param hot the data of the constants replicated in the Hot mode
+     */
+    explicit SocketsWeights(ReplicationPolicy policy = ReplicationPolicy::Full,
+                            size_t byteBudget = 0,
+                            const std::unordered_set<const void*>& hot = {});
 
     WeightsSharing::Ptr& operator[](int socket_id);
     const WeightsSharing::Ptr& operator[](int socket_id) const;
 
+    /**
+     * @brief Stores the ready memory object in the caches of all the sockets (in the single copy in the Hot mode)
+     */
+    void adopt(const std::string& key, const MemoryPtr& memory);
+
+    /**
+     * @return the alive memory objects with valid content of all the sockets, a single object per key
+     */
+    [[nodiscard]] std::vector<std::pair<std::string, MemoryPtr>> getValidEntries() const;
+
+    [[nodiscard]] WeightsSharing::ContentionStatistics getContentionStatistics() const;
+
+    [[nodiscard]] size_t getReplicaBytes() const;
+
 #ifdef CPU_DEBUG_CAPS
     [[nodiscard]] std::vector<std::pair<int, WeightsSharing::Statistics>> dumpStatistics() const;
 #endif  // CPU_DEBUG_CAPS
 
 private:
     std::map<int, WeightsSharing::Ptr> _cache_map;
+    // the single copy of the weights in the Hot mode
+    WeightsSharing::Ptr _single_copy;
 };
 
 }  // namespace ov::intel_cpu
@@ -542,4 +542,33 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuModelDistributionPolicyTensorParallel) {
     ASSERT_EQ(enable_tensor_parallel, true);
 }
 
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkInferRequestPriority) {
+    ov::Core core;
+    ov::CompiledModel compiledModel = core.compile_model(model, deviceName, ov::num_streams(1));
+    ASSERT_EQ(compiledModel.get_property(ov::intel_cpu::cpu_infer_request_priority), ov::hint::Priority::MEDIUM);
+
+    // the priority applies to the requests created after it is set
+    auto mediumRequest = compiledModel.create_infer_request();
+    OV_ASSERT_NO_THROW(compiledModel.set_property(ov::intel_cpu::cpu_infer_request_priority(ov::hint::Priority::HIGH)));
+    ASSERT_EQ(compiledModel.get_property(ov::intel_cpu::cpu_infer_request_priority), ov::hint::Priority::HIGH);
+    auto highRequest = compiledModel.create_infer_request();
+    ASSERT_THROW(compiledModel.set_property(ov::num_streams(2)), ov::Exception);
+
+    const auto enqueued = [&](const std::string& lane) {
+        const auto statistics = compiledModel.get_property(ov::intel_cpu::cpu_task_queue_statistics);
+        const auto found = statistics.find(lane + "_enqueued");
+        return found == statistics.end() ? uint64_t{0} : found->second;
+    };
+    const auto highEnqueued = enqueued("HIGH");
+    const auto mediumEnqueued = enqueued("MEDIUM");
+    // the synchronous inferences run in the calling thread, only the asynchronous ones are queued
+    highRequest.start_async();
+    highRequest.wait();
+    ASSERT_GT(enqueued("HIGH"), highEnqueued);
+    ASSERT_EQ(enqueued("MEDIUM"), mediumEnqueued);
+    mediumRequest.start_async();
+    mediumRequest.wait();
+    ASSERT_GT(enqueued("MEDIUM"), mediumEnqueued);
+}
+
 }  // namespace
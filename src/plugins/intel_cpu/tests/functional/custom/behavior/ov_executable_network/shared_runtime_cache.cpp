@@ -0,0 +1,78 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/scaled_dot_product_attention.hpp"
+#include "openvino/runtime/core.hpp"
+
+namespace ov {
+namespace test {
+namespace {
+std::shared_ptr<ov::Model> make_sdpa_model() {
+    const ov::PartialShape shape{1, 4, -1, 32};
+    auto q = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+    auto k = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+    auto v = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+    auto sdpa = std::make_shared<ov::op::v13::ScaledDotProductAttention>(q, k, v, false);
+    return std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(sdpa)},
+                                       ov::ParameterVector{q, k, v});
+}
+}  // namespace
+
+// The streams sharing the runtime cache execute the dynamic SDPA at the same time, every request must get the results
+// of its own inputs, whatever the other streams do with their executors
+TEST(SharedRuntimeCacheTest, ConcurrentDynamicSDPA) {
+    constexpr size_t num_requests = 4;
+    constexpr size_t num_iterations = 16;
+    const auto model = make_sdpa_model();
+    ov::Core core;
+    auto reference_model = core.compile_model(model,
+                                              "CPU",
+                                              {ov::num_streams(1), ov::hint::inference_precision(ov::element::f32)});
+    auto shared_model = core.compile_model(model,
+                                           "CPU",
+                                           {ov::num_streams(static_cast<int>(num_requests)),
+                                            ov::hint::inference_precision(ov::element::f32),
+                                            ov::intel_cpu::cpu_runtime_cache_shared(true)});
+    auto reference_request = reference_model.create_infer_request();
+    std::vector<ov::InferRequest> requests;
+    for (size_t i = 0; i < num_requests; ++i) {
+        requests.push_back(shared_model.create_infer_request());
+    }
+
+    for (size_t iteration = 0; iteration < num_iterations; ++iteration) {
+        std::vector<ov::Tensor> expected;
+        for (size_t i = 0; i < num_requests; ++i) {
+            // a few sequence lengths, so the streams hit the same cache records at once
+            const ov::Shape shape{1, 4, 16 * (1 + (iteration + i) % 3), 32};
+            for (size_t input = 0; input < model->inputs().size(); ++input) {
+                const auto seed = static_cast<int32_t>(iteration * num_requests * 3 + i * 3 + input);
+                const ov::test::utils::InputGenerateData data(-1, 2, 64, seed);
+                auto tensor = ov::test::utils::create_and_fill_tensor(ov::element::f32, shape, data);
+                requests[i].set_input_tensor(input, tensor);
+                reference_request.set_input_tensor(input, tensor);
+            }
+            reference_request.infer();
+            const auto& output = reference_request.get_output_tensor();
+            expected.emplace_back(output.get_element_type(), output.get_shape());
+            output.copy_to(expected.back());
+        }
+
+        for (auto& request : requests) {
+            request.start_async();
+        }
+        for (size_t i = 0; i < num_requests; ++i) {
+            requests[i].wait();
+            ov::test::utils::compare(expected[i], requests[i].get_output_tensor(), ov::element::f32, 1e-5, 1e-5);
+        }
+    }
+}
+
+}  // namespace test
+}  // namespace ov
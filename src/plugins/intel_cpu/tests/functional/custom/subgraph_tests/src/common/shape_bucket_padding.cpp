@@ -0,0 +1,98 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/ov_plugin_cache.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/softmax.hpp"
+#include "openvino/op/transpose.hpp"
+#include "openvino/op/unsqueeze.hpp"
+
+namespace ov {
+namespace test {
+
+namespace {
+// the softmax normalizes along the second dimension, so padding anything but the batch changes the results
+std::shared_ptr<ov::Model> make_softmax_model() {
+    auto param = std::make_shared<ov::op::v0::Parameter>(element::f32, ov::PartialShape{-1, -1});
+    auto softmax = std::make_shared<ov::op::v8::Softmax>(param, 1);
+    auto result = std::make_shared<ov::op::v0::Result>(softmax);
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+}
+
+// the batch is the second dimension of the first output and the last one of the second output
+std::shared_ptr<ov::Model> make_moved_batch_model() {
+    auto param = std::make_shared<ov::op::v0::Parameter>(element::f32, ov::PartialShape{-1, -1});
+    auto softmax = std::make_shared<ov::op::v8::Softmax>(param, 1);
+    auto axis = ov::op::v0::Constant::create(element::i64, ov::Shape{1}, {0});
+    auto unsqueeze = std::make_shared<ov::op::v0::Unsqueeze>(softmax, axis);
+    auto order = ov::op::v0::Constant::create(element::i64, ov::Shape{2}, {1, 0});
+    auto transpose = std::make_shared<ov::op::v1::Transpose>(softmax, order);
+    return std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(unsqueeze),
+                                                        std::make_shared<ov::op::v0::Result>(transpose)},
+                                       ov::ParameterVector{param});
+}
+}  // namespace
+
+TEST(ShapeBucketPadding, ResultsMatchUnpaddedInference) {
+    auto core = ov::test::utils::PluginCache::get().core();
+    auto model = make_softmax_model();
+    auto reference = core->compile_model(model, "CPU").create_infer_request();
+    auto padded = core->compile_model(model,
+                                      "CPU",
+                                      {{ov::intel_cpu::cpu_shape_buckets.name(), "[4,16]|[8,16]"},
+                                       {ov::intel_cpu::cpu_shape_bucket_padding.name(), true}})
+                      .create_infer_request();
+
+    // the batch is padded to 4 and 8, the shapes with other dimensions different from the buckets are not padded
+    for (const auto& shape : std::vector<ov::Shape>{{3, 16}, {5, 16}, {3, 16}, {3, 12}, {9, 16}, {8, 16}}) {
+        auto input = ov::test::utils::create_and_fill_tensor(element::f32, shape);
+        reference.set_input_tensor(input);
+        reference.infer();
+        padded.set_input_tensor(input);
+        padded.infer();
+
+        const auto expected = reference.get_output_tensor();
+        const auto actual = padded.get_output_tensor();
+        ASSERT_EQ(actual.get_shape(), shape);
+        ASSERT_EQ(padded.get_input_tensor().data(), input.data());
+        ov::test::utils::compare(expected, actual, 1e-6, 1e-6);
+    }
+}
+
+// the batch axes of the outputs are found by the shape propagation, not by the value of the first dimension: the
+// transposed output can't be cropped in place, so the inputs are not padded rather than cropped along a wrong axis
+TEST(ShapeBucketPadding, OutputBatchAxesFollowShapePropagation) {
+    auto core = ov::test::utils::PluginCache::get().core();
+    auto model = make_moved_batch_model();
+    auto reference = core->compile_model(model, "CPU").create_infer_request();
+    auto padded = core->compile_model(model,
+                                      "CPU",
+                                      {{ov::intel_cpu::cpu_shape_buckets.name(), "[16,16]"},
+                                       {ov::intel_cpu::cpu_shape_bucket_padding.name(), true}})
+                      .create_infer_request();
+
+    // the first dimension of the transposed output equals the bucket batch, but it is not the batch
+    const ov::Shape shape{3, 16};
+    auto input = ov::test::utils::create_and_fill_tensor(element::f32, shape);
+    reference.set_input_tensor(input);
+    reference.infer();
+    padded.set_input_tensor(input);
+    padded.infer();
+
+    for (size_t i = 0; i < model->outputs().size(); ++i) {
+        const auto expected = reference.get_output_tensor(i);
+        const auto actual = padded.get_output_tensor(i);
+        ASSERT_EQ(actual.get_shape(), expected.get_shape());
+        ov::test::utils::compare(expected, actual, 1e-6, 1e-6);
+    }
+}
+
+}  // namespace test
+}  // namespace ov
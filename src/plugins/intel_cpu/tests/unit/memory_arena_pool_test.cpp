@@ -0,0 +1,50 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <utility>
+
+#include "memory_control.hpp"
+
+using namespace ov::intel_cpu;
+
+TEST(MemoryArenaPoolTest, ArenasAreReused) {
+    MemoryArenaPool pool(2);
+    auto first = pool.acquire(1024);
+    auto* ptr = first->getRawPtr();
+    ASSERT_NE(ptr, nullptr);
+    pool.release(std::move(first));
+
+    // the idle arena is reused and grown if needed
+    auto second = pool.acquire(512);
+    ASSERT_EQ(second->getRawPtr(), ptr);
+    auto third = pool.acquire(2048);
+    ASSERT_GE(third->size(), 2048);
+    ASSERT_EQ(pool.arenas(), 2);
+    ASSERT_EQ(pool.footprint(), 1024 + 2048);
+
+    pool.release(std::move(second));
+    pool.release(std::move(third));
+    auto large = pool.acquire(1500);
+    ASSERT_GE(large->size(), 2048);
+    pool.release(std::move(large));
+    ASSERT_EQ(pool.arenas(), 2);
+
+    pool.clear();
+    ASSERT_EQ(pool.arenas(), 0);
+    ASSERT_EQ(pool.footprint(), 0);
+}
+
+TEST(MemoryArenaPoolTest, ExtraIdleArenasAreFreed) {
+    MemoryArenaPool pool(1);
+    auto first = pool.acquire(256);
+    auto second = pool.acquire(256);
+    ASSERT_EQ(pool.arenas(), 2);
+
+    pool.release(std::move(first));
+    pool.release(std::move(second));
+    ASSERT_EQ(pool.arenas(), 1);
+    ASSERT_EQ(pool.footprint(), 256);
+}
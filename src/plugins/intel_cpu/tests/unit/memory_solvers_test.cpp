@@ -0,0 +1,80 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "config.h"
+#include "memory_solvers.hpp"
+#include "openvino/runtime/memory_solver.hpp"
+
+using namespace ov::intel_cpu;
+using Box = ov::MemorySolver::Box;
+
+namespace {
+void checkSolution(const std::vector<Box>& boxes, const IMemorySolver::Offsets& offsets, int64_t total) {
+    int maxFinish = 0;
+    for (const auto& box : boxes) {
+        maxFinish = std::max({maxFinish, box.start, box.finish});
+    }
+    auto finish = [&](const Box& box) {
+        return box.finish == -1 ? maxFinish : box.finish;
+    };
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        const auto& l = boxes[i];
+        ASSERT_LE(offsets.at(l.id) + l.size, total);
+        for (size_t j = i + 1; j < boxes.size(); ++j) {
+            const auto& r = boxes[j];
+            if (l.start <= finish(r) && r.start <= finish(l)) {
+                const bool disjoint =
+                    offsets.at(l.id) + l.size <= offsets.at(r.id) || offsets.at(r.id) + r.size <= offsets.at(l.id);
+                ASSERT_TRUE(disjoint) << "boxes " << l.id << " and " << r.id << " overlap";
+            }
+        }
+    }
+}
+}  // namespace
+
+TEST(MemorySolversTest, LowerBound) {
+    //  |        |____|             Box {4, 5}
+    //  |  |_____________|          Box {2, 6}
+    //  |     |____|                Box {3, 4}
+    //  |  |____|                   Box {2, 3}
+    //  |              |____|       Box {6, 7}
+    std::vector<Box> boxes{{4, 5, 1, 0}, {2, 6, 1, 1}, {3, 4, 1, 2}, {2, 3, 1, 3}, {6, 7, 1, 4}};
+    ASSERT_EQ(memoryLowerBound(boxes), 3);
+}
+
+TEST(MemorySolversTest, AllSolversProduceValidSolutions) {
+    std::mt19937 rng(7);
+    for (int iteration = 0; iteration < 50; ++iteration) {
+        std::vector<Box> boxes;
+        const int count = 5 + static_cast<int>(rng() % 40);
+        for (int i = 0; i < count; ++i) {
+            const int start = static_cast<int>(rng() % 50);
+            const int finish = rng() % 10 == 0 ? -1 : start + static_cast<int>(rng() % 10);
+            boxes.push_back({start, finish, static_cast<int64_t>(1 + rng() % 100), i});
+        }
+        const auto lowerBound = memoryLowerBound(boxes);
+
+        int64_t greedyTotal = 0;
+        for (auto type : {Config::MemorySolverType::Greedy,
+                          Config::MemorySolverType::BestFit,
+                          Config::MemorySolverType::MultiOrder}) {
+            IMemorySolver::Offsets offsets;
+            const auto total = createMemorySolver(type)->solve(boxes, offsets);
+            ASSERT_GE(total, lowerBound);
+            checkSolution(boxes, offsets, total);
+            if (type == Config::MemorySolverType::Greedy) {
+                greedyTotal = total;
+            } else if (type == Config::MemorySolverType::MultiOrder) {
+                ASSERT_LE(total, greedyTotal);
+            }
+        }
+    }
+}
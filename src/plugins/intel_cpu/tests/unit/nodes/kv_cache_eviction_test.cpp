@@ -0,0 +1,198 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "nodes/kernels/scaled_attn/kv_cache_eviction.hpp"
+#include "openvino/core/except.hpp"
+#include "openvino/runtime/make_tensor.hpp"
+
+using namespace ov::Extensions::Cpu;
+
+namespace {
+constexpr size_t block_size = 4;
+
+void set_sequence_ids(KVCacheEvictionState& state, const std::vector<int64_t>& ids) {
+    auto tensor = ov::make_tensor(ov::element::i64, ov::Shape{ids.size()});
+    std::copy(ids.begin(), ids.end(), tensor->data<int64_t>());
+    state.set_state(tensor);
+}
+
+std::vector<int64_t> evicted_blocks(const KVCacheEvictionState& state) {
+    auto tensor = state.get_state();
+    EXPECT_EQ(tensor->get_element_type(), ov::element::i64);
+    EXPECT_EQ(tensor->get_shape().back(), 2);
+    const auto* data = tensor->data<const int64_t>();
+    return {data, data + tensor->get_size()};
+}
+
+// the inputs of the PagedAttention operations of one inference
+struct Batch {
+    std::vector<int32_t> past_lens;
+    std::vector<int32_t> subsequence_begins{0};
+    std::vector<int32_t> block_indices;
+    std::vector<int32_t> block_indices_begins{0};
+
+    void add(int32_t past_len, int32_t q_len, const std::vector<int32_t>& blocks) {
+        past_lens.push_back(past_len);
+        subsequence_begins.push_back(subsequence_begins.back() + q_len);
+        block_indices.insert(block_indices.end(), blocks.begin(), blocks.end());
+        block_indices_begins.push_back(static_cast<int32_t>(block_indices.size()));
+    }
+
+    const std::vector<int32_t>& bind(KVCacheEvictionState& state) const {
+        return state.bind(past_lens.data(),
+                          subsequence_begins.data(),
+                          block_indices.data(),
+                          block_indices_begins.data(),
+                          past_lens.size(),
+                          block_size);
+    }
+};
+}  // namespace
+
+TEST(KVCacheEvictionTest, DisabledWithoutBudget) {
+    KVCacheEvictor evictor({KVCacheEvictionMode::H2O, 0}, block_size);
+    ASSERT_FALSE(evictor.enabled());
+    KVCacheEvictor none({KVCacheEvictionMode::NONE, 16}, block_size);
+    ASSERT_FALSE(none.enabled());
+}
+
+TEST(KVCacheEvictionTest, SlidingWindowKeepsFirstAndRecentBlocks) {
+    // 4 blocks budget: the first block and one recent block are never evicted
+    KVCacheEvictor evictor({KVCacheEvictionMode::SLIDING_WINDOW, 16}, block_size);
+    ASSERT_TRUE(evictor.enabled());
+    ASSERT_FALSE(evictor.needs_scores());
+
+    KVCacheEvictor::Sequence sequence;
+    evictor.accumulate(sequence, nullptr, 19, 19);
+    ASSERT_TRUE(evictor.select(sequence, 19).empty());
+
+    evictor.accumulate(sequence, nullptr, 24, 5);
+    const auto evicted = evictor.select(sequence, 24);
+    ASSERT_EQ(evicted, (std::vector<size_t>{1, 2}));
+    evictor.evict(sequence, evicted);
+    ASSERT_EQ(sequence.scores.size(), 16);
+}
+
+TEST(KVCacheEvictionTest, H2OEvictsLowestScoredBlocks) {
+    KVCacheEvictor evictor({KVCacheEvictionMode::H2O, 16}, block_size);
+    ASSERT_TRUE(evictor.needs_scores());
+    ASSERT_EQ(evictor.score_window(7), 7);
+
+    KVCacheEvictor::Sequence sequence;
+    std::vector<float> scores(24, 1.0F);
+    // block 2 is the heavy hitter, block 5 is recent
+    for (size_t i = 8; i < 12; i++) {
+        scores[i] = 10.0F;
+    }
+    evictor.accumulate(sequence, scores.data(), scores.size(), scores.size());
+    const auto evicted = evictor.select(sequence, 24);
+    ASSERT_EQ(evicted, (std::vector<size_t>{1, 3}));
+    evictor.evict(sequence, evicted);
+    ASSERT_EQ(sequence.scores.size(), 16);
+    ASSERT_EQ(sequence.scores[4], 10.0F);
+}
+
+TEST(KVCacheEvictionTest, SnapKVRanksByPromptOnly) {
+    KVCacheEvictor evictor({KVCacheEvictionMode::SNAPKV, 16}, block_size);
+    ASSERT_EQ(evictor.score_window(100), KVCacheEvictor::snapkv_window);
+    ASSERT_EQ(evictor.score_window(1), 0);
+
+    KVCacheEvictor::Sequence sequence;
+    std::vector<float> scores(20, 1.0F);
+    evictor.accumulate(sequence, scores.data(), scores.size(), scores.size());
+    // the generated tokens don't change the ranking
+    std::vector<float> generated(21, 5.0F);
+    evictor.accumulate(sequence, generated.data(), generated.size(), 1);
+    ASSERT_EQ(sequence.scores.size(), 21);
+    ASSERT_EQ(sequence.scores[0], 1.0F);
+    ASSERT_EQ(sequence.scores[20], 0.0F);
+}
+
+TEST(KVCacheEvictionTest, StateRequiresSequenceIds) {
+    KVCacheEvictionState state("kv_cache_eviction", {KVCacheEvictionMode::SLIDING_WINDOW, 16});
+    Batch batch;
+    batch.add(0, 8, {0, 1});
+    state.start();
+    ASSERT_THROW(batch.bind(state), ov::Exception);
+    ASSERT_THROW(set_sequence_ids(state, {1, 1}), ov::Exception);
+}
+
+TEST(KVCacheEvictionTest, StateReportsBlocksPerSequence) {
+    KVCacheEvictionState state("kv_cache_eviction", {KVCacheEvictionMode::SLIDING_WINDOW, 16});
+    Batch batch;
+    batch.add(0, 24, {10, 11, 12, 13, 14, 15});
+    batch.add(0, 8, {20, 21});
+    set_sequence_ids(state, {7, 9});
+    state.start();
+    // every operation binds, only the first one has effect
+    ASSERT_TRUE(batch.bind(state).empty());
+    ASSERT_TRUE(batch.bind(state).empty());
+    state.evict();
+
+    // only the long sequence is evicted, the block indices come from its block table
+    ASSERT_EQ(evicted_blocks(state), (std::vector<int64_t>{7, 11, 7, 12}));
+    ASSERT_EQ(state.num_sequences(), 2);
+
+    // the application removes the evicted blocks and shortens the past length, the cache is left as is
+    Batch next;
+    next.add(16, 1, {10, 13, 14, 15, 16});
+    next.add(8, 1, {20, 21, 22});
+    set_sequence_ids(state, {7, 9});
+    state.start();
+    ASSERT_TRUE(evicted_blocks(state).empty());
+    next.bind(state);
+    state.evict();
+    ASSERT_TRUE(evicted_blocks(state).empty());
+}
+
+TEST(KVCacheEvictionTest, StateRanksSharedPrefixPerSequence) {
+    KVCacheEvictionState state("kv_cache_eviction", {KVCacheEvictionMode::H2O, 16});
+    // the sequences share the prefix blocks 0-3 and differ in the heavy hitter block
+    Batch batch;
+    batch.add(0, 24, {0, 1, 2, 3, 4, 5});
+    batch.add(0, 24, {0, 1, 2, 3, 6, 7});
+    set_sequence_ids(state, {1, 2});
+    state.start();
+    const auto windows = batch.bind(state);
+    ASSERT_EQ(windows, (std::vector<int32_t>{24, 24}));
+
+    std::vector<float> first(24, 1.0F);
+    std::vector<float> second(24, 1.0F);
+    std::fill(first.begin() + 4, first.begin() + 8, 10.0F);
+    std::fill(second.begin() + 12, second.begin() + 16, 10.0F);
+    // two operations, the scores are summed
+    for (int layer = 0; layer < 2; layer++) {
+        state.accumulate(0, first.data());
+        state.accumulate(1, second.data());
+    }
+    state.evict();
+
+    // every sequence drops its own references to the shared blocks, which stay in the cache for the other one
+    ASSERT_EQ(evicted_blocks(state), (std::vector<int64_t>{1, 2, 1, 3, 2, 1, 2, 2}));
+}
+
+TEST(KVCacheEvictionTest, StateErasesFinishedSequences) {
+    KVCacheEvictionState state("kv_cache_eviction", {KVCacheEvictionMode::H2O, 16});
+    Batch batch;
+    batch.add(0, 8, {0, 1});
+    batch.add(0, 8, {2, 3});
+    set_sequence_ids(state, {1, 2});
+    state.start();
+    batch.bind(state);
+    state.evict();
+    ASSERT_EQ(state.num_sequences(), 2);
+
+    set_sequence_ids(state, {2});
+    ASSERT_EQ(state.num_sequences(), 1);
+
+    state.reset();
+    ASSERT_EQ(state.num_sequences(), 0);
+}
@@ -0,0 +1,140 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "graph_context.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "openvino/core/except.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/runtime/aligned_buffer.hpp"
+#include "utils/graph_serializer/prepacked_weights.hpp"
+#include "weights_cache.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+std::shared_ptr<ov::Model> createModel(float value) {
+    auto constant = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{16}, std::vector<float>(16, value));
+    constant->set_friendly_name("weights");
+    auto result = std::make_shared<ov::op::v0::Result>(constant);
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{});
+}
+
+std::string getAddress(const std::shared_ptr<ov::Model>& model) {
+    for (const auto& op : model->get_ordered_ops()) {
+        if (auto constant = ov::as_type_ptr<ov::op::v0::Constant>(op)) {
+            return std::to_string(reinterpret_cast<uintptr_t>(constant->get_data_ptr()));
+        }
+    }
+    return {};
+}
+
+MemoryPtr createPacked(float value) {
+    auto desc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape{16});
+    auto memory = std::make_shared<Memory>(GraphContext::getEngine(), desc);
+    auto* data = memory->getDataAs<float>();
+    for (size_t i = 0; i < 16; ++i) {
+        data[i] = value + static_cast<float>(i);
+    }
+    return memory;
+}
+
+void checkPacked(const MemoryPtr& memory, float value) {
+    ASSERT_EQ(memory->getSize(), 16 * sizeof(float));
+    const auto* data = memory->getDataAs<const float>();
+    for (size_t i = 0; i < 16; ++i) {
+        ASSERT_EQ(data[i], value + static_cast<float>(i));
+    }
+}
+}  // namespace
+
+TEST(PrepackedWeightsTest, StreamRoundTrip) {
+    auto exported = createModel(1.f);
+    auto packed = createPacked(10.f);
+    SocketsWeights cache;
+    cache.adopt("fc_0_12345_" + getAddress(exported), packed);
+    // the weights which keys do not refer to the constants are not stored
+    auto unknown = createPacked(20.f);
+    cache.adopt("fc_1_12345_1", unknown);
+
+    const auto weights = PrepackedWeights::collect(cache, exported);
+    ASSERT_EQ(weights.size(), 1);
+
+    std::stringstream stream;
+    stream << "header";
+    PrepackedWeights::write(stream, weights);
+    stream << "model";
+
+    stream.seekg(6);
+    char magic[8];
+    stream.read(magic, sizeof(magic));
+    ASSERT_TRUE(PrepackedWeights::has_section(magic, sizeof(magic)));
+    stream.seekg(6);
+
+    auto entries = PrepackedWeights::read(stream);
+    std::string rest;
+    stream >> rest;
+    ASSERT_EQ(rest, "model");
+
+    auto imported = createModel(1.f);
+    PrepackedWeights::resolve_keys(entries, imported);
+    ASSERT_EQ(entries.weights.size(), 1);
+    ASSERT_EQ(entries.weights[0].key, "fc_0_12345_" + getAddress(imported));
+    checkPacked(entries.weights[0].memory, 10.f);
+}
+
+TEST(PrepackedWeightsTest, TruncatedStreamThrows) {
+    auto exported = createModel(1.f);
+    SocketsWeights cache;
+    cache.adopt("fc_0_12345_" + getAddress(exported), createPacked(10.f));
+    std::stringstream stream;
+    PrepackedWeights::write(stream, PrepackedWeights::collect(cache, exported));
+
+    // the weights region is read straight into the memory object, so a short read must be detected
+    const auto section = stream.str();
+    std::stringstream truncated(section.substr(0, section.size() - sizeof(float)));
+    ASSERT_THROW(PrepackedWeights::read(truncated), ov::Exception);
+}
+
+TEST(PrepackedWeightsTest, BufferIsUsedInPlace) {
+    auto exported = createModel(1.f);
+    auto packed = createPacked(10.f);
+    SocketsWeights cache;
+    cache.adopt("fc_0_12345_" + getAddress(exported), packed);
+
+    std::stringstream stream;
+    PrepackedWeights::write(stream, PrepackedWeights::collect(cache, exported));
+    stream << "model";
+    const auto blob = stream.str();
+
+    auto buffer = std::make_shared<ov::AlignedBuffer>(blob.size(), 4096);
+    std::memcpy(buffer->get_ptr(), blob.data(), blob.size());
+    ASSERT_TRUE(PrepackedWeights::has_section(buffer->get_ptr<char>(), buffer->size()));
+
+    auto [entries, model_offset] = PrepackedWeights::read(buffer);
+    ASSERT_EQ(std::string(buffer->get_ptr<char>() + model_offset, buffer->size() - model_offset), "model");
+    ASSERT_EQ(entries.buffer, buffer);
+    ASSERT_EQ(entries.weights.size(), 1);
+
+    const auto* data = static_cast<const char*>(entries.weights[0].memory->getData());
+    ASSERT_GE(data, buffer->get_ptr<char>());
+    ASSERT_LT(data, buffer->get_ptr<char>() + model_offset);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(data) % 4096, 0);
+
+    auto imported = createModel(1.f);
+    PrepackedWeights::resolve_keys(entries, imported);
+    ASSERT_EQ(entries.weights.size(), 1);
+    checkPacked(entries.weights[0].memory, 10.f);
+}
@@ -7,8 +7,12 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include "cache/byte_budget.h"
+#include "cache/gds_cache.h"
+#include "cache/input_shapes_recorder.h"
 #include "cache/lru_cache.h"
 #include "cache/multi_cache.h"
+#include "cache/sharded_cache.h"
 #include "common_test_utils/test_assertions.hpp"
 
 using namespace ov::intel_cpu;
@@ -97,6 +101,204 @@ TEST(LruCacheTests, Empty) {
         ASSERT_EQ(cache.get({i}), int());
     }
 }
+TEST(LruCacheTests, EvictionCount) {
+    constexpr int capacity = 10;
+    LruCache<IntKey, int> cache(capacity);
+    for (int i = 0; i < 2 * capacity; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    ASSERT_EQ(cache.getSize(), static_cast<size_t>(capacity));
+    ASSERT_EQ(cache.getEvictionCount(), static_cast<size_t>(capacity));
+}
+
+TEST(ShardedLruCacheTests, PutGet) {
+    constexpr int capacity = 64;
+    constexpr size_t numShards = 4;
+    ShardedLruCache<IntKey, int> cache(capacity, numShards);
+    ASSERT_EQ(cache.getNumShards(), numShards);
+    for (int i = 0; i < capacity / 2; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 0; i < capacity / 2; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+    ASSERT_EQ(cache.get({capacity}), int());
+}
+
+TEST(ShardedLruCacheTests, CapacityLimit) {
+    constexpr int capacity = 16;
+    ShardedLruCache<IntKey, int> cache(capacity, 4);
+    for (int i = 0; i < 10 * capacity; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    ASSERT_LE(cache.getSize(), static_cast<size_t>(capacity));
+    ASSERT_EQ(cache.getSize() + cache.getEvictionCount(), static_cast<size_t>(10 * capacity));
+}
+
+TEST(ShardedLruCacheTests, Empty) {
+    constexpr int attempts = 10;
+    ShardedLruCache<IntKey, int> cache(0, 4);
+    ASSERT_EQ(cache.getCapacity(), 0);
+    for (int i = 1; i < attempts; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i < attempts; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+}
+
+TEST(GreedyDualSizeCacheTests, PutGet) {
+    constexpr int capacity = 10;
+    GreedyDualSizeCache<IntKey, int> cache(capacity);
+    for (int i = 1; i < 2 * capacity; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    ASSERT_EQ(cache.getSize(), static_cast<size_t>(capacity));
+    ASSERT_EQ(cache.getEvictionCount(), static_cast<size_t>(capacity - 1));
+    for (int i = capacity; i < 2 * capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+}
+
+TEST(GreedyDualSizeCacheTests, ExpensiveRecordsSurvive) {
+    constexpr int capacity = 10;
+    constexpr double expensive = 1000.0;
+    constexpr double cheap = 1.0;
+    GreedyDualSizeCache<IntKey, int> cache(capacity);
+    OV_ASSERT_NO_THROW(cache.put({-1}, -1, expensive));
+
+    // a burst of cheap records must not displace the expensive one
+    for (int i = 0; i < 5 * capacity; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i, cheap));
+    }
+    ASSERT_EQ(cache.get({-1}), -1);
+    ASSERT_EQ(cache.getSize(), static_cast<size_t>(capacity));
+}
+
+TEST(GreedyDualSizeCacheTests, LargeRecordsEvictedFirst) {
+    constexpr int capacity = 2;
+    constexpr double cost = 100.0;
+    GreedyDualSizeCache<IntKey, int> cache(capacity);
+    OV_ASSERT_NO_THROW(cache.put({0}, 0, cost, 1000));
+    OV_ASSERT_NO_THROW(cache.put({1}, 1, cost, 10));
+
+    // the records of the same cost are ranked by the cost per byte
+    OV_ASSERT_NO_THROW(cache.put({2}, 2, cost, 10));
+    ASSERT_EQ(cache.get({0}), int());
+    ASSERT_EQ(cache.get({1}), 1);
+    ASSERT_EQ(cache.getBytes(), 20);
+}
+
+TEST(GreedyDualSizeCacheTests, SharedByteBudget) {
+    constexpr int capacity = 100;
+    constexpr size_t recordSize = 64;
+    constexpr size_t limit = 10 * recordSize;
+    auto budget = std::make_shared<ByteBudget>(limit);
+    {
+        GreedyDualSizeCache<IntKey, int> cache0(capacity, budget);
+        GreedyDualSizeCache<IntKey, int> cache1(capacity, budget);
+        for (int i = 0; i < 20; ++i) {
+            OV_ASSERT_NO_THROW(cache0.put({i}, i, 1.0, recordSize));
+            OV_ASSERT_NO_THROW(cache1.put({i}, i, 1.0, recordSize));
+            ASSERT_LE(budget->getBytes(), limit);
+            // an exhausted budget makes room for the new record instead of rejecting it
+            ASSERT_EQ(cache0.get({i}), i);
+            ASSERT_EQ(cache1.get({i}), i);
+        }
+        // the records of equal cost are shared evenly, none of the caches is flushed by the other one
+        ASSERT_EQ(cache0.getBytes(), limit / 2);
+        ASSERT_EQ(cache1.getBytes(), limit / 2);
+        ASSERT_EQ(budget->getBytes(), limit);
+
+        {
+            GreedyDualSizeCache<IntKey, int> cache2(capacity, budget);
+            OV_ASSERT_NO_THROW(cache2.put({0}, 0, 1.0, recordSize));
+            ASSERT_EQ(budget->getBytes(), limit);
+        }
+        ASSERT_EQ(budget->getBytes(), cache0.getBytes() + cache1.getBytes());
+    }
+    ASSERT_EQ(budget->getBytes(), 0);
+}
+
+TEST(GreedyDualSizeCacheTests, ByteBudgetEvictsCheapestRecord) {
+    constexpr int capacity = 100;
+    constexpr size_t recordSize = 64;
+    constexpr size_t limit = 10 * recordSize;
+    constexpr double expensive = 1000.0;
+    constexpr double cheap = 1.0;
+    auto budget = std::make_shared<ByteBudget>(limit);
+    GreedyDualSizeCache<IntKey, int> cache0(capacity, budget);
+    GreedyDualSizeCache<IntKey, int> cache1(capacity, budget);
+    OV_ASSERT_NO_THROW(cache0.put({-1}, -1, expensive, recordSize));
+
+    // the cheap records of another cache evict each other, not the expensive one
+    for (int i = 0; i < 5 * capacity; ++i) {
+        OV_ASSERT_NO_THROW(cache1.put({i}, i, cheap, recordSize));
+    }
+    ASSERT_EQ(cache0.get({-1}), -1);
+    ASSERT_EQ(cache1.getSize(), limit / recordSize - 1);
+    ASSERT_EQ(cache0.getEvictionCount(), 0);
+}
+
+TEST(GreedyDualSizeCacheTests, RecordLargerThanBudgetIsNotStored) {
+    constexpr int capacity = 10;
+    constexpr size_t limit = 100;
+    auto budget = std::make_shared<ByteBudget>(limit);
+    GreedyDualSizeCache<IntKey, int> cache(capacity, budget);
+    OV_ASSERT_NO_THROW(cache.put({0}, 0, 1.0, limit));
+    OV_ASSERT_NO_THROW(cache.put({1}, 1, 1.0, limit + 1));
+
+    // the oversized record neither enters the cache nor flushes it
+    ASSERT_EQ(cache.get({0}), 0);
+    ASSERT_EQ(cache.get({1}), int());
+    ASSERT_EQ(budget->getBytes(), limit);
+}
+
+TEST(ByteBudgetTests, Split) {
+    const auto budgets = ByteBudget::split(10, 4);
+    ASSERT_EQ(budgets.size(), 4);
+    size_t total = 0;
+    for (const auto& budget : budgets) {
+        ASSERT_GE(budget->getLimit(), 2);
+        ASSERT_LE(budget->getLimit(), 3);
+        total += budget->getLimit();
+    }
+    ASSERT_EQ(total, 10);
+    ASSERT_EQ(ByteBudget::split(10, 0).size(), 1);
+}
+
+TEST(ByteBudgetTests, SplitNeverExceedsLimit) {
+    // fewer bytes than shards: some shards get no budget rather than overcommitting the total limit
+    const auto budgets = ByteBudget::split(3, 8);
+    size_t total = 0;
+    for (const auto& budget : budgets) {
+        total += budget->getLimit();
+    }
+    ASSERT_LE(total, 3);
+    ASSERT_FALSE(budgets.empty());
+}
+
+namespace {
+struct JitKernel {
+    size_t get_code_size() const {
+        return codeSize;
+    }
+    size_t codeSize;
+};
+}  // namespace
+
+TEST(ByteBudgetTests, RecordSize) {
+    // the JIT kernels are accounted with their code size, the other values with the estimate
+    ASSERT_EQ(getCacheRecordSize(std::make_shared<JitKernel>(JitKernel{100})), 100);
+    ASSERT_EQ(getCacheRecordSize(std::make_shared<JitKernel>(JitKernel{0})), 1);
+    ASSERT_EQ(getCacheRecordSize(std::make_shared<int>(0)), defaultCacheRecordSize);
+}
+
 namespace {
 template<typename T, typename K>
 class mockBuilder {
@@ -380,3 +582,213 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(MultiCacheTests, Statistics) {
+    constexpr int capacity = 10;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    MultiCache cache(capacity);
+    for (int i = 0; i < 2 * capacity; ++i) {
+        cache.getOrCreate(IntKey{i}, intBuilder);
+    }
+    for (int i = capacity; i < 2 * capacity; ++i) {
+        cache.getOrCreate(IntKey{i}, intBuilder);
+    }
+
+    const auto stats = cache.getStatistics();
+    ASSERT_EQ(stats.misses, static_cast<size_t>(2 * capacity));
+    ASSERT_EQ(stats.hits, static_cast<size_t>(capacity));
+    ASSERT_EQ(stats.evictions, static_cast<size_t>(capacity));
+    ASSERT_EQ(stats.records, static_cast<size_t>(capacity));
+}
+
+TEST(MultiCacheTests, SharedConcurrentAccess) {
+    using IntValueType = std::shared_ptr<int>;
+    using StrValueType = std::shared_ptr<std::string>;
+
+    constexpr int capacity = 128;
+    constexpr int numKeys = 16;
+    constexpr size_t numThreads = 16;
+    constexpr size_t numShards = 8;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+    auto strBuilder = [&](const StringKey& key) { return std::make_shared<std::string>(key.data); };
+
+    MultiCache cache(capacity, numShards);
+    ASSERT_TRUE(cache.isThreadSafe());
+
+    auto testRoutine = [&]() {
+        for (int iter = 0; iter < 10; ++iter) {
+            for (int i = 0; i < numKeys; ++i) {
+                auto intResult = cache.getOrCreate(IntKey{i}, intBuilder);
+                ASSERT_NE(intResult.first, IntValueType());
+                ASSERT_EQ(*intResult.first, i);
+                auto strResult = cache.getOrCreate(StringKey{std::to_string(i)}, strBuilder);
+                ASSERT_NE(strResult.first, StrValueType());
+                ASSERT_EQ(*strResult.first, std::to_string(i));
+            }
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine));
+        }
+    }
+
+    const auto stats = cache.getStatistics();
+    ASSERT_EQ(stats.hits + stats.misses, numThreads * 10 * 2 * numKeys);
+    // the number of distinct keys, not threads x keys, bounds the number of records
+    ASSERT_EQ(stats.records, static_cast<size_t>(2 * numKeys));
+    ASSERT_EQ(stats.evictions, 0);
+
+    // every key is built at least once, concurrent misses of the same key may build it more than once
+    ASSERT_GE(stats.misses, static_cast<size_t>(2 * numKeys));
+}
+
+namespace {
+struct ShareableIntKey : IntKey {
+    static constexpr bool shareable = true;
+};
+}  // namespace
+
+TEST(MultiCacheTests, StreamCachesShareImmutableRecordsOnly) {
+    constexpr int capacity = 16;
+    auto builder = [](const IntKey& key) {
+        return std::make_shared<int>(key.data);
+    };
+    auto shareableBuilder = [](const ShareableIntKey& key) {
+        return std::make_shared<int>(key.data);
+    };
+
+    auto shared = std::make_shared<MultiCache>(capacity, 4);
+    MultiCache first(capacity, 0, MultiCache::EvictionPolicy::LRU, 0, shared);
+    MultiCache second(capacity, 0, MultiCache::EvictionPolicy::LRU, 0, shared);
+    ASSERT_FALSE(first.isThreadSafe());
+    ASSERT_EQ(first.getSharedCache(), shared);
+
+    // the records with per-execution state are built by every stream
+    const auto firstState = first.getOrCreate(IntKey{1}, builder);
+    const auto secondState = second.getOrCreate(IntKey{1}, builder);
+    ASSERT_EQ(firstState.second, CacheEntryBase::LookUpStatus::Miss);
+    ASSERT_EQ(secondState.second, CacheEntryBase::LookUpStatus::Miss);
+    ASSERT_NE(firstState.first, secondState.first);
+
+    // the immutable records are built once
+    const auto firstKernel = first.getOrCreate(ShareableIntKey{{1}}, shareableBuilder);
+    const auto secondKernel = second.getOrCreate(ShareableIntKey{{1}}, shareableBuilder);
+    ASSERT_EQ(firstKernel.second, CacheEntryBase::LookUpStatus::Miss);
+    ASSERT_EQ(secondKernel.second, CacheEntryBase::LookUpStatus::Hit);
+    ASSERT_EQ(firstKernel.first, secondKernel.first);
+
+    ASSERT_EQ(shared->getStatistics().records, 1);
+    ASSERT_EQ(first.getStatistics().records, 1);
+    ASSERT_EQ(second.getStatistics().records, 1);
+
+    // only a thread safe cache may be shared
+    ASSERT_THROW(MultiCache(capacity, 0, MultiCache::EvictionPolicy::LRU, 0, std::make_shared<MultiCache>(capacity)),
+                 ov::Exception);
+}
+
+TEST(MultiCacheTests, CostAwarePolicy) {
+    using IntValueType = std::shared_ptr<int>;
+
+    constexpr int capacity = 10;
+    constexpr size_t budget = 4;
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    // the values don't report their size, so every record takes the estimated size
+    MultiCache cache(capacity, 0, MultiCache::EvictionPolicy::CostAware, budget * defaultCacheRecordSize);
+    for (int i = 0; i < capacity; ++i) {
+        auto result = cache.getOrCreate(IntKey{i}, intBuilder);
+        ASSERT_NE(result.first, IntValueType());
+        ASSERT_EQ(*result.first, i);
+        ASSERT_EQ(result.second, CacheEntryBase::LookUpStatus::Miss);
+    }
+    const auto stats = cache.getStatistics();
+    ASSERT_EQ(stats.records, budget);
+    ASSERT_EQ(stats.records + stats.evictions, static_cast<size_t>(capacity));
+}
+
+TEST(MultiCacheTests, CostAwarePolicySharded) {
+    constexpr int capacity = 100;
+    constexpr size_t numShards = 4;
+    constexpr size_t budget = 8;
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+    auto strBuilder = [&](const StringKey& key) { return std::make_shared<std::string>(key.data); };
+
+    MultiCache cache(capacity, numShards, MultiCache::EvictionPolicy::CostAware, budget * defaultCacheRecordSize);
+    for (int i = 0; i < 50; ++i) {
+        // every type keeps getting its new records regardless of the records of the other type in the same shard
+        ASSERT_EQ(cache.getOrCreate(IntKey{i}, intBuilder).second, CacheEntryBase::LookUpStatus::Miss);
+        ASSERT_EQ(cache.getOrCreate(IntKey{i}, intBuilder).second, CacheEntryBase::LookUpStatus::Hit);
+        ASSERT_EQ(cache.getOrCreate(StringKey{std::to_string(i)}, strBuilder).second,
+                  CacheEntryBase::LookUpStatus::Miss);
+        ASSERT_EQ(cache.getOrCreate(StringKey{std::to_string(i)}, strBuilder).second,
+                  CacheEntryBase::LookUpStatus::Hit);
+        ASSERT_LE(cache.getStatistics().records, budget);
+    }
+    const auto stats = cache.getStatistics();
+    ASSERT_EQ(stats.misses, 100);
+    ASSERT_EQ(stats.records + stats.evictions, stats.misses);
+}
+
+TEST(InputShapesRecorderTests, RecordUnique) {
+    constexpr size_t capacity = 3;
+    InputShapesRecorder recorder(capacity);
+    recorder.record({{1, 128}, {1, 128}});
+    recorder.record({{1, 128}, {1, 128}});
+    recorder.record({{2, 64}, {2, 64}});
+    ASSERT_EQ(recorder.size(), 2);
+
+    recorder.record({{4, 32}, {4, 32}});
+    recorder.record({{8, 16}, {8, 16}});
+    ASSERT_EQ(recorder.size(), capacity);
+    const auto shapeSets = recorder.get();
+    ASSERT_EQ(shapeSets.front(), InputShapesRecorder::ShapeSet({{1, 128}, {1, 128}}));
+    ASSERT_EQ(shapeSets.back(), InputShapesRecorder::ShapeSet({{4, 32}, {4, 32}}));
+}
+
+TEST(InputShapesRecorderTests, SerializeDeserialize) {
+    const std::vector<InputShapesRecorder::ShapeSet> shapeSets{{{1, 3, 224, 224}, {}},
+                                                               {{2, 3, 112, 112}, {5}},
+                                                               {}};
+    const auto str = InputShapesRecorder::serialize(shapeSets);
+    ASSERT_EQ(str, "[1,3,224,224][]|[2,3,112,112][5]|");
+
+    const auto restored = InputShapesRecorder::deserialize(str);
+    ASSERT_EQ(restored.size(), 2);
+    ASSERT_EQ(restored[0], shapeSets[0]);
+    ASSERT_EQ(restored[1], shapeSets[1]);
+    ASSERT_TRUE(InputShapesRecorder::deserialize("").empty());
+}
+
+TEST(InputShapesRecorderTests, FindBatchBucket) {
+    const std::vector<InputShapesRecorder::ShapeSet> buckets{{{8, 128}, {8, 128}},
+                                                             {{2, 128}, {2, 128}},
+                                                             {{4, 128}, {4, 128}},
+                                                             {{4, 128, 1}, {4, 128, 1}},
+                                                             {{4, 256}, {4, 256}}};
+    auto bucket = InputShapesRecorder::findBatchBucket(buckets, {{3, 128}, {3, 128}});
+    ASSERT_NE(bucket, nullptr);
+    ASSERT_EQ(*bucket, buckets[2]);
+
+    bucket = InputShapesRecorder::findBatchBucket(buckets, {{2, 128}, {2, 128}});
+    ASSERT_NE(bucket, nullptr);
+    ASSERT_EQ(*bucket, buckets[1]);
+
+    bucket = InputShapesRecorder::findBatchBucket(buckets, {{5, 128}, {5, 128}});
+    ASSERT_NE(bucket, nullptr);
+    ASSERT_EQ(*bucket, buckets[0]);
+
+    // only the batch is padded
+    ASSERT_EQ(InputShapesRecorder::findBatchBucket(buckets, {{3, 100}, {3, 100}}), nullptr);
+    ASSERT_EQ(InputShapesRecorder::findBatchBucket(buckets, {{1, 256}, {1, 200}}), nullptr);
+    // the padded inputs must share the batch
+    ASSERT_EQ(InputShapesRecorder::findBatchBucket(buckets, {{1, 128}, {3, 128}}), nullptr);
+    ASSERT_EQ(InputShapesRecorder::findBatchBucket(buckets, {{16, 128}, {16, 128}}), nullptr);
+    ASSERT_EQ(InputShapesRecorder::findBatchBucket(buckets, {{1, 1}}), nullptr);
+}
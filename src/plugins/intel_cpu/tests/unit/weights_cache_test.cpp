@@ -0,0 +1,264 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "openvino/core/except.hpp"
+#include "weights_cache.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+MemoryPtr createMemory(const dnnl::engine& eng) {
+    auto desc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape{16});
+    return std::make_shared<Memory>(eng, desc);
+}
+}  // namespace
+
+TEST(WeightsSharingTest, ConcurrentCreateSameKey) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    WeightsSharing cache;
+    std::atomic<size_t> numCreated{0};
+    std::atomic<bool> start{false};
+    constexpr size_t numThreads = 8;
+
+    std::vector<MemoryPtr> results(numThreads);
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < numThreads; ++i) {
+        workers.emplace_back([&, i]() {
+            while (!start.load()) {
+            }
+            results[i] = MemoryPtr(*cache.findOrCreate("weights", [&]() {
+                numCreated++;
+                return createMemory(eng);
+            }));
+        });
+    }
+    start = true;
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    ASSERT_EQ(numCreated.load(), 1);
+    for (const auto& result : results) {
+        ASSERT_EQ(result, results.front());
+    }
+    const auto stats = cache.getContentionStatistics();
+    ASSERT_EQ(stats.lookups, numThreads);
+    ASSERT_EQ(stats.creations, 1);
+}
+
+TEST(WeightsSharingTest, ConcurrentCreateDifferentKeys) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    WeightsSharing cache;
+    std::atomic<bool> start{false};
+    constexpr size_t numThreads = 8;
+
+    std::vector<MemoryPtr> results(numThreads);
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < numThreads; ++i) {
+        workers.emplace_back([&, i]() {
+            while (!start.load()) {
+            }
+            results[i] = MemoryPtr(*cache.findOrCreate("weights_" + std::to_string(i), [&]() {
+                return createMemory(eng);
+            }));
+        });
+    }
+    start = true;
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    ASSERT_EQ(cache.getContentionStatistics().creations, numThreads);
+    for (size_t i = 0; i < numThreads; ++i) {
+        ASSERT_EQ(MemoryPtr(*cache.get("weights_" + std::to_string(i))), results[i]);
+    }
+}
+
+TEST(WeightsSharingTest, ConcurrentHitsDoNotContend) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    WeightsSharing cache;
+    auto memory = MemoryPtr(*cache.findOrCreate("weights", [&]() {
+        return createMemory(eng);
+    }));
+    std::atomic<bool> start{false};
+    constexpr size_t numThreads = 8;
+    constexpr size_t numLookups = 1000;
+
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < numThreads; ++i) {
+        workers.emplace_back([&]() {
+            while (!start.load()) {
+            }
+            for (size_t j = 0; j < numLookups; ++j) {
+                ASSERT_EQ(MemoryPtr(*cache.findOrCreate("weights", [&]() {
+                              return createMemory(eng);
+                          })),
+                          memory);
+            }
+        });
+    }
+    start = true;
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    // the hits of the valid entry take the shard lock in the shared mode only, so they never wait for each other
+    const auto stats = cache.getContentionStatistics();
+    ASSERT_EQ(stats.creations, 1);
+    ASSERT_EQ(stats.lock_contentions, 0);
+}
+
+TEST(WeightsSharingTest, FailedCreationIsRetried) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    WeightsSharing cache;
+    ASSERT_ANY_THROW(cache.findOrCreate("weights", []() -> MemoryPtr {
+        OPENVINO_THROW("creation failure");
+    }));
+    ASSERT_ANY_THROW(cache.get("weights"));
+
+    auto memory = MemoryPtr(*cache.findOrCreate("weights", [&]() {
+        return createMemory(eng);
+    }));
+    ASSERT_NE(memory, nullptr);
+    ASSERT_EQ(MemoryPtr(*cache.get("weights")), memory);
+}
+
+TEST(WeightsSharingTest, HotReplicationByteBudget) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    const size_t weightsSize = createMemory(eng)->getSize();
+    const int hotConstant = 0;
+    auto singleCopy = std::make_shared<WeightsSharing>(true);
+    auto replication = std::make_shared<WeightsSharing::Replication>(singleCopy,
+                                                                     weightsSize + weightsSize / 2,
+                                                                     std::unordered_set<const void*>{&hotConstant});
+    WeightsSharing socket0(replication);
+    WeightsSharing socket1(replication);
+    WeightsSharing socket2(replication);
+    size_t numCreated = 0;
+    auto create = [&]() {
+        numCreated++;
+        return createMemory(eng);
+    };
+
+    // the first socket creates the single copy
+    auto shared = MemoryPtr(*socket0.findOrCreate("weights", create, true, &hotConstant));
+    ASSERT_EQ(numCreated, 1);
+    ASSERT_EQ(replication->usedBytes.load(), 0);
+    ASSERT_EQ(MemoryPtr(*singleCopy->get("weights")), shared);
+
+    // the next socket gets a replica within the budget
+    auto replica = MemoryPtr(*socket1.findOrCreate("weights", create, true, &hotConstant));
+    ASSERT_EQ(numCreated, 2);
+    ASSERT_NE(replica, shared);
+    ASSERT_EQ(replication->usedBytes.load(), weightsSize);
+
+    // the budget is exhausted, so the last socket uses the single copy
+    ASSERT_EQ(MemoryPtr(*socket2.findOrCreate("weights", create, true, &hotConstant)), shared);
+    ASSERT_EQ(numCreated, 2);
+    ASSERT_EQ(MemoryPtr(*socket0.get("weights")), shared);
+    ASSERT_EQ(MemoryPtr(*socket1.get("weights")), replica);
+    ASSERT_EQ(replication->usedBytes.load(), weightsSize);
+}
+
+TEST(WeightsSharingTest, HotReplicationFollowsSource) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    const size_t weightsSize = createMemory(eng)->getSize();
+    const int hotConstant = 0;
+    const int coldConstant = 0;
+    auto singleCopy = std::make_shared<WeightsSharing>(true);
+    auto replication = std::make_shared<WeightsSharing::Replication>(singleCopy,
+                                                                     10 * weightsSize,
+                                                                     std::unordered_set<const void*>{&hotConstant});
+    WeightsSharing socket0(replication);
+    WeightsSharing socket1(replication);
+    auto create = [&]() {
+        return createMemory(eng);
+    };
+
+    // the weights of a constant which is not hot are never replicated
+    auto cold = MemoryPtr(*socket0.findOrCreate("cold", create, true, &coldConstant));
+    ASSERT_EQ(MemoryPtr(*socket1.findOrCreate("cold", create, true, &coldConstant)), cold);
+    ASSERT_EQ(MemoryPtr(*socket1.findOrCreate("cold", create)), cold);
+    ASSERT_EQ(replication->usedBytes.load(), 0);
+
+    auto shared = MemoryPtr(*socket0.findOrCreate("hot", create, true, &hotConstant));
+    auto replica = MemoryPtr(*socket1.findOrCreate("hot", create, true, &hotConstant));
+    ASSERT_NE(replica, shared);
+
+    // the weights derived from the single copy are hot, the ones derived from a replica are socket local
+    auto derivedShared = MemoryPtr(*socket0.findOrCreate("derived0", create, true, shared->getData()));
+    ASSERT_EQ(MemoryPtr(*singleCopy->get("derived0")), derivedShared);
+    auto derivedReplica = MemoryPtr(*socket1.findOrCreate("derived1", create, true, replica->getData()));
+    ASSERT_EQ(MemoryPtr(*socket1.get("derived1")), derivedReplica);
+    ASSERT_THROW(singleCopy->get("derived1"), ov::Exception);
+    ASSERT_EQ(replication->usedBytes.load(), 2 * weightsSize);
+}
+
+TEST(WeightsSharingTest, HotReplicationBudgetReleasedOnFailure) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    const int hotConstant = 0;
+    auto singleCopy = std::make_shared<WeightsSharing>(true);
+    auto replication = std::make_shared<WeightsSharing::Replication>(singleCopy,
+                                                                     createMemory(eng)->getSize(),
+                                                                     std::unordered_set<const void*>{&hotConstant});
+    WeightsSharing socket0(replication);
+    WeightsSharing socket1(replication);
+    auto shared = MemoryPtr(*socket0.findOrCreate(
+        "weights",
+        [&]() {
+            return createMemory(eng);
+        },
+        true,
+        &hotConstant));
+
+    ASSERT_THROW(socket1.findOrCreate(
+                     "weights",
+                     []() -> MemoryPtr {
+                         OPENVINO_THROW("creation failed");
+                     },
+                     true,
+                     &hotConstant),
+                 ov::Exception);
+    ASSERT_EQ(replication->usedBytes.load(), 0);
+
+    // the released budget is available for the next attempt
+    auto replica = MemoryPtr(*socket1.findOrCreate(
+        "weights",
+        [&]() {
+            return createMemory(eng);
+        },
+        true,
+        &hotConstant));
+    ASSERT_NE(replica, shared);
+    ASSERT_EQ(replication->usedBytes.load(), replica->getSize());
+}
+
+TEST(WeightsSharingTest, HotReplicationForgetsReleasedSources) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    const int hotConstant = 0;
+    auto singleCopy = std::make_shared<WeightsSharing>(true);
+    auto replication = std::make_shared<WeightsSharing::Replication>(singleCopy,
+                                                                     0,
+                                                                     std::unordered_set<const void*>{&hotConstant});
+    using Source = WeightsSharing::Replication::Source;
+    auto replica = createMemory(eng);
+    const void* data = replica->getData();
+    replication->mark(replica, Source::Replica);
+    ASSERT_EQ(replication->classify(data), Source::Replica);
+
+    // a new allocation at the address of the released replica must not be taken for a replica
+    replica.reset();
+    ASSERT_EQ(replication->classify(data), Source::Cold);
+    ASSERT_EQ(replication->classify(&hotConstant), Source::Hot);
+}